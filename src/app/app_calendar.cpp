@@ -0,0 +1,27 @@
+#include "app_calendar.h"
+#include "common/Log.h" // 引入日志系统
+#include "gui_port/gui_wf.h"
+#include "../ui/ui.h" // SquareLine 生成的 UI 代码
+
+/**
+ * @file app_calendar.cpp
+ * @brief 日历应用实现文件
+ */
+
+/**
+ * @brief App 启动回调
+ * @details 页面已由 PageManager 经页面缓存显示。
+ *          日历网格细线多，翻月时用全刷避免残影 (即使本次请求了局刷 / 快刷)。
+ */
+void App_Calendar::onStart() {
+    LOG_I("[App] Calendar: Start");
+    gui_wf_set(ui_Calendar1, GUI_WF_QUALITY);
+}
+
+/**
+ * @brief App 停止回调
+ * @details 返回上一个 App 前调用，页面对象留在 ScreenCache 中。
+ */
+void App_Calendar::onStop() {
+    LOG_I("[App] Calendar: Stop");
+}
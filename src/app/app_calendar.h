@@ -0,0 +1,33 @@
+#ifndef APP_CALENDAR_H
+#define APP_CALENDAR_H
+
+#include "../system/AppBase.h"
+
+/**
+ * @file app_calendar.h
+ * @brief 日历应用头文件
+ */
+
+/**
+ * @class App_Calendar
+ * @brief 日历应用类
+ * 
+ * @details 
+ * 继承自 AppBase，对应日历页面 (ui_CalendarPage)。
+ * 由主页导航按钮启动，返回按钮出栈。
+ */
+class App_Calendar : public AppBase {
+public:
+    /**
+     * @brief [生命周期] 启动
+     */
+    void onStart() override;
+
+    /**
+     * @brief [生命周期] 停止
+     * @details 页面对象交由 ScreenCache 管理，此处不销毁。
+     */
+    void onStop() override;
+};
+
+#endif
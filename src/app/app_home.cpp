@@ -1,5 +1,8 @@
 #include "App_Home.h"
 #include "../ui/ui.h" // SquareLine 生成的 UI 代码
+#include "../ui/ui_img_atlas.h"
+#include "gui_port/gui_atlas.h"
+#include "gui_port/gui_wf.h"
 #include "system/SysController.h"
 #include "common/Log.h" // 引入日志系统
 
@@ -8,29 +11,42 @@
  * @brief 主页应用实现文件
  */
 
+/**
+ * @brief 导航按钮改用图标集绘制，温度区域标注为局刷
+ * @details 按钮图标从 ui_icon_atlas 按子矩形绘制 (SquareLine 页面中不再设置单独的图片)。
+ *          温度文字只在原位改写，不需要整屏刷新。
+ */
+static void attach_icons() {
+    gui_atlas_attach(ui_btnWeather, &ui_icon_atlas, UI_ICON_WEATHER);
+    gui_atlas_attach(ui_btnTime, &ui_icon_atlas, UI_ICON_TIME);
+    gui_atlas_attach(ui_btnSetting, &ui_icon_atlas, UI_ICON_SETTING);
+    gui_atlas_attach(ui_btnApp, &ui_icon_atlas, UI_ICON_QR);
+    gui_wf_set(ui_SecondaryArea, GUI_WF_PARTIAL);
+}
+
+/**
+ * @brief 页面构建函数
+ * @details 页面被缓存淘汰后重建时同样经过这里。
+ */
+void App_Home::screenInit() {
+    ui_HomePage_screen_init();
+    attach_icons();
+}
+
 /**
  * @brief App 启动回调
  * @details
- * 当 PageManager 切换到此 App 时调用。
- * 负责：
- * 1. 检查并初始化 UI 资源 (ui_HomePage)。
- * 2. 执行切页动画。
- * 3. 发送初始业务指令 (如请求天气)。
+ * 当 PageManager 启动此 App 时调用。
+ * 页面 (ui_HomePage) 已由 PageManager 经页面缓存显示，此处只需
+ * 发送初始业务指令 (如请求天气)。
  */
 void App_Home::onStart() {
     LOG_I("[App] Home: Start");
 
-    // 1. 初始化 UI (按需加载)
-    // 检查 ui_HomePage 是否为空，防止重复创建导致内存泄漏
-    if (!ui_HomePage) {
-        ui_HomePage_screen_init();
-    }
-    
-    // 2. 切换画面 (直接切换，无动画)
-    // 墨水屏不适合淡入动画，会导致大量中间帧刷新
-    lv_scr_load_anim(ui_HomePage, LV_SCR_LOAD_ANIM_NONE, 0, 0, false);
+    // 数据绑定: 温度变化时才改写控件，页面重建后自动恢复
+    temperature.bind(&ui_SecondaryArea, &ui_HomePage, BindKind::TextArea, "中国 福建 福州 %d 多云");
 
-    // 3. 业务逻辑: 请求刷新天气
+    // 业务逻辑: 请求刷新天气
     // 向 Worker 线程发送 CMD_FETCH_WEATHER 指令
     // 这样不会阻塞当前 GUI 线程
     SysController::sendToWorker(CMD_FETCH_WEATHER);
@@ -39,19 +55,31 @@ void App_Home::onStart() {
 /**
  * @brief App 停止回调
  * @details
- * 当 PageManager 切换到其他 App 前调用。
- * 负责：
- * 1. 销毁 UI 对象，回收 RAM。
- * 2. 必须将全局 UI 指针置空 (ui_HomePage = NULL)，以便下次判断。
+ * 主页出栈 (如清空返回栈) 时调用。
+ * 页面对象留在 ScreenCache 中，下次进入时直接复用；
+ * 内存紧张时由缓存按 LRU 淘汰，无需在此销毁。
  */
 void App_Home::onStop() {
     LOG_I("[App] Home: Stop");
-    
-    // 1. 销毁 UI (释放 RAM)
-    if (ui_HomePage) {
-        lv_obj_del(ui_HomePage);
-        ui_HomePage = NULL; // 关键步骤：指针置空
-    }
+}
+
+/**
+ * @brief App 暂停回调
+ * @details 从主页进入其他页面 (如日历) 时调用，页面对象保持不变。
+ */
+void App_Home::onPause() {
+    LOG_I("[App] Home: Pause");
+}
+
+/**
+ * @brief App 恢复回调
+ * @details
+ * 从其他 App 返回主页时调用。页面若在暂停期间被缓存淘汰，已由 ScreenCache 重建，
+ * 此时重新请求天气以填充数据。
+ */
+void App_Home::onResume() {
+    LOG_I("[App] Home: Resume");
+    SysController::sendToWorker(CMD_FETCH_WEATHER);
 }
 
 /**
@@ -59,16 +87,16 @@ void App_Home::onStop() {
  * @param event 来自 Worker 线程的事件
  * @details
  * 处理数据更新逻辑。
- * 例如：收到 EVT_DATA_WEATHER 后，更新 UI 上的温度标签。
+ * 例如：收到 EVT_DATA_WEATHER 后，经数据绑定更新 UI 上的温度。
  */
 void App_Home::onEvent(sys_event_t* event) {
     switch (event->type) {
         case EVT_DATA_WEATHER: {
             int temp = event->arg;
             LOG_I("[App] Home: Weather Update -> %d C", temp);
-            
-            // TODO: 更新实际的 UI 组件
-            // 示例: if (ui_LabelTemp) lv_label_set_text_fmt(ui_LabelTemp, "%d°C", temp);
+
+            // 与上次显示的温度相同时不会产生任何失效区域
+            temperature.set(temp);
             break;
         }
         default: break;
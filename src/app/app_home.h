@@ -2,6 +2,7 @@
 #define APP_HOME_H
 
 #include "../system/AppBase.h"
+#include "../gui_port/gui_bind.h"
 
 /**
  * @file app_home.h
@@ -16,29 +17,50 @@
  * @details 
  * 继承自 AppBase，实现了首页的业务逻辑。
  * 主要功能：
- * 1. 显示主界面 (ui_HomePage)。
+ * 1. 作为返回栈的根 App，对应主界面 (ui_HomePage)。
  * 2. 启动时自动请求天气数据。
  * 3. 接收并展示天气、时间更新。
+ * 4. 导航按钮的图标改由图标集 (ui_icon_atlas) 绘制。
  */
 class App_Home : public AppBase {
 public:
     /**
      * @brief [生命周期] 启动
-     * @details 初始化主页 UI，请求天气数据。
+     * @details 请求天气数据 (页面已由 PageManager 显示)。
      */
     void onStart() override;
 
     /**
      * @brief [生命周期] 停止
-     * @details 销毁主页 UI 资源。
+     * @details 页面对象交由 ScreenCache 管理，此处不再销毁。
      */
     void onStop() override;
 
+    /**
+     * @brief [生命周期] 暂停 (进入其他页面)
+     */
+    void onPause() override;
+
+    /**
+     * @brief [生命周期] 恢复 (回到主页)
+     * @details 重新请求天气数据。
+     */
+    void onResume() override;
+
     /**
      * @brief [事件] 处理系统事件
      * @param event 系统事件 (如天气更新)
      */
     void onEvent(sys_event_t* event) override;
+
+    /**
+     * @brief 页面构建函数 (AppRegistry 中代替 ui_HomePage_screen_init)
+     * @details 构建 SquareLine 页面后立即换上图标集图标，在样式去重之前完成，预渲染的帧里同样生效。
+     */
+    static void screenInit();
+
+private:
+    IntCell temperature; ///< 当前温度 (绑定到 ui_SecondaryArea)
 };
 
 #endif
@@ -0,0 +1,75 @@
+#include "app_launcher.h"
+#include "common/Log.h"
+#include "gui_port/gui_launcher.h"
+#include "system/PageManager.h"
+#include "../ui/ui.h" // SquareLine 生成的 UI 代码
+#include "../ui/ui_img_atlas.h"
+
+/**
+ * @file app_launcher.cpp
+ * @brief 应用启动器实现文件
+ */
+
+/// 启动器网格列数
+#define LAUNCHER_COLS 2
+
+/// 每个格子的图标 (与 s_targets 一一对应)
+static const uint16_t s_icons[] = { UI_ICON_WEATHER, UI_ICON_TIME, UI_ICON_SETTING, UI_ICON_BACK };
+
+/// 每个格子启动的 App (APP_ID_COUNT 表示返回)
+static const app_id_t s_targets[] = { APP_ID_WEATHER, APP_ID_CALENDAR, APP_ID_SETTING, APP_ID_COUNT };
+
+/**
+ * @brief 启动器点击回调
+ */
+static void launcher_click(uint16_t index, void *user_data) {
+    LV_UNUSED(user_data);
+    app_id_t id = s_targets[index];
+    if (id == APP_ID_COUNT) {
+        if (!PageManager::back()) PageManager::startApp(APP_ID_HOME);
+        return;
+    }
+    PageManager::startApp(id);
+}
+
+/**
+ * @brief 页面上还没有启动器时创建
+ * @details SquareLine 中的 ui_AppPage 是空页面，有子控件即说明启动器已创建。
+ */
+static void ensure_launcher() {
+    if (ui_AppPage == nullptr || lv_obj_get_child_cnt(ui_AppPage) > 0) return;
+    gui_launcher_create(ui_AppPage, &ui_icon_atlas, s_icons, sizeof(s_icons) / sizeof(s_icons[0]),
+                        LAUNCHER_COLS, launcher_click, nullptr);
+}
+
+/**
+ * @brief 页面构建函数
+ */
+void App_Launcher::screenInit() {
+    ui_AppPage_screen_init();
+    ensure_launcher();
+}
+
+/**
+ * @brief App 启动回调
+ */
+void App_Launcher::onStart() {
+    LOG_I("[App] Launcher: Start");
+    ensure_launcher();
+}
+
+/**
+ * @brief App 停止回调
+ * @details 返回上一个 App 前调用，页面对象留在 ScreenCache 中。
+ */
+void App_Launcher::onStop() {
+    LOG_I("[App] Launcher: Stop");
+}
+
+/**
+ * @brief App 恢复回调
+ */
+void App_Launcher::onResume() {
+    LOG_I("[App] Launcher: Resume");
+    ensure_launcher();
+}
@@ -0,0 +1,46 @@
+#ifndef APP_LAUNCHER_H
+#define APP_LAUNCHER_H
+
+#include "../system/AppBase.h"
+
+/**
+ * @file app_launcher.h
+ * @brief 应用启动器头文件
+ */
+
+/**
+ * @class App_Launcher
+ * @brief 应用启动器类
+ *
+ * @details
+ * 继承自 AppBase，对应应用页面 (ui_AppPage)，由主页的应用按钮启动。
+ * 页面上是一个 gui_launcher 图标网格 (图标取自 ui_icon_atlas)，点击图标启动对应 App。
+ */
+class App_Launcher : public AppBase {
+public:
+    /**
+     * @brief [生命周期] 启动
+     * @details 页面上还没有启动器时创建 (页面可能被缓存淘汰后重建)。
+     */
+    void onStart() override;
+
+    /**
+     * @brief [生命周期] 停止
+     * @details 页面对象交由 ScreenCache 管理，此处不销毁。
+     */
+    void onStop() override;
+
+    /**
+     * @brief [生命周期] 恢复 (从启动的 App 返回)
+     * @details 页面在暂停期间可能被重建，同样检查启动器是否存在。
+     */
+    void onResume() override;
+
+    /**
+     * @brief 页面构建函数 (AppRegistry 中代替 ui_AppPage_screen_init)
+     * @details 构建 SquareLine 页面后立即创建启动器，预渲染 (gui_spec) 的帧里就带有图标。
+     */
+    static void screenInit();
+};
+
+#endif
@@ -0,0 +1,34 @@
+#include "app_setting.h"
+#include "common/Log.h" // 引入日志系统
+#include "gui_port/gui_scroll.h"
+#include "gui_port/gui_wf.h"
+#include "../ui/ui.h" // SquareLine 生成的 UI 代码
+
+/**
+ * @file app_setting.cpp
+ * @brief 设置应用实现文件
+ */
+
+/**
+ * @brief App 启动回调
+ * @details 页面已由 PageManager 经页面缓存显示。
+ *          设置列表高于屏幕，改为分页滚动：一次上下滑动翻一页，只局刷列表区域。
+ *          开关切换只改变开关本身，标注为局刷。
+ *          页面可能被缓存淘汰后重建，所以每次启动都重新设置 (重复调用无副作用)。
+ */
+void App_Setting::onStart() {
+    LOG_I("[App] Setting: Start");
+    gui_scroll_snap(ui_SettingContainer, GUI_SNAP_PAGE);
+    gui_wf_set(ui_wifiSwitch, GUI_WF_PARTIAL);
+    gui_wf_set(ui_bleSwitch, GUI_WF_PARTIAL);
+    gui_wf_set(ui_timeModeSwitch, GUI_WF_PARTIAL);
+    gui_wf_set(ui_memorandumSwitch, GUI_WF_PARTIAL);
+}
+
+/**
+ * @brief App 停止回调
+ * @details 返回上一个 App 前调用，页面对象留在 ScreenCache 中。
+ */
+void App_Setting::onStop() {
+    LOG_I("[App] Setting: Stop");
+}
@@ -0,0 +1,33 @@
+#ifndef APP_SETTING_H
+#define APP_SETTING_H
+
+#include "../system/AppBase.h"
+
+/**
+ * @file app_setting.h
+ * @brief 设置应用头文件
+ */
+
+/**
+ * @class App_Setting
+ * @brief 设置应用类
+ * 
+ * @details 
+ * 继承自 AppBase，对应设置页面 (ui_SettingPage)。
+ * 由主页导航按钮启动，返回按钮出栈。
+ */
+class App_Setting : public AppBase {
+public:
+    /**
+     * @brief [生命周期] 启动
+     */
+    void onStart() override;
+
+    /**
+     * @brief [生命周期] 停止
+     * @details 页面对象交由 ScreenCache 管理，此处不销毁。
+     */
+    void onStop() override;
+};
+
+#endif
@@ -0,0 +1,42 @@
+#include "app_weather.h"
+#include "system/SysController.h"
+#include "common/Log.h" // 引入日志系统
+#include "gui_port/gui_wf.h"
+#include "../ui/ui.h" // SquareLine 生成的 UI 代码
+
+/**
+ * @file app_weather.cpp
+ * @brief 天气应用实现文件
+ */
+
+/**
+ * @brief App 启动回调
+ * @details 页面已由 PageManager 经页面缓存显示，此处请求最新天气。
+ *          曲线图更新时用全刷保证对比度。
+ */
+void App_Weather::onStart() {
+    LOG_I("[App] Weather: Start");
+    gui_wf_set(ui_WeatherChart, GUI_WF_QUALITY);
+    SysController::sendToWorker(CMD_FETCH_WEATHER);
+}
+
+/**
+ * @brief App 停止回调
+ * @details 返回上一个 App 前调用，页面对象留在 ScreenCache 中。
+ */
+void App_Weather::onStop() {
+    LOG_I("[App] Weather: Stop");
+}
+
+/**
+ * @brief 事件处理回调
+ * @param event 来自 Worker 线程的事件
+ */
+void App_Weather::onEvent(sys_event_t* event) {
+    switch (event->type) {
+        case EVT_DATA_WEATHER:
+            LOG_I("[App] Weather: Weather Update -> %d C", (int)event->arg);
+            break;
+        default: break;
+    }
+}
@@ -0,0 +1,40 @@
+#ifndef APP_WEATHER_H
+#define APP_WEATHER_H
+
+#include "../system/AppBase.h"
+
+/**
+ * @file app_weather.h
+ * @brief 天气应用头文件
+ */
+
+/**
+ * @class App_Weather
+ * @brief 天气应用类
+ * 
+ * @details 
+ * 继承自 AppBase，对应天气页面 (ui_WeatherPage)。
+ * 启动时请求天气数据。
+ * 由主页导航按钮启动，返回按钮出栈。
+ */
+class App_Weather : public AppBase {
+public:
+    /**
+     * @brief [生命周期] 启动
+     */
+    void onStart() override;
+
+    /**
+     * @brief [生命周期] 停止
+     * @details 页面对象交由 ScreenCache 管理，此处不销毁。
+     */
+    void onStop() override;
+
+    /**
+     * @brief [事件] 处理系统事件
+     * @param event 系统事件 (如天气更新)
+     */
+    void onEvent(sys_event_t* event) override;
+};
+
+#endif
@@ -12,6 +12,8 @@
 
 /// 忙等待超时时间 (ms)
 #define EPD_BUSY_TIMEOUT_MS  5000
+/// 三色刷新的忙等待超时时间 (ms)，红色波形需要 15 s 左右
+#define EPD_BWR_BUSY_TIMEOUT_MS  30000
 
 /* --- 内部辅助函数 --- */
 
@@ -19,18 +21,21 @@
  * @brief 等待电子纸忙闲状态 (BUSY 引脚)
  * @details 轮询 BUSY 引脚直到其变低或超时。
  *          注意：具体电平逻辑需根据屏幕规格书确认 (通常 HIGH = BUSY)。
+ * @param timeout_ms 超时时间
  */
-static void _epd_wait_busy(void) {
-
-
+static void _epd_wait_busy_for(uint32_t timeout_ms) {
     uint32_t start_time = millis();
     // 原厂逻辑：HIGH = BUSY
     while (hal_gpio_read(PIN_EPD_BUSY) == HAL_GPIO_HIGH) {
         delay(1); 
-        if ((millis() - start_time) > EPD_BUSY_TIMEOUT_MS) break; 
+        if ((millis() - start_time) > timeout_ms) break; 
     }
 }
 
+static void _epd_wait_busy(void) {
+    _epd_wait_busy_for(EPD_BUSY_TIMEOUT_MS);
+}
+
 /**
  * @brief 硬件复位电子纸
  * @details 通过 RST 引脚产生复位脉冲。
@@ -67,6 +72,58 @@ static void _epd_data(uint8_t data) {
     hal_gpio_write(PIN_SPI_CS, HAL_GPIO_HIGH);
 }
 
+/**
+ * @brief 设置 RAM 读写窗口并把地址计数器移到窗口起点
+ * @param xb0 起始字节列 (0 ~ EPD_WIDTH/8-1)
+ * @param xb1 结束字节列 (含)
+ * @param y0  起始行
+ * @param y1  结束行 (含)
+ */
+static void _epd_set_window(uint8_t xb0, uint8_t xb1, uint16_t y0, uint16_t y1) {
+    _epd_cmd(0x44); // Set RAM X address start/end
+    _epd_data(xb0);
+    _epd_data(xb1);
+
+    _epd_cmd(0x45); // Set RAM Y address start/end
+    _epd_data(y0 & 0xFF);
+    _epd_data(y0 >> 8);
+    _epd_data(y1 & 0xFF);
+    _epd_data(y1 >> 8);
+
+    _epd_cmd(0x4E); // Set RAM X address counter
+    _epd_data(xb0);
+    _epd_cmd(0x4F); // Set RAM Y address counter
+    _epd_data(y0 & 0xFF);
+    _epd_data(y0 >> 8);
+}
+
+/**
+ * @brief 把整帧中的一个窗口写入指定 RAM
+ * @param ram      0x24 (新图) 或 0x26 (旧图 / 三色屏红色平面)
+ * @param xor_mask 每个字节发送前异或的值 (0xFF 取反，用于红色平面极性)
+ */
+static void _epd_write_window(uint8_t ram, const uint8_t *image_buffer,
+                              uint8_t xb0, uint8_t xb1, uint16_t y0, uint16_t y1, uint8_t xor_mask = 0) {
+    const uint8_t width_bytes = EPD_WIDTH / 8;
+
+    _epd_set_window(xb0, xb1, y0, y1);
+    _epd_cmd(ram);
+    for (uint16_t y = y0; y <= y1; y++) {
+        const uint8_t *row = image_buffer + (uint32_t)y * width_bytes;
+        for (uint8_t xb = xb0; xb <= xb1; xb++) {
+            _epd_data(row[xb] ^ xor_mask);
+        }
+    }
+}
+
+/**
+ * @brief 边框波形恢复为整屏刷新使用的值 (局刷会把边框设为保持)
+ */
+static void _epd_border_full(void) {
+    _epd_cmd(0x3C); // Border Waveform: 跟随 LUT，白色
+    _epd_data(0x05);
+}
+
 /* --- 公开接口 --- */
 
 /**
@@ -101,7 +158,10 @@ sys_status_t bsp_epd_init(void) {
 void bsp_epd_display_full(const uint8_t *image_buffer) {
     if (image_buffer == NULL) return;
 
-    // 1. 写 RAM 命令
+    _epd_border_full();
+
+    // 1. 写 RAM 命令 (窗口恢复为整屏，局刷会修改窗口)
+    _epd_set_window(0, EPD_WIDTH / 8 - 1, 0, EPD_HEIGHT - 1);
     _epd_cmd(0x24); 
     
     // 2. 写入数据
@@ -114,6 +174,9 @@ void bsp_epd_display_full(const uint8_t *image_buffer) {
         _epd_data(image_buffer[i]);
     }
 
+    // 同时写入旧图 RAM，作为之后局刷的差分基准
+    _epd_write_window(0x26, image_buffer, 0, EPD_WIDTH / 8 - 1, 0, EPD_HEIGHT - 1);
+
     // 3. 刷新序列
     _epd_cmd(0x22); // Display Update Control 2
     _epd_data(0xF7); 
@@ -121,6 +184,80 @@ void bsp_epd_display_full(const uint8_t *image_buffer) {
     _epd_wait_busy();
 }
 
+/**
+ * @brief 整屏快刷
+ * @details 写入一个固定的高温值让控制器载入快速 LUT (0x91 只载入不刷新)，
+ *          再以 0xC7 (使用已载入的 LUT) 刷新。下一次全刷 (0xF7) 会重新读取温度传感器。
+ */
+void bsp_epd_display_fast(const uint8_t *image_buffer) {
+    if (image_buffer == NULL) return;
+
+    _epd_border_full();
+    _epd_cmd(0x18); // Temperature Sensor Control: 内部传感器
+    _epd_data(0x80);
+    _epd_cmd(0x22);
+    _epd_data(0xB1); // 读取温度并载入 LUT
+    _epd_cmd(0x20);
+    _epd_wait_busy();
+
+    _epd_cmd(0x1A); // Write Temperature Register (100 °C 对应快速波形)
+    _epd_data(0x64);
+    _epd_data(0x00);
+    _epd_cmd(0x22);
+    _epd_data(0x91); // 按写入的温度载入 LUT
+    _epd_cmd(0x20);
+    _epd_wait_busy();
+
+    _epd_write_window(0x24, image_buffer, 0, EPD_WIDTH / 8 - 1, 0, EPD_HEIGHT - 1);
+    _epd_write_window(0x26, image_buffer, 0, EPD_WIDTH / 8 - 1, 0, EPD_HEIGHT - 1);
+
+    _epd_cmd(0x22);
+    _epd_data(0xC7);
+    _epd_cmd(0x20);
+    _epd_wait_busy();
+}
+
+/**
+ * @brief 窗口局部刷新
+ * @details 新图写入 0x24，以 0xFF (差分波形) 刷新，完成后把同一窗口写入 0x26 作为下一次的旧图。
+ */
+void bsp_epd_display_window(const uint8_t *image_buffer, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    if (image_buffer == NULL || w == 0 || h == 0 || x >= EPD_WIDTH || y >= EPD_HEIGHT) return;
+    if (x + w > EPD_WIDTH) w = EPD_WIDTH - x;
+    if (y + h > EPD_HEIGHT) h = EPD_HEIGHT - y;
+
+    uint8_t xb0 = x / 8;
+    uint8_t xb1 = (x + w - 1) / 8;
+    uint16_t y1 = y + h - 1;
+
+    _epd_cmd(0x3C); // Border Waveform: 局刷时边框保持不变
+    _epd_data(0x80);
+
+    _epd_write_window(0x24, image_buffer, xb0, xb1, y, y1);
+    _epd_cmd(0x22);
+    _epd_data(0xFF);
+    _epd_cmd(0x20);
+    _epd_wait_busy();
+
+    _epd_write_window(0x26, image_buffer, xb0, xb1, y, y1);
+}
+
+/**
+ * @brief 三色整屏刷新
+ */
+void bsp_epd_display_bwr(const uint8_t *bw, const uint8_t *red) {
+    if (bw == NULL || red == NULL) return;
+
+    _epd_border_full();
+    _epd_write_window(0x24, bw, 0, EPD_WIDTH / 8 - 1, 0, EPD_HEIGHT - 1);
+    _epd_write_window(0x26, red, 0, EPD_WIDTH / 8 - 1, 0, EPD_HEIGHT - 1, EPD_BWR_RED_INVERT ? 0xFF : 0x00);
+
+    _epd_cmd(0x22);
+    _epd_data(0xF7);
+    _epd_cmd(0x20);
+    _epd_wait_busy_for(EPD_BWR_BUSY_TIMEOUT_MS);
+}
+
 /**
  * @brief 清屏 (填充指定颜色)
  * @param color 填充颜色 (0: 黑色, 1: 白色 - 注意 EPD 通常 0xff 是白)
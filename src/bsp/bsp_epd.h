@@ -14,6 +14,29 @@
 #define EPD_WIDTH   176  ///< 屏幕宽度 (像素)
 #define EPD_HEIGHT  264  ///< 屏幕高度 (像素)
 
+/**
+ * 三色 (黑 / 白 / 红) 屏 (同系列控制器的 BWR 2.7 寸)：
+ * 0x24 为黑白平面，0x26 为红色平面 (不再用作局刷旧图)，只支持整屏三色刷新 (约 15 s)。
+ * 在 platformio.ini 中以 -D EPD_BWR=1 启用。
+ */
+#ifndef EPD_BWR
+#define EPD_BWR 0
+#endif
+
+/// 红色平面极性：0 为 1 = 红 (默认)，1 为 0 = 红 (部分批次的面板)
+#ifndef EPD_BWR_RED_INVERT
+#define EPD_BWR_RED_INVERT 0
+#endif
+
+/**
+ * @brief 刷新方式
+ */
+typedef enum {
+    EPD_REFRESH_FULL = 0,  ///< 全刷 (0xF7)：闪烁数次，无残影，约 2~3 s
+    EPD_REFRESH_FAST,      ///< 快刷 (0xC7 + 快速温度 LUT)：整屏，闪烁少，约 1.5 s
+    EPD_REFRESH_PARTIAL,   ///< 局刷 (0xFF，窗口)：不闪烁，约 0.3~0.5 s，连续多次后有残影
+} epd_refresh_mode_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -30,6 +53,35 @@ sys_status_t bsp_epd_init(void);
  */
 void bsp_epd_display_full(const uint8_t *image_buffer);
 
+/**
+ * @brief 整屏快刷
+ * @param image_buffer 整帧图像 (1 bit/pixel)
+ * @details 与全刷相同的数据，使用快速刷新波形 (闪烁少，对比度略低)。
+ */
+void bsp_epd_display_fast(const uint8_t *image_buffer);
+
+/**
+ * @brief 窗口局部刷新
+ * @param image_buffer 整帧图像 (1 bit/pixel，只取窗口内的数据)
+ * @param x 窗口起始列 (像素，屏幕原生方向，向下对齐到 8)
+ * @param y 窗口起始行
+ * @param w 窗口宽度 (像素，向上对齐到 8)
+ * @param h 窗口高度
+ * @details 控制器用新旧两份 RAM (0x24 / 0x26) 做差分驱动，不闪烁。
+ *          旧图 RAM 由全刷/快刷写入，局刷后同步更新窗口部分。
+ *          唤醒 (bsp_epd_init) 后旧图 RAM 内容无效，须先全刷一次。
+ */
+void bsp_epd_display_window(const uint8_t *image_buffer, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+/**
+ * @brief 三色整屏刷新
+ * @param bw  黑白平面 (1 bit/pixel，0:黑 1:白，红色像素处为 1)
+ * @param red 红色平面 (1 bit/pixel，1:红)
+ * @details 两个平面分别写入 0x24 / 0x26 后以 0xF7 刷新，三色波形耗时远长于黑白全刷。
+ *          仅用于 EPD_BWR 面板。
+ */
+void bsp_epd_display_bwr(const uint8_t *bw, const uint8_t *red);
+
 /**
  * @brief 清空屏幕
  * @param color 填充颜色 (0: 黑色, 1: 白色)
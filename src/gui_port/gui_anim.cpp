@@ -0,0 +1,157 @@
+/**
+ * @file gui_anim.cpp
+ * @brief 动画调速器实现
+ * @details
+ * 关键帧模式下原 path_cb 保存在 s_track 表中 (lv_anim_t 的 user_data 已被 SquareLine 占用)，
+ * 以 lv_anim_start 返回的动画指针为键。动画结束或被删除时 LVGL 释放该指针，
+ * 因此同时接管 deleted_cb：先调用原回调 (SquareLine 用它释放 user_data)，再清空表项，
+ * 否则 lv_mem 复用同一地址时会查到旧表项的路径函数与关键帧数。
+ * 被合并的帧数：每次推进时，原路径值与量化后路径值不同即计一帧。
+ */
+#include "gui_anim.h"
+#include "common/Log.h"
+
+/**
+ * @brief 关键帧模式下被改写的动画
+ */
+typedef struct {
+    lv_anim_t *anim;               ///< LVGL 内部的动画副本 (NULL: 空闲)
+    lv_anim_path_cb_t orig_path;   ///< 原路径函数
+    lv_anim_deleted_cb_t orig_deleted; ///< 原删除回调
+    uint8_t keyframes;
+} anim_track_t;
+
+static anim_track_t s_track[GUI_ANIM_TRACK_MAX];
+static uint8_t s_keyframes = GUI_ANIM_KEYFRAMES;
+
+// 统计
+static uint32_t s_started = 0;     ///< 经过调速器的动画
+static uint32_t s_jumped = 0;      ///< 直接跳到终值
+static uint32_t s_quantized = 0;   ///< 量化为关键帧
+static uint32_t s_capped = 0;      ///< 无限循环被截断
+static uint32_t s_collapsed = 0;   ///< 被合并掉的帧
+
+/**
+ * @brief 查找动画对应的表项
+ */
+static anim_track_t *_track_find(const lv_anim_t *a) {
+    for (uint8_t i = 0; i < GUI_ANIM_TRACK_MAX; i++) {
+        if (s_track[i].anim == a) return &s_track[i];
+    }
+    return NULL;
+}
+
+/**
+ * @brief 申请空闲表项 (表项在动画删除时释放)
+ * @details 表满时复用同一 var / exec_cb 的旧动画的表项 (lv_anim_start 会先删除旧动画)。
+ */
+static anim_track_t *_track_alloc(const lv_anim_t *a) {
+    anim_track_t *t = _track_find(NULL);
+    if (t == NULL && a->exec_cb != NULL) {
+        lv_anim_t *old = lv_anim_get(a->var, a->exec_cb);
+        if (old != NULL) t = _track_find(old);
+    }
+    return t;
+}
+
+/**
+ * @brief 动画结束或被删除：调用原删除回调并释放表项
+ */
+static void _anim_deleted(lv_anim_t *a) {
+    anim_track_t *t = _track_find(a);
+    if (t == NULL) return;
+    lv_anim_deleted_cb_t orig = t->orig_deleted;
+    t->anim = NULL;
+    t->orig_path = NULL;
+    t->orig_deleted = NULL;
+    if (orig) orig(a);
+}
+
+/**
+ * @brief 量化路径：把当前时间向下取整到最近的关键帧
+ */
+static int32_t _path_keyframe(const lv_anim_t *a) {
+    anim_track_t *t = _track_find(a);
+    if (t == NULL || t->orig_path == NULL) return a->end_value; // 表项已被回收，直接取终值
+
+    if (a->act_time >= a->time) return t->orig_path(a);
+
+    uint32_t step = (uint32_t)a->time / (t->keyframes - 1);
+    lv_anim_t q = *a;
+    q.act_time = step ? (int32_t)((a->act_time / step) * step) : 0;
+
+    int32_t v = t->orig_path(&q);
+    if (v != t->orig_path(a)) s_collapsed++;
+    return v;
+}
+
+/* ==================================================================
+ * 链接器 --wrap 挂钩
+ * ================================================================== */
+extern "C" {
+lv_anim_t *__real_lv_anim_start(const lv_anim_t *a);
+
+lv_anim_t *__wrap_lv_anim_start(const lv_anim_t *a) {
+#if GUI_ANIM_GOVERNOR
+    lv_anim_t g = *a;
+    s_started++;
+
+    if (g.repeat_cnt == LV_ANIM_REPEAT_INFINITE || g.repeat_cnt > GUI_ANIM_MAX_REPEAT) {
+        g.repeat_cnt = GUI_ANIM_MAX_REPEAT;
+        s_capped++;
+    }
+
+    anim_track_t *t = (s_keyframes >= 2 && g.time > 0) ? _track_alloc(&g) : NULL;
+    if (t == NULL) {
+        // 跳到终值：原本约 (时长 / 刷新周期) 帧，现在只剩 1 帧
+        uint32_t frames = ((uint32_t)g.time + g.playback_time) / LV_DISP_DEF_REFR_PERIOD;
+        s_collapsed += frames * g.repeat_cnt;
+
+        if (g.playback_time > 0) {
+            // 有回放时终态就是起始值
+            g.end_value = g.start_value;
+        }
+        g.time = 0;
+        g.playback_time = 0;
+        g.playback_delay = 0;
+        g.repeat_delay = 0;
+        g.repeat_cnt = 1;
+        s_jumped++;
+        return __real_lv_anim_start(&g);
+    }
+
+    lv_anim_path_cb_t orig = g.path_cb;
+    lv_anim_deleted_cb_t orig_deleted = g.deleted_cb;
+    g.path_cb = _path_keyframe;
+    g.deleted_cb = _anim_deleted;
+
+    // 启动时 LVGL 会先删除同一 var / exec_cb 的旧动画，其表项经 _anim_deleted 释放
+    lv_anim_t *started = __real_lv_anim_start(&g);
+    if (started != NULL) {
+        t->anim = started;
+        t->orig_path = orig;
+        t->orig_deleted = orig_deleted;
+        t->keyframes = s_keyframes;
+        s_quantized++;
+    }
+    return started;
+#else
+    return __real_lv_anim_start(a);
+#endif
+}
+}
+
+/**
+ * @brief 修改关键帧数
+ */
+void gui_anim_set_keyframes(uint8_t keyframes) {
+    s_keyframes = keyframes;
+}
+
+/**
+ * @brief 输出统计
+ */
+void gui_anim_report(void) {
+    LOG_RAW("  anim: started=%lu jumped=%lu quantized=%lu capped=%lu collapsed frames=%lu\n",
+            s_started, s_jumped, s_quantized, s_capped, s_collapsed);
+}
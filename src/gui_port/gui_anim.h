@@ -0,0 +1,59 @@
+/**
+ * @file gui_anim.h
+ * @brief 动画调速器 (把 LVGL 动画压缩为有限个关键帧)
+ * @details
+ * LVGL 动画按刷新周期 (约 30 ms) 逐帧推进，LCD 上是流畅的过渡，墨水屏上每一帧都是一次渲染、
+ * 甚至一次数秒的刷屏。本模块用链接器 --wrap 拦截 lv_anim_start，在动画启动时改写：
+ * - GUI_ANIM_KEYFRAMES <= 1: 直接跳到终值 (时长置 0，只执行一次)。
+ * - GUI_ANIM_KEYFRAMES >= 2: 替换 path_cb，把时间量化到 N 个关键帧 (如 3 = 起点、中点、终点)，
+ *   关键帧之间的值不变，LVGL 不会调用 exec_cb，也就不会产生失效区域。
+ * 无限循环的动画最多只播放 GUI_ANIM_MAX_REPEAT 次。
+ *
+ * @note 需要在 platformio.ini 的 build_flags 中加入 -Wl,--wrap=lv_anim_start。
+ *       LVGL 内部 (滚动、样式过渡、光标闪烁) 与 SquareLine (ui_helpers.c) 的动画都经过 lv_anim_start。
+ */
+#ifndef GUI_ANIM_H
+#define GUI_ANIM_H
+
+#include <lvgl.h>
+
+// 调速器开关
+#ifndef GUI_ANIM_GOVERNOR
+#define GUI_ANIM_GOVERNOR 1
+#endif
+
+// 默认关键帧数 (含起点和终点)，<= 1 表示直接跳到终值
+#ifndef GUI_ANIM_KEYFRAMES
+#define GUI_ANIM_KEYFRAMES 1
+#endif
+
+// 无限循环动画的最大播放次数
+#ifndef GUI_ANIM_MAX_REPEAT
+#define GUI_ANIM_MAX_REPEAT 1
+#endif
+
+// 同时量化的动画个数上限 (超出时改为直接跳到终值)
+#ifndef GUI_ANIM_TRACK_MAX
+#define GUI_ANIM_TRACK_MAX 16
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 修改关键帧数 (只影响之后启动的动画)
+ * @param keyframes 含起点和终点的关键帧数，<= 1 表示直接跳到终值
+ */
+void gui_anim_set_keyframes(uint8_t keyframes);
+
+/**
+ * @brief 输出统计：改写的动画个数、被合并掉的帧数
+ */
+void gui_anim_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_ANIM_H
@@ -0,0 +1,321 @@
+/**
+ * @file gui_asset.cpp
+ * @brief 压缩图片解码器与解码缓存实现
+ * @details
+ * 编码格式见 tools/img_rle.py：data[0] 为标志 (bit0 = 行异或)，随后是 MSB 在前的比特流，
+ * 按行优先顺序的像素游程颜色 0 / 1 交替，每个游程长度用 Elias-gamma 编码 (第一个游程编码 n + 1)。
+ *
+ * 缓存条目按图片源指针查找，最久未使用的条目先淘汰，直到总字节数不超过 GUI_ASSET_CACHE_BYTES。
+ * 单张图片超过预算时照常解码，只是不会在缓存中久留。
+ */
+#include "gui_asset.h"
+#include "common/Log.h"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+
+#define ASSET_FLAG_ROW_XOR 0x01
+
+/**
+ * @brief 解码缓存条目
+ */
+typedef struct {
+    const lv_img_dsc_t *src;
+    uint8_t *bits;
+    uint32_t size;
+    uint32_t stamp;      ///< 最近使用序号
+} cache_entry_t;
+
+static cache_entry_t s_cache[GUI_ASSET_CACHE_SLOTS];
+static uint32_t s_cache_bytes = 0;
+static uint32_t s_stamp = 0;
+
+// 统计
+static uint32_t s_hits = 0;
+static uint32_t s_misses = 0;
+static uint32_t s_decode_us = 0;
+static uint32_t s_decode_us_max = 0;
+static uint32_t s_lvgl_opens = 0;
+
+/**
+ * @brief 比特流读取
+ */
+typedef struct {
+    const uint8_t *data;
+    uint32_t size;
+    uint32_t pos;        ///< 比特位置
+} bit_reader_t;
+
+static inline int _bit(bit_reader_t *br) {
+    if ((br->pos >> 3) >= br->size) return -1;
+    int v = (br->data[br->pos >> 3] >> (7 - (br->pos & 7))) & 1;
+    br->pos++;
+    return v;
+}
+
+/**
+ * @brief 读一个 Elias-gamma 编码的整数
+ * @return 数值 (>= 1)，数据不完整返回 0
+ */
+static uint32_t _gamma(bit_reader_t *br) {
+    int k = 0, b;
+    while ((b = _bit(br)) == 0) {
+        if (++k > 24) return 0;
+    }
+    if (b < 0) return 0;
+    uint32_t v = 1;
+    while (k-- > 0) {
+        if ((b = _bit(br)) < 0) return 0;
+        v = (v << 1) | (uint32_t)b;
+    }
+    return v;
+}
+
+/**
+ * @brief 解码为 ALPHA_1BIT 位图
+ * @param out 输出缓冲区 (stride * h 字节)
+ * @return false 数据损坏
+ */
+static bool _decode(const lv_img_dsc_t *img, uint8_t *out) {
+    uint32_t w = img->header.w, h = img->header.h;
+    uint32_t stride = (w + 7) / 8;
+    if (img->data_size < 2) return false;
+    lv_memset_00(out, stride * h);
+
+    bit_reader_t br = { img->data, img->data_size, 8 };
+    uint32_t x = 0, y = 0, total = w * h, done = 0;
+    bool ink = false;
+    bool first = true;
+    while (done < total) {
+        uint32_t n = _gamma(&br);
+        if (n == 0) return false;
+        if (first) {
+            n--;
+            first = false;
+        }
+        if (n > total - done) return false;
+        done += n;
+
+        if (!ink) {
+            x += n;
+            y += x / w;
+            x %= w;
+        } else {
+            while (n > 0) {
+                uint32_t span = w - x < n ? w - x : n;
+                uint8_t *row = out + y * stride;
+                for (uint32_t i = x; i < x + span; i++) row[i >> 3] |= 0x80 >> (i & 7);
+                n -= span;
+                x += span;
+                if (x == w) {
+                    x = 0;
+                    y++;
+                }
+            }
+        }
+        ink = !ink;
+    }
+
+    if (img->data[0] & ASSET_FLAG_ROW_XOR) {
+        for (uint32_t r = 1; r < h; r++) {
+            uint8_t *row = out + r * stride;
+            const uint8_t *prev = row - stride;
+            for (uint32_t i = 0; i < stride; i++) row[i] ^= prev[i];
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 淘汰最久未使用的条目，直到能放下 need 字节
+ */
+static void _make_room(uint32_t need) {
+    while (s_cache_bytes + need > GUI_ASSET_CACHE_BYTES) {
+        cache_entry_t *victim = NULL;
+        for (int i = 0; i < GUI_ASSET_CACHE_SLOTS; i++) {
+            if (s_cache[i].src == NULL) continue;
+            if (victim == NULL || (int32_t)(s_cache[i].stamp - victim->stamp) < 0) victim = &s_cache[i];
+        }
+        if (victim == NULL) return;
+        heap_caps_free(victim->bits);
+        s_cache_bytes -= victim->size;
+        *victim = {};
+    }
+}
+
+/**
+ * @brief 图片是否为本模块的压缩格式
+ */
+bool gui_asset_is_encoded(const void *src) {
+    if (src == NULL || lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) return false;
+    const lv_img_dsc_t *img = (const lv_img_dsc_t *)src;
+    return img->header.cf == LV_IMG_CF_USER_ENCODED_0 && img->data != NULL && img->data_size >= 2;
+}
+
+/**
+ * @brief 取解码后的 1bit 位图
+ */
+const uint8_t *gui_asset_get_1bit(const lv_img_dsc_t *img) {
+    if (!gui_asset_is_encoded(img)) return NULL;
+
+    cache_entry_t *slot = NULL;
+    for (int i = 0; i < GUI_ASSET_CACHE_SLOTS; i++) {
+        if (s_cache[i].src == img) {
+            s_cache[i].stamp = ++s_stamp;
+            s_hits++;
+            return s_cache[i].bits;
+        }
+    }
+
+    uint32_t size = (uint32_t)(img->header.w + 7) / 8 * img->header.h;
+    _make_room(size);
+    for (int i = 0; i < GUI_ASSET_CACHE_SLOTS && slot == NULL; i++) {
+        if (s_cache[i].src == NULL) slot = &s_cache[i];
+    }
+    if (slot == NULL) {
+        // 条目已满 (字节预算未满)，淘汰最旧的一条
+        slot = &s_cache[0];
+        for (int i = 1; i < GUI_ASSET_CACHE_SLOTS; i++) {
+            if ((int32_t)(s_cache[i].stamp - slot->stamp) < 0) slot = &s_cache[i];
+        }
+        heap_caps_free(slot->bits);
+        s_cache_bytes -= slot->size;
+        *slot = {};
+    }
+
+    uint8_t *bits = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (bits == NULL) {
+        LOG_E("[Asset] Cache alloc failed (%lu B)", size);
+        return NULL;
+    }
+
+    uint32_t t0 = micros();
+    bool ok = _decode(img, bits);
+    uint32_t us = micros() - t0;
+    if (!ok) {
+        LOG_E("[Asset] Corrupt image %p (%ux%u)", img, img->header.w, img->header.h);
+        heap_caps_free(bits);
+        return NULL;
+    }
+
+    s_misses++;
+    s_decode_us += us;
+    if (us > s_decode_us_max) s_decode_us_max = us;
+    LOG_D("[Asset] Decode %p %ux%u: %lu -> %lu B, %lu us", img, img->header.w, img->header.h,
+          img->data_size, size, us);
+
+    slot->src = img;
+    slot->bits = bits;
+    slot->size = size;
+    slot->stamp = ++s_stamp;
+    s_cache_bytes += size;
+    return bits;
+}
+
+/* --- LVGL 图片解码器 --- */
+
+/**
+ * @brief 解码器 info 回调：压缩图片按 TRUE_COLOR_ALPHA 交给 LVGL
+ */
+static lv_res_t _dec_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header) {
+    LV_UNUSED(decoder);
+    if (!gui_asset_is_encoded(src)) return LV_RES_INV;
+    const lv_img_dsc_t *img = (const lv_img_dsc_t *)src;
+    header->always_zero = 0;
+    header->w = img->header.w;
+    header->h = img->header.h;
+    header->cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    return LV_RES_OK;
+}
+
+/**
+ * @brief 解码器 open 回调：1bit 位图展开为 TRUE_COLOR_ALPHA (颜色取 dsc->color，即 recolor)
+ */
+static lv_res_t _dec_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+    LV_UNUSED(decoder);
+    const lv_img_dsc_t *img = (const lv_img_dsc_t *)dsc->src;
+    const uint8_t *bits = gui_asset_get_1bit(img);
+    if (bits == NULL) return LV_RES_INV;
+
+    uint32_t w = img->header.w, h = img->header.h, stride = (w + 7) / 8;
+    uint8_t *out = (uint8_t *)heap_caps_malloc(w * h * LV_IMG_PX_SIZE_ALPHA_BYTE, MALLOC_CAP_SPIRAM);
+    if (out == NULL) return LV_RES_INV;
+
+    uint8_t *p = out;
+    for (uint32_t y = 0; y < h; y++) {
+        const uint8_t *row = bits + y * stride;
+        for (uint32_t x = 0; x < w; x++, p += LV_IMG_PX_SIZE_ALPHA_BYTE) {
+            lv_memcpy_small(p, &dsc->color, sizeof(lv_color_t));
+            p[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = (row[x >> 3] & (0x80 >> (x & 7))) ? LV_OPA_COVER : LV_OPA_TRANSP;
+        }
+    }
+    dsc->img_data = out;
+    dsc->user_data = out;
+    s_lvgl_opens++;
+    return LV_RES_OK;
+}
+
+/**
+ * @brief 解码器 close 回调
+ */
+static void _dec_close(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+    LV_UNUSED(decoder);
+    heap_caps_free(dsc->user_data);
+    dsc->user_data = NULL;
+    dsc->img_data = NULL;
+}
+
+/**
+ * @brief 注册图片解码器
+ */
+void gui_asset_init(void) {
+    lv_img_decoder_t *dec = lv_img_decoder_create();
+    if (dec == NULL) {
+        LOG_E("[Asset] Decoder register failed");
+        return;
+    }
+    lv_img_decoder_set_info_cb(dec, _dec_info);
+    lv_img_decoder_set_open_cb(dec, _dec_open);
+    lv_img_decoder_set_close_cb(dec, _dec_close);
+}
+
+/**
+ * @brief 解码基准测试
+ */
+void gui_asset_bench(const lv_img_dsc_t *const *imgs, uint16_t cnt) {
+    const int rounds = 20;
+    uint32_t total_raw = 0, total_enc = 0;
+
+    for (uint16_t i = 0; i < cnt; i++) {
+        const lv_img_dsc_t *img = imgs[i];
+        if (!gui_asset_is_encoded(img)) continue;
+
+        uint32_t size = (uint32_t)(img->header.w + 7) / 8 * img->header.h;
+        uint8_t *bits = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+        if (bits == NULL) return;
+
+        bool ok = true;
+        uint32_t t0 = micros();
+        for (int r = 0; r < rounds; r++) ok &= _decode(img, bits);
+        uint32_t us = (micros() - t0) / rounds;
+        heap_caps_free(bits);
+
+        total_raw += size;
+        total_enc += img->data_size;
+        LOG_I("[Asset] Bench %p %ux%u: %lu -> %lu B (%lu%%), decode %lu us%s", img, img->header.w,
+              img->header.h, size, img->data_size, img->data_size * 100 / size, us, ok ? "" : " (CORRUPT)");
+    }
+    if (total_raw) {
+        LOG_I("[Asset] Bench total: %lu B compressed vs %lu B 1-bit (%lu%%)",
+              total_enc, total_raw, total_enc * 100 / total_raw);
+    }
+}
+
+/**
+ * @brief 输出解码缓存统计
+ */
+void gui_asset_report(void) {
+    uint32_t total = s_hits + s_misses;
+    LOG_I("[Asset] hits=%lu misses=%lu hit rate=%lu%% decode avg=%lu us max=%lu us cache=%lu B lvgl opens=%lu",
+          s_hits, s_misses, total ? s_hits * 100 / total : 0,
+          s_misses ? s_decode_us / s_misses : 0, s_decode_us_max, s_cache_bytes, s_lvgl_opens);
+}
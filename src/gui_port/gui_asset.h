@@ -0,0 +1,73 @@
+/**
+ * @file gui_asset.h
+ * @brief 压缩图片资源 (LV_IMG_CF_USER_ENCODED_0) 的解码器与解码缓存
+ * @details tools/img_rle.py 把 1bit 图片按像素游程压缩 (Elias-gamma 编码，可选行异或)，
+ *          图标的 flash 占用约为未压缩 1bit 的三分之一。本模块：
+ *          - 解码结果 (ALPHA_1BIT) 放在 PSRAM 中的小型 LRU 缓存里，按字节预算淘汰；
+ *          - gui_img 的快速路径直接取缓存中的 1bit 位图绘制；
+ *          - 注册一个 LVGL 图片解码器，其余情况 (缩放、旋转、遮罩等) 由 LVGL 经解码器绘制，
+ *            解码器把 1bit 位图展开为 TRUE_COLOR_ALPHA (与 LVGL 处理 ALPHA_1BIT 的方式相同)。
+ */
+#ifndef GUI_ASSET_H
+#define GUI_ASSET_H
+
+#include <lvgl.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// 解码缓存字节预算 (PSRAM，一个 64x64 图标解码后 512 B)
+#ifndef GUI_ASSET_CACHE_BYTES
+#define GUI_ASSET_CACHE_BYTES 16384
+#endif
+
+// 解码缓存条目数
+#ifndef GUI_ASSET_CACHE_SLOTS
+#define GUI_ASSET_CACHE_SLOTS 16
+#endif
+
+// 启动时对 ui_img_* 做一次解码基准测试 (解码耗时与压缩率)
+#ifndef GUI_ASSET_BENCH
+#define GUI_ASSET_BENCH 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 注册图片解码器 (lv_init 之后、第一次绘制之前调用一次)
+ */
+void gui_asset_init(void);
+
+/**
+ * @brief 图片是否为本模块的压缩格式
+ * @param src lv_img 图片源
+ */
+bool gui_asset_is_encoded(const void *src);
+
+/**
+ * @brief 取压缩图片解码后的 1bit 位图 (LV_IMG_CF_ALPHA_1BIT 布局，每行按字节对齐)
+ * @param img 压缩图片
+ * @return 位图，解码失败返回 NULL
+ * @note 位图属于缓存，只在下一次调用本模块之前有效 (GUI 线程内立即使用)。
+ */
+const uint8_t *gui_asset_get_1bit(const lv_img_dsc_t *img);
+
+/**
+ * @brief 解码基准测试
+ * @param imgs 压缩图片列表
+ * @param cnt  图片数
+ * @details 每张图片绕过缓存解码若干次，输出平均解码耗时、压缩前后大小。
+ */
+void gui_asset_bench(const lv_img_dsc_t *const *imgs, uint16_t cnt);
+
+/**
+ * @brief 输出解码缓存统计 (命中率、解码耗时、缓存占用)
+ */
+void gui_asset_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_ASSET_H
@@ -0,0 +1,154 @@
+/**
+ * @file gui_atlas.cpp
+ * @brief 1bit 图标集实现
+ * @details
+ * - 直接写：不透明、普通混合、当前没有绘制遮罩时，子矩形中置位的像素直接写入渲染缓冲区 (与 gui_img 相同)。
+ * - 遮罩混合：其余情况 (半透明、圆角裁剪等) 逐行把位图展开为 0 / 255 遮罩，
+ *   经 lv_draw_mask_apply 叠加绘制遮罩后交给 lv_draw_sw_blend，效果与 LVGL 绘制 ALPHA_1BIT 图片相同。
+ * - gui_atlas_attach 的图标信息放在 lv_mem 中，作为事件回调的 user_data，LV_EVENT_DELETE 时释放。
+ */
+#include "gui_atlas.h"
+#include "common/Log.h"
+#include <Arduino.h>
+
+/**
+ * @brief 挂在控件上的图标
+ */
+typedef struct {
+    const gui_atlas_t *atlas;
+    uint16_t id;
+} atlas_icon_t;
+
+// 统计
+static uint32_t s_direct_draws = 0;
+static uint32_t s_direct_us = 0;
+static uint32_t s_blend_draws = 0;
+static uint32_t s_blend_us = 0;
+
+static inline bool _bit(const gui_atlas_t *atlas, uint32_t x, uint32_t y) {
+    return atlas->bitmap[y * atlas->stride + (x >> 3)] & (0x80 >> (x & 7));
+}
+
+/**
+ * @brief 绘制一个图标
+ */
+void gui_atlas_draw(lv_draw_ctx_t *draw_ctx, const gui_atlas_t *atlas, uint16_t id,
+                    lv_coord_t x, lv_coord_t y, lv_color_t color, lv_opa_t opa) {
+    if (atlas == NULL || id >= atlas->count || opa <= LV_OPA_MIN) return;
+    const gui_atlas_sprite_t *s = &atlas->sprites[id];
+
+    lv_area_t area;
+    area.x1 = x + s->ofs_x;
+    area.y1 = y + s->ofs_y;
+    area.x2 = area.x1 + s->w - 1;
+    area.y2 = area.y1 + s->h - 1;
+
+    lv_area_t clip;
+    if (!_lv_area_intersect(&clip, draw_ctx->clip_area, &area)) return;
+
+    uint32_t t0 = micros();
+    if (opa >= LV_OPA_MAX && !lv_draw_mask_is_any(&clip)) {
+        lv_color_t *buf = (lv_color_t *)draw_ctx->buf;
+        const lv_area_t *buf_area = draw_ctx->buf_area;
+        lv_coord_t buf_w = lv_area_get_width(buf_area);
+
+        for (lv_coord_t py = clip.y1; py <= clip.y2; py++) {
+            uint32_t sy = s->y + (py - area.y1);
+            uint32_t sx = s->x + (clip.x1 - area.x1);
+            lv_color_t *dst = buf + (py - buf_area->y1) * buf_w + (clip.x1 - buf_area->x1);
+            for (lv_coord_t px = clip.x1; px <= clip.x2; px++, sx++, dst++) {
+                if (_bit(atlas, sx, sy)) *dst = color;
+            }
+        }
+        s_direct_us += micros() - t0;
+        s_direct_draws++;
+        return;
+    }
+
+    // 逐行生成遮罩后交给 LVGL 混合 (子矩形宽度不超过 255)
+    static lv_opa_t mask[256];
+    lv_coord_t len = lv_area_get_width(&clip);
+
+    lv_area_t row;
+    lv_draw_sw_blend_dsc_t blend;
+    lv_memset_00(&blend, sizeof(blend));
+    blend.blend_area = &row;
+    blend.mask_area = &row;
+    blend.mask_buf = mask;
+    blend.color = color;
+    blend.opa = opa;
+    blend.blend_mode = LV_BLEND_MODE_NORMAL;
+
+    for (lv_coord_t py = clip.y1; py <= clip.y2; py++) {
+        uint32_t sy = s->y + (py - area.y1);
+        uint32_t sx = s->x + (clip.x1 - area.x1);
+        for (lv_coord_t i = 0; i < len; i++, sx++) mask[i] = _bit(atlas, sx, sy) ? LV_OPA_COVER : LV_OPA_TRANSP;
+
+        blend.mask_res = lv_draw_mask_apply(mask, clip.x1, py, len);
+        if (blend.mask_res == LV_DRAW_MASK_RES_TRANSP) continue;
+        blend.mask_res = LV_DRAW_MASK_RES_CHANGED;
+        row.x1 = clip.x1;
+        row.x2 = clip.x2;
+        row.y1 = row.y2 = py;
+        lv_draw_sw_blend(draw_ctx, &blend);
+    }
+    s_blend_us += micros() - t0;
+    s_blend_draws++;
+}
+
+/**
+ * @brief 控件绘制回调：背景之后、子控件之前，在内容区居中绘制图标
+ */
+static void _icon_event_cb(lv_event_t *e) {
+    atlas_icon_t *icon = (atlas_icon_t *)lv_event_get_user_data(e);
+    lv_event_code_t code = lv_event_get_code(e);
+
+    if (code == LV_EVENT_DELETE) {
+        lv_mem_free(icon);
+        return;
+    }
+    if (code != LV_EVENT_DRAW_MAIN) return;
+
+    lv_obj_t *obj = lv_event_get_target(e);
+    const gui_atlas_sprite_t *s = &icon->atlas->sprites[icon->id];
+    lv_area_t content;
+    lv_obj_get_content_coords(obj, &content);
+    lv_coord_t x = content.x1 + (lv_area_get_width(&content) - s->full_w) / 2;
+    lv_coord_t y = content.y1 + (lv_area_get_height(&content) - s->full_h) / 2;
+
+    gui_atlas_draw(lv_event_get_draw_ctx(e), icon->atlas, icon->id, x, y,
+                   lv_obj_get_style_bg_img_recolor_filtered(obj, LV_PART_MAIN),
+                   lv_obj_get_style_bg_img_opa(obj, LV_PART_MAIN));
+}
+
+/**
+ * @brief 让控件用图标集中的图标代替背景图片
+ */
+void gui_atlas_attach(lv_obj_t *obj, const gui_atlas_t *atlas, uint16_t id) {
+    if (obj == NULL || atlas == NULL || id >= atlas->count) return;
+
+    atlas_icon_t *icon = (atlas_icon_t *)lv_obj_get_event_user_data(obj, _icon_event_cb);
+    if (icon == NULL) {
+        icon = (atlas_icon_t *)lv_mem_alloc(sizeof(atlas_icon_t));
+        if (icon == NULL) {
+            LOG_E("[Atlas] Attach failed: out of lv_mem");
+            return;
+        }
+        lv_obj_add_event_cb(obj, _icon_event_cb, LV_EVENT_ALL, icon);
+    }
+    icon->atlas = atlas;
+    icon->id = id;
+
+    // 本地值优先于共享样式：页面已经过样式去重 (bg_img_src 移入共享样式) 时同样生效
+    lv_obj_set_style_bg_img_src(obj, NULL, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_invalidate(obj);
+}
+
+/**
+ * @brief 输出图标绘制统计
+ */
+void gui_atlas_report(void) {
+    LOG_I("[Atlas] direct draws=%lu avg=%lu us, blended draws=%lu avg=%lu us",
+          s_direct_draws, s_direct_draws ? s_direct_us / s_direct_draws : 0,
+          s_blend_draws, s_blend_draws ? s_blend_us / s_blend_draws : 0);
+}
@@ -0,0 +1,76 @@
+/**
+ * @file gui_atlas.h
+ * @brief 1bit 图标集 (sprite atlas)
+ * @details 全部图标由 tools/img_atlas.py 裁掉透明边框后排进一张 1bit 位图 (src/ui/ui_img_atlas.c)，
+ *          每个图标是其中的一个子矩形。绘制时按子矩形直接写入渲染缓冲区，
+ *          不经过 LVGL 的图片解码器和图片缓存，也不需要每个图标一个 lv_img_dsc_t。
+ */
+#ifndef GUI_ATLAS_H
+#define GUI_ATLAS_H
+
+#include <lvgl.h>
+#include <stdint.h>
+
+/**
+ * @brief 图标集中的一个图标
+ */
+typedef struct {
+    uint16_t x;         ///< 子矩形在图集中的位置 (像素)
+    uint16_t y;
+    uint8_t w;          ///< 子矩形尺寸 (裁掉透明边框后)
+    uint8_t h;
+    uint8_t ofs_x;      ///< 子矩形相对原图标左上角的偏移
+    uint8_t ofs_y;
+    uint8_t full_w;     ///< 原图标尺寸 (布局与居中按原尺寸计算)
+    uint8_t full_h;
+} gui_atlas_sprite_t;
+
+/**
+ * @brief 图标集 (1bit，每行 stride 字节，MSB 在前，1 = 着墨)
+ */
+typedef struct {
+    const uint8_t *bitmap;
+    uint16_t w;
+    uint16_t h;
+    uint16_t stride;
+    uint16_t count;
+    const gui_atlas_sprite_t *sprites;
+} gui_atlas_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 绘制一个图标
+ * @param draw_ctx 绘制上下文 (lv_event_get_draw_ctx)
+ * @param atlas    图标集
+ * @param id       图标序号
+ * @param x, y     原图标左上角的绝对坐标
+ * @param color    着墨颜色
+ * @param opa      不透明度
+ * @details 不透明且没有绘制遮罩时按位直接写缓冲区，否则逐行生成遮罩后交给 LVGL 混合。
+ */
+void gui_atlas_draw(lv_draw_ctx_t *draw_ctx, const gui_atlas_t *atlas, uint16_t id,
+                    lv_coord_t x, lv_coord_t y, lv_color_t color, lv_opa_t opa);
+
+/**
+ * @brief 让控件用图标集中的图标代替背景图片 (居中绘制在内容区)
+ * @param obj   控件 (如 SquareLine 中以 bg_img_src 显示图标的按钮)
+ * @param atlas 图标集
+ * @param id    图标序号
+ * @details 把控件的 bg_img_src 置空 (本地样式，覆盖共享样式中的值)，颜色取 bg_img_recolor / bg_img_opa 样式。
+ *          重复调用只更新图标。宜在页面构建函数中、样式去重之前调用，页面重建后自动生效。
+ */
+void gui_atlas_attach(lv_obj_t *obj, const gui_atlas_t *atlas, uint16_t id);
+
+/**
+ * @brief 输出图标绘制统计 (直接写 / 遮罩混合的次数与平均耗时)
+ */
+void gui_atlas_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_ATLAS_H
@@ -0,0 +1,171 @@
+/**
+ * @file gui_audit.cpp
+ * @brief 墨水屏控件审计实现
+ * @details
+ * 过渡与焦点轮廓来自默认主题，按状态挂在控件上 (如 PRESSED 时的 transition_normal)，
+ * 用本地样式逐个覆盖会给每个控件多分配一份样式。这里改为挂载两份静态共享样式：
+ * - s_style_still:      transition = NULL, anim_time = 0 (DEFAULT / PRESSED)
+ * - s_style_no_outline: outline_width = 0, outline_opa = 0 (FOCUSED / FOCUS_KEY)
+ * 共享样式后添加，在同一状态下优先级高于主题样式。
+ */
+#include "gui_audit.h"
+#include "gui_port.h"
+#include "common/Log.h"
+#include <Arduino.h>
+
+static lv_style_t s_style_still;
+static lv_style_t s_style_no_outline;
+static bool s_styles_ready = false;
+
+/**
+ * @brief 审计统计
+ */
+typedef struct {
+    uint16_t objs;       ///< 控件数
+    uint16_t cursors;    ///< 关闭的光标闪烁
+    uint16_t switches;   ///< 关闭的开关动画
+    uint16_t scrolls;    ///< 关闭滚动条/惯性的控件
+    uint16_t residual;   ///< 审计后仍有动画的控件
+} audit_stats_t;
+
+/**
+ * @brief 初始化共享样式
+ */
+static void _styles_init(void) {
+    if (s_styles_ready) return;
+
+    lv_style_init(&s_style_still);
+    lv_style_set_transition(&s_style_still, NULL);
+    lv_style_set_anim_time(&s_style_still, 0);
+
+    lv_style_init(&s_style_no_outline);
+    lv_style_set_outline_width(&s_style_no_outline, 0);
+    lv_style_set_outline_opa(&s_style_no_outline, LV_OPA_TRANSP);
+
+    s_styles_ready = true;
+}
+
+/**
+ * @brief 控件类型名
+ */
+const char *gui_audit_class_name(const lv_obj_t *obj) {
+    const lv_obj_class_t *cls = lv_obj_get_class(obj);
+    if (cls == &lv_textarea_class) return "textarea";
+    if (cls == &lv_label_class) return "label";
+    if (cls == &lv_btn_class) return "btn";
+    if (cls == &lv_img_class) return "img";
+    if (cls == &lv_switch_class) return "switch";
+    if (cls == &lv_chart_class) return "chart";
+    if (cls == &lv_bar_class) return "bar";
+    if (cls == &lv_arc_class) return "arc";
+#if LV_USE_CALENDAR
+    if (cls == &lv_calendar_class) return "calendar";
+#endif
+#if LV_USE_SPINNER
+    if (cls == &lv_spinner_class) return "spinner";
+#endif
+    return "obj";
+}
+
+/**
+ * @brief 审计单个控件 (递归子控件)
+ */
+static void _audit_obj(lv_obj_t *obj, audit_stats_t *st) {
+    st->objs++;
+
+    // 1. textarea 光标: 闪烁动画每 anim_time 毫秒失效一次光标区域，即使光标不可见
+    if (lv_obj_check_type(obj, &lv_textarea_class)) {
+        lv_obj_set_style_anim_time(obj, 0, LV_PART_CURSOR);
+        lv_obj_set_style_opa(obj, LV_OPA_TRANSP, LV_PART_CURSOR);
+        lv_anim_del(obj, NULL);
+        st->cursors++;
+    }
+
+    // 2. switch: 切换时旋钮滑动动画
+    if (lv_obj_check_type(obj, &lv_switch_class) && lv_obj_get_style_anim_time(obj, LV_PART_MAIN) != 0) {
+        lv_obj_set_style_anim_time(obj, 0, LV_PART_MAIN);
+        st->switches++;
+    }
+
+    // 3. 滚动: 滚动条出现/淡出、惯性和回弹都会连续产生多帧
+    if (lv_obj_has_flag(obj, LV_OBJ_FLAG_SCROLLABLE)) {
+        lv_obj_set_scrollbar_mode(obj, LV_SCROLLBAR_MODE_OFF);
+        lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLL_MOMENTUM | LV_OBJ_FLAG_SCROLL_ELASTIC);
+        st->scrolls++;
+    }
+
+    // 4. 主题过渡 / 焦点轮廓 (只处理可交互控件)
+    if (lv_obj_has_flag(obj, LV_OBJ_FLAG_CLICKABLE)) {
+        lv_obj_add_style(obj, &s_style_still, LV_PART_MAIN | LV_STATE_DEFAULT);
+        lv_obj_add_style(obj, &s_style_still, LV_PART_MAIN | LV_STATE_PRESSED);
+        lv_obj_add_style(obj, &s_style_no_outline, LV_PART_MAIN | LV_STATE_FOCUSED);
+        lv_obj_add_style(obj, &s_style_no_outline, LV_PART_MAIN | LV_STATE_FOCUS_KEY);
+    }
+
+    // 5. 残留: 仍挂有动画的控件会持续失效重绘
+    if (lv_anim_get(obj, NULL) != NULL) {
+        LOG_I("[Audit]   still animating: %s %p", gui_audit_class_name(obj), (void *)obj);
+        st->residual++;
+    }
+
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < child_cnt; i++) {
+        _audit_obj(lv_obj_get_child(obj, i), st);
+    }
+}
+
+/**
+ * @brief 审计页面
+ */
+void gui_audit_screen(lv_obj_t *scr, const char *tag) {
+#if GUI_AUDIT_ENABLE
+    if (scr == NULL) return;
+    _styles_init();
+
+    audit_stats_t st = {};
+    uint32_t t0 = millis();
+    _audit_obj(scr, &st);
+
+    LOG_I("[Audit] %s: %u obj, cursor %u, switch %u, scroll %u, residual anim %u (%lu ms)",
+          tag ? tag : "screen", st.objs, st.cursors, st.switches, st.scrolls, st.residual, millis() - t0);
+#else
+    LV_UNUSED(scr);
+    LV_UNUSED(tag);
+#endif
+}
+
+/**
+ * @brief 空闲刷新统计定时器回调
+ */
+static void _idle_timer_cb(lv_timer_t *timer) {
+    LV_UNUSED(timer);
+    static uint32_t last_renders = 0;
+    static uint32_t last_refreshes = 0;
+
+    uint32_t renders = gui_port_render_count();
+    uint32_t refreshes = gui_port_refresh_count();
+    bool idle = lv_disp_get_inactive_time(NULL) >= GUI_AUDIT_IDLE_PERIOD_MS;
+
+    LOG_I("[Audit] Last %lu s%s: %lu renders, %lu EPD refreshes, %lu anims running",
+          (unsigned long)(GUI_AUDIT_IDLE_PERIOD_MS / 1000), idle ? " (idle)" : "",
+          renders - last_renders, refreshes - last_refreshes, (unsigned long)lv_anim_count_running());
+
+    // 空闲时仍在渲染：列出定时器，便于定位源头
+    if (idle && renders != last_renders) {
+        lv_timer_t *t = lv_timer_get_next(NULL);
+        while (t != NULL) {
+            LOG_I("[Audit]   timer %p period %lu ms cb %p", (void *)t, (unsigned long)t->period, (void *)t->timer_cb);
+            t = lv_timer_get_next(t);
+        }
+    }
+
+    last_renders = renders;
+    last_refreshes = refreshes;
+}
+
+/**
+ * @brief 启动空闲刷新统计
+ */
+void gui_audit_start(void) {
+    lv_timer_create(_idle_timer_cb, GUI_AUDIT_IDLE_PERIOD_MS, NULL);
+}
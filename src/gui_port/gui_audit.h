@@ -0,0 +1,57 @@
+/**
+ * @file gui_audit.h
+ * @brief 墨水屏控件审计
+ * @details LVGL 的光标闪烁、开关动画、滚动条淡出、样式过渡、焦点轮廓等效果在 LCD 上无害，
+ *          在墨水屏上每一帧都意味着一次渲染，甚至一次刷屏。
+ *          本模块在页面构建后关闭这些效果，并输出仍会周期性重绘的控件。
+ */
+#ifndef GUI_AUDIT_H
+#define GUI_AUDIT_H
+
+#include <lvgl.h>
+
+// 审计总开关 (0: 关闭，仅用于对比 "审计前" 的空闲刷新次数)
+#ifndef GUI_AUDIT_ENABLE
+#define GUI_AUDIT_ENABLE 1
+#endif
+
+// 空闲刷新统计周期 (ms)
+#ifndef GUI_AUDIT_IDLE_PERIOD_MS
+#define GUI_AUDIT_IDLE_PERIOD_MS 60000
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 审计页面 (须在 screen_init 之后、页面显示之前调用)
+ * @param scr 页面
+ * @param tag 日志标签 (页面名称，可为 NULL)
+ * @details
+ * - textarea: 光标闪烁时间置 0 并删除闪烁动画，光标透明。
+ * - switch:   切换动画时间置 0。
+ * - 可滚动控件: 关闭滚动条、惯性滚动和弹性回弹。
+ * - 所有控件: 屏蔽默认主题的样式过渡 (DEFAULT / PRESSED) 与焦点轮廓 (FOCUSED / FOCUS_KEY)。
+ * 处理完成后，仍挂有动画的控件逐个输出日志。
+ */
+void gui_audit_screen(lv_obj_t *scr, const char *tag);
+
+/**
+ * @brief 控件类型名 (用于日志)
+ * @return 常量字符串，未知类型返回 "obj"
+ */
+const char *gui_audit_class_name(const lv_obj_t *obj);
+
+/**
+ * @brief 启动空闲刷新统计
+ * @details 每 GUI_AUDIT_IDLE_PERIOD_MS 输出一次渲染次数与刷屏次数；
+ *          整个周期内无用户操作时标记为 "idle"，并列出当前全部 LVGL 定时器。
+ */
+void gui_audit_start(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_AUDIT_H
@@ -0,0 +1,237 @@
+#include "gui_bind.h"
+#include "common/Log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @file gui_bind.cpp
+ * @brief 数据绑定实现
+ */
+
+// 初始化静态成员变量
+BindCell* BindCell::allHead = nullptr;
+BindCell* BindCell::dirtyHead = nullptr;
+lv_timer_t* BindCell::flushTimer = nullptr;
+uint32_t BindCell::applied = 0;
+uint32_t BindCell::suppressed = 0;
+uint32_t BindCell::coalesced = 0;
+
+BindCell::BindCell() {}
+
+BindCell::~BindCell() {
+    unbind();
+}
+
+/**
+ * @brief 绑定控件
+ */
+void BindCell::bind(lv_obj_t** widget_, lv_obj_t** screen_, BindKind kind_, const char* fmt_) {
+    unbind();
+
+    widget = widget_;
+    screen = screen_;
+    kind = kind_;
+    fmt = fmt_;
+    synced = false;
+
+    nextAll = allHead;
+    allHead = this;
+}
+
+/**
+ * @brief 解除绑定 (从全部链表中摘除)
+ */
+void BindCell::unbind() {
+    for (BindCell** p = &allHead; *p; p = &(*p)->nextAll) {
+        if (*p == this) {
+            *p = nextAll;
+            break;
+        }
+    }
+    if (dirty) {
+        for (BindCell** p = &dirtyHead; *p; p = &(*p)->nextDirty) {
+            if (*p == this) {
+                *p = nextDirty;
+                break;
+            }
+        }
+    }
+    nextAll = nullptr;
+    nextDirty = nullptr;
+    dirty = false;
+    widget = nullptr;
+    screen = nullptr;
+}
+
+/**
+ * @brief 登记到下一帧写入
+ */
+void BindCell::markDirty() {
+    synced = false;
+    hasValue = true;
+    if (widget == nullptr) return;
+
+    if (dirty) {
+        coalesced++;
+        return;
+    }
+    dirty = true;
+    nextDirty = dirtyHead;
+    dirtyHead = this;
+
+    // 周期为 0 的定时器在下一次 lv_timer_handler 中执行，执行后暂停
+    if (flushTimer == nullptr) {
+        flushTimer = lv_timer_create(flushTimerCb, 0, nullptr);
+    }
+    lv_timer_resume(flushTimer);
+}
+
+/**
+ * @brief 写入控件
+ * @return true 控件内容发生变化
+ */
+bool BindCell::apply() {
+    // 页面未构建 (或已被淘汰)：等页面重建时由 onScreenBuilt 重新登记
+    if (screen != nullptr && *screen == nullptr) return false;
+    lv_obj_t* obj = *widget;
+    if (obj == nullptr) return false;
+
+    synced = true;
+
+    switch (kind) {
+        case BindKind::Label:
+        case BindKind::TextArea: {
+            char buf[BIND_TEXT_MAX];
+            format(buf, sizeof(buf));
+            const char* cur = (kind == BindKind::Label) ? lv_label_get_text(obj) : lv_textarea_get_text(obj);
+            if (cur != nullptr && strcmp(cur, buf) == 0) return false;
+            if (kind == BindKind::Label) lv_label_set_text(obj, buf);
+            else lv_textarea_set_text(obj, buf);
+            return true;
+        }
+        case BindKind::Bar: {
+            int32_t v = number();
+            if (lv_bar_get_value(obj) == v) return false;
+            lv_bar_set_value(obj, v, LV_ANIM_OFF);
+            return true;
+        }
+        case BindKind::Arc: {
+            int32_t v = number();
+            if (lv_arc_get_value(obj) == v) return false;
+            lv_arc_set_value(obj, (int16_t)v);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief 写入全部待更新的单元
+ */
+void BindCell::flush() {
+    uint16_t changed = 0;
+    uint16_t same = 0;
+
+    while (dirtyHead != nullptr) {
+        BindCell* c = dirtyHead;
+        dirtyHead = c->nextDirty;
+        c->nextDirty = nullptr;
+        c->dirty = false;
+
+        if (c->apply()) changed++;
+        else if (c->synced) same++;
+    }
+
+    applied += changed;
+    suppressed += same;
+    if (changed || same) LOG_D("[Bind] Flush: %u applied, %u unchanged", changed, same);
+}
+
+void BindCell::flushTimerCb(lv_timer_t* timer) {
+    flush();
+    lv_timer_pause(timer);
+}
+
+/**
+ * @brief 页面构建通知
+ */
+void BindCell::onScreenBuilt(lv_obj_t** scr) {
+    for (BindCell* c = allHead; c; c = c->nextAll) {
+        if (c->screen == scr && c->hasValue) c->markDirty();
+    }
+}
+
+/**
+ * @brief 输出统计
+ */
+void BindCell::dumpStats() {
+    LOG_RAW("  bind: applied=%lu suppressed=%lu coalesced=%lu\n", applied, suppressed, coalesced);
+}
+
+/* ==================================================================
+ * 具体值单元
+ * ================================================================== */
+
+void IntCell::set(int32_t v) {
+    // 已写入控件且值未变：连脏标记都不需要
+    if (v == value && isSynced()) {
+        suppressedInc();
+        return;
+    }
+    value = v;
+    markDirty();
+}
+
+void IntCell::format(char* buf, size_t len) const {
+    snprintf(buf, len, fmt ? fmt : "%d", (int)value);
+}
+
+void FixedCell::set(int32_t r) {
+    if (r == raw && isSynced()) {
+        suppressedInc();
+        return;
+    }
+    raw = r;
+    markDirty();
+}
+
+void FixedCell::format(char* buf, size_t len) const {
+    int32_t scale = 1;
+    for (uint8_t i = 0; i < frac; i++) scale *= 10;
+
+    char num[16];
+    int32_t a = raw < 0 ? -raw : raw;
+    if (frac == 0) {
+        snprintf(num, sizeof(num), "%s%ld", raw < 0 ? "-" : "", (long)a);
+    } else {
+        snprintf(num, sizeof(num), "%s%ld.%0*ld", raw < 0 ? "-" : "", (long)(a / scale), frac, (long)(a % scale));
+    }
+    snprintf(buf, len, fmt ? fmt : "%s", num);
+}
+
+int32_t FixedCell::number() const {
+    int32_t scale = 1;
+    for (uint8_t i = 0; i < frac; i++) scale *= 10;
+    // 四舍五入到整数
+    return (raw >= 0) ? (raw + scale / 2) / scale : (raw - scale / 2) / scale;
+}
+
+void StringCell::set(const char* s) {
+    if (s == nullptr) s = "";
+    if (strncmp(s, value, sizeof(value) - 1) == 0 && isSynced()) {
+        suppressedInc();
+        return;
+    }
+    strncpy(value, s, sizeof(value) - 1);
+    value[sizeof(value) - 1] = '\0';
+    markDirty();
+}
+
+void StringCell::format(char* buf, size_t len) const {
+    snprintf(buf, len, fmt ? fmt : "%s", value);
+}
+
+int32_t StringCell::number() const {
+    return atoi(value);
+}
@@ -0,0 +1,183 @@
+#ifndef GUI_BIND_H
+#define GUI_BIND_H
+
+#include <lvgl.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file gui_bind.h
+ * @brief 数据绑定 (可观察值 -> LVGL 控件)
+ * @details
+ * App 只需对值单元 `set()`，不直接操作控件：
+ * 1. 同一帧内的多次 set 合并为一次，在下一次 lv_timer_handler 中批量写入控件。
+ * 2. 写入前与控件当前内容比较 (文本 / 数值)，相同则跳过，不产生失效区域。
+ * 3. 只调用控件自身的 setter，失效范围仅限该控件。
+ * 4. 页面被 ScreenCache 淘汰后重建时，自动把值重新写入新控件。
+ *
+ * @note set() 只能在 GUI 线程中调用 (如 App::onEvent)。
+ */
+
+/// 文本类控件格式化后的最大长度 (含结尾 0)
+#ifndef BIND_TEXT_MAX
+#define BIND_TEXT_MAX 64
+#endif
+
+/// StringCell 的最大长度 (含结尾 0)
+#ifndef BIND_STR_MAX
+#define BIND_STR_MAX 32
+#endif
+
+/**
+ * @enum BindKind
+ * @brief 绑定的控件类型
+ */
+enum class BindKind : uint8_t {
+    Label,     ///< lv_label: lv_label_set_text
+    TextArea,  ///< lv_textarea: lv_textarea_set_text (SquareLine 常用作静态文本)
+    Bar,       ///< lv_bar: lv_bar_set_value (无动画)
+    Arc,       ///< lv_arc: lv_arc_set_value
+};
+
+/**
+ * @class BindCell
+ * @brief 值单元基类
+ * @details 所有已绑定的单元串在一条静态链表上 (无堆分配)，待写入的单元另串一条脏链表。
+ */
+class BindCell {
+public:
+    virtual ~BindCell();
+
+    /**
+     * @brief 绑定控件
+     * @param widget 控件全局指针地址 (如 &ui_SecondaryArea)
+     * @param screen 控件所在页面的全局指针地址 (如 &ui_HomePage)，页面未构建时暂不写入
+     * @param kind   控件类型
+     * @param fmt    文本格式 (仅文本类控件；IntCell 为一个 %d，FixedCell / StringCell 为一个 %s)，
+     *               nullptr 表示直接显示数值
+     */
+    void bind(lv_obj_t** widget, lv_obj_t** screen, BindKind kind, const char* fmt = nullptr);
+
+    /**
+     * @brief 解除绑定
+     */
+    void unbind();
+
+    /**
+     * @brief 立即写入全部待更新的单元 (通常由内部定时器调用)
+     */
+    static void flush();
+
+    /**
+     * @brief 页面构建通知 (由 ScreenCache 调用)
+     * @param screen 刚构建的页面全局指针地址
+     * @details 新控件内容是 SquareLine 的初始值，需要重新写入绑定的值。
+     */
+    static void onScreenBuilt(lv_obj_t** screen);
+
+    /**
+     * @brief 输出统计 (写入 / 跳过 / 合并次数)
+     */
+    static void dumpStats();
+
+protected:
+    BindCell();
+
+    /**
+     * @brief 值发生变化，登记到下一帧写入
+     */
+    void markDirty();
+
+    /**
+     * @brief 当前值是否与上次写入控件的值相同 (且控件未重建)
+     */
+    bool isSynced() const { return synced; }
+
+    /**
+     * @brief 记一次 "值未变化" 跳过 (set 时即可判定的情况)
+     */
+    static void suppressedInc() { suppressed++; }
+
+    /// 格式化为文本 (文本类控件)
+    virtual void format(char* buf, size_t len) const = 0;
+    /// 转换为整数 (数值类控件)
+    virtual int32_t number() const = 0;
+
+    const char* fmt = nullptr;
+
+private:
+    bool apply();
+
+    lv_obj_t** widget = nullptr;
+    lv_obj_t** screen = nullptr;
+    BindKind kind = BindKind::Label;
+    bool dirty = false;
+    bool synced = false;
+    bool hasValue = false;   ///< 是否 set 过 (未 set 过的单元不覆盖 SquareLine 初始内容)
+    BindCell* nextAll = nullptr;
+    BindCell* nextDirty = nullptr;
+
+    static BindCell* allHead;
+    static BindCell* dirtyHead;
+    static lv_timer_t* flushTimer;
+    static void flushTimerCb(lv_timer_t* timer);
+
+    static uint32_t applied;     ///< 实际写入控件次数
+    static uint32_t suppressed;  ///< 与控件当前内容相同而跳过的次数
+    static uint32_t coalesced;   ///< 同一帧内被后续 set 覆盖的次数
+};
+
+/**
+ * @class IntCell
+ * @brief 整数值单元
+ */
+class IntCell : public BindCell {
+public:
+    void set(int32_t v);
+    int32_t get() const { return value; }
+
+protected:
+    void format(char* buf, size_t len) const override;
+    int32_t number() const override { return value; }
+
+private:
+    int32_t value = 0;
+};
+
+/**
+ * @class FixedCell
+ * @brief 定点数值单元 (如 raw=235, frac=1 表示 23.5)
+ */
+class FixedCell : public BindCell {
+public:
+    explicit FixedCell(uint8_t frac_digits = 1) : frac(frac_digits) {}
+    void set(int32_t raw);
+    int32_t getRaw() const { return raw; }
+
+protected:
+    void format(char* buf, size_t len) const override;
+    int32_t number() const override;
+
+private:
+    int32_t raw = 0;
+    uint8_t frac;
+};
+
+/**
+ * @class StringCell
+ * @brief 字符串值单元 (内容拷贝到单元内部，超长截断)
+ */
+class StringCell : public BindCell {
+public:
+    void set(const char* s);
+    const char* get() const { return value; }
+
+protected:
+    void format(char* buf, size_t len) const override;
+    int32_t number() const override;
+
+private:
+    char value[BIND_STR_MAX] = {};
+};
+
+#endif
@@ -0,0 +1,205 @@
+/**
+ * @file gui_bwr.cpp
+ * @brief 三色屏双平面转换实现
+ * @details
+ * 显存布局与 gui_port_convert_area 一致：逻辑坐标 (x, y) 在显存第 x 行、第 y 位。
+ * 逻辑区域按 y 方向的字节边界分组 (每组最多 8 行)，组内对每个 x 沿列收集 8 个源像素，
+ * 得到黑白、红色两个平面中的同一个字节。分类只用整数比较：
+ * 白 = 0xFFFF，红 = (c & R/G/B 最高位) == R 最高位 (LV_COLOR_16_SWAP 时按字节交换后的掩码)。
+ */
+#include "gui_bwr.h"
+#include "gui_port.h"
+#include "common/Log.h"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <string.h>
+
+#if EPD_BWR && LV_COLOR_DEPTH != 16
+#error "EPD_BWR requires LV_COLOR_DEPTH 16"
+#endif
+
+#define BWR_STRIDE   ((EPD_WIDTH + 7) / 8)        ///< 显存每行字节数
+#define BWR_PLANE    (BWR_STRIDE * EPD_HEIGHT)    ///< 单个平面的字节数
+
+// R / G / B 各通道的最高位
+#if LV_COLOR_16_SWAP
+#define BWR_RED_MASK 0x1084
+#define BWR_RED_VAL  0x0080
+#else
+#define BWR_RED_MASK 0x8410
+#define BWR_RED_VAL  0x8000
+#endif
+
+#define BENCH_ROUNDS 10
+
+// 统计
+static uint32_t s_calls = 0;
+static uint32_t s_us = 0;
+static uint32_t s_px = 0;
+static uint32_t s_bench_mono_us = 0;
+static uint32_t s_bench_ref_us = 0;
+static uint32_t s_bench_bwr_us = 0;
+
+/**
+ * @brief 对一个像素分类并置位
+ */
+static inline void _px(uint16_t c, uint8_t bit, uint8_t *bw, uint8_t *red) {
+    if (c == 0xFFFF) {
+        *bw |= bit;
+    } else if ((c & BWR_RED_MASK) == BWR_RED_VAL) {
+        *bw |= bit;     // 红色像素在黑白平面中为白
+        *red |= bit;
+    }
+}
+
+/**
+ * @brief 双平面转换
+ */
+void gui_bwr_convert_area(uint8_t *bw, uint8_t *red, const lv_area_t *area, const lv_color_t *color_p) {
+    uint32_t t0 = micros();
+    const int32_t w = area->x2 - area->x1 + 1;
+    const int32_t x0 = LV_MAX(area->x1, 0);
+    const int32_t x1 = LV_MIN(area->x2, EPD_HEIGHT - 1);
+    const int32_t y1 = LV_MIN(area->y2, EPD_WIDTH - 1);
+    if (x0 > x1) return;
+
+    for (int32_t y = LV_MAX(area->y1, 0); y <= y1;) {
+        // 本组: 逻辑行 y..ye 落在显存同一个字节内
+        const int32_t ye = LV_MIN(y | 7, y1);
+        const uint8_t first = 0x80 >> (y & 7);
+        const uint8_t n = ye - y + 1;
+        const uint8_t mask = (uint8_t)(0xFF >> (y & 7)) & (uint8_t)(0xFF << (7 - (ye & 7)));
+        const uint32_t col = y / 8;
+        const lv_color_t *src = &color_p[(y - area->y1) * w + (x0 - area->x1)];
+
+        for (int32_t x = x0; x <= x1; x++, src++) {
+            uint8_t pb = 0, pr = 0;
+            const lv_color_t *p = src;
+            uint8_t bit = first;
+            for (uint8_t k = 0; k < n; k++, p += w, bit >>= 1) _px(p->full, bit, &pb, &pr);
+
+            uint8_t *db = &bw[col + x * BWR_STRIDE];
+            uint8_t *dr = &red[col + x * BWR_STRIDE];
+            if (mask == 0xFF) {
+                *db = pb;
+                *dr = pr;
+            } else {
+                *db = (*db & ~mask) | pb;
+                *dr = (*dr & ~mask) | pr;
+            }
+        }
+        s_px += (uint32_t)n * (x1 - x0 + 1);
+        y = ye + 1;
+    }
+
+    s_calls++;
+    s_us += micros() - t0;
+}
+
+/**
+ * @brief 逐平面、逐像素读-改-写的三色转换 (基准测试的参照与校验)
+ */
+static void _convert_ref(uint8_t *bw, uint8_t *red, const lv_area_t *area, const lv_color_t *color_p) {
+    const int32_t w = area->x2 - area->x1 + 1;
+    for (int plane = 0; plane < 2; plane++) {
+        uint8_t *fb = plane == 0 ? bw : red;
+        for (int32_t y = area->y1; y <= area->y2; y++) {
+            if (y < 0 || y >= EPD_WIDTH) continue;
+            uint8_t m = 0x80 >> (y % 8);
+            const lv_color_t *src = &color_p[(y - area->y1) * w];
+            for (int32_t x = area->x1; x <= area->x2; x++, src++) {
+                if (x < 0 || x >= EPD_HEIGHT) continue;
+                bool white = src->full == 0xFFFF;
+                bool is_red = !white && LV_COLOR_GET_R(*src) >= 16 && LV_COLOR_GET_G(*src) < 32 &&
+                              LV_COLOR_GET_B(*src) < 16;
+                bool set = plane == 0 ? (white || is_red) : is_red;
+                uint8_t *d = &fb[y / 8 + x * BWR_STRIDE];
+                if (set) *d |= m;
+                else     *d &= ~m;
+            }
+        }
+    }
+}
+
+/**
+ * @brief 生成测试图：白底，黑色文字状条纹，红色块，灰阶与橙色渐变 (应归为黑)
+ */
+static void _bench_image(lv_color_t *img) {
+    const lv_coord_t W = EPD_HEIGHT, H = EPD_WIDTH;
+    for (lv_coord_t y = 0; y < H; y++) {
+        for (lv_coord_t x = 0; x < W; x++) {
+            lv_color_t c = lv_color_white();
+            if (y >= 8 && y < 24 && (x % 3) != 0) c = lv_color_black();
+            else if (x >= 100 && x < 180 && y >= 60 && y < 120) c = lv_color_make(0xFF, 0x10, 0x10);
+            else if (y >= 130 && y < 150) c = lv_color_make((uint8_t)x, (uint8_t)x, (uint8_t)x);
+            else if (y >= 150 && y < 166) c = lv_color_make(0xFF, x / 2, 0);
+            img[y * W + x] = c;
+        }
+    }
+}
+
+/**
+ * @brief 转换基准测试
+ */
+void gui_bwr_bench(void) {
+    const uint32_t px = EPD_WIDTH * EPD_HEIGHT;
+    lv_color_t *img = (lv_color_t *)heap_caps_malloc(px * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
+    uint8_t *planes = (uint8_t *)heap_caps_malloc(BWR_PLANE * 4, MALLOC_CAP_SPIRAM);
+    if (img == NULL || planes == NULL) {
+        LOG_E("[BWR] Bench alloc failed");
+        heap_caps_free(img);
+        heap_caps_free(planes);
+        return;
+    }
+    uint8_t *bw = planes, *red = planes + BWR_PLANE;
+    uint8_t *ref_bw = planes + BWR_PLANE * 2, *ref_red = planes + BWR_PLANE * 3;
+    _bench_image(img);
+    uint32_t calls = s_calls, us = s_us, npx = s_px;
+
+    // 整屏，以及上下边缘不在字节边界上的子区域 (子区域的像素数据取测试图左上角)
+    static const lv_area_t areas[] = {
+        {0, 0, EPD_HEIGHT - 1, EPD_WIDTH - 1},
+        {10, 3, 200, 150},
+    };
+    bool match = true;
+    for (uint8_t i = 0; i < sizeof(areas) / sizeof(areas[0]); i++) {
+        memset(planes, 0xA5, BWR_PLANE * 4);
+        gui_bwr_convert_area(bw, red, &areas[i], img);
+        _convert_ref(ref_bw, ref_red, &areas[i], img);
+        if (memcmp(bw, ref_bw, BWR_PLANE) != 0 || memcmp(red, ref_red, BWR_PLANE) != 0) {
+            LOG_E("[BWR] Bench mismatch on area %u", i);
+            match = false;
+        }
+    }
+
+    const lv_area_t *full = &areas[0];
+    uint32_t t0 = micros();
+    for (int r = 0; r < BENCH_ROUNDS; r++) gui_port_convert_area(bw, full, img);
+    uint32_t t1 = micros();
+    for (int r = 0; r < BENCH_ROUNDS; r++) _convert_ref(ref_bw, ref_red, full, img);
+    uint32_t t2 = micros();
+    for (int r = 0; r < BENCH_ROUNDS; r++) gui_bwr_convert_area(bw, red, full, img);
+    uint32_t t3 = micros();
+    // 基准测试不计入运行统计
+    s_calls = calls;
+    s_us = us;
+    s_px = npx;
+
+    heap_caps_free(img);
+    heap_caps_free(planes);
+
+    s_bench_mono_us = (t1 - t0) / BENCH_ROUNDS;
+    s_bench_ref_us = (t2 - t1) / BENCH_ROUNDS;
+    s_bench_bwr_us = (t3 - t2) / BENCH_ROUNDS;
+    LOG_I("[BWR] Full frame convert: mono %lu us, BWR per-pixel %lu us, BWR gathered %lu us (%lux), %s",
+          s_bench_mono_us, s_bench_ref_us, s_bench_bwr_us,
+          s_bench_bwr_us ? s_bench_ref_us / s_bench_bwr_us : 0, match ? "planes match" : "MISMATCH");
+}
+
+/**
+ * @brief 输出转换统计
+ */
+void gui_bwr_report(void) {
+    LOG_I("[BWR] converts=%lu avg %lu us, %lu px, bench mono %lu us / per-pixel %lu us / gathered %lu us",
+          s_calls, s_calls ? s_us / s_calls : 0, s_px, s_bench_mono_us, s_bench_ref_us, s_bench_bwr_us);
+}
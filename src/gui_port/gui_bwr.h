@@ -0,0 +1,53 @@
+/**
+ * @file gui_bwr.h
+ * @brief 三色 (黑 / 白 / 红) 屏的双平面转换
+ * @details 三色屏的控制器用两个平面：0x24 黑白 (0:黑 1:白)，0x26 红色 (1:红)。
+ *          gui_port_convert_area 只产生黑白平面，本模块在同一遍扫描中把 LVGL 的 16bit 颜色
+ *          分为黑、白、红三类，同时写出两个平面：
+ *          - 纯白 (0xFFFF) 为白；R 高位为 1、G / B 高位为 0 (RGB565 各通道最高位) 为红；其余为黑；
+ *          - 显存一个字节对应逻辑坐标同一列上的 8 个像素，按字节边界每次收集 8 个源像素，
+ *            两个平面各整字节写入一次，只有区域上下边缘的字节做读-改-写；
+ *          - 红色像素在黑白平面中为白，避免控制器先驱黑再驱红。
+ *          只在 EPD_BWR 面板上由 disp_flush 调用；基准测试不依赖面板类型。
+ */
+#ifndef GUI_BWR_H
+#define GUI_BWR_H
+
+#include <lvgl.h>
+#include <stdint.h>
+#include "bsp/bsp_epd.h"
+
+// 启动时对比单平面转换、逐平面逐像素的三色转换与本模块的耗时
+#ifndef GUI_BWR_BENCH
+#define GUI_BWR_BENCH 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 将 LVGL 区域像素转换为黑白、红两个平面
+ * @param bw      黑白平面 (墨水屏原生方向，1 bit/pixel，0:黑 1:白)
+ * @param red     红色平面 (同一布局，1:红)
+ * @param area    LVGL 逻辑坐标下的区域 (横屏)
+ * @param color_p 区域像素数据 (LV_COLOR_DEPTH 16)
+ */
+void gui_bwr_convert_area(uint8_t *bw, uint8_t *red, const lv_area_t *area, const lv_color_t *color_p);
+
+/**
+ * @brief 转换基准测试：整屏测试图分别做单平面转换、逐像素三色转换与字节收集三色转换，输出耗时
+ * @details 使用独立的缓冲区 (约 100 KB PSRAM)，并校验两种三色转换结果一致，不影响显存。
+ */
+void gui_bwr_bench(void);
+
+/**
+ * @brief 输出转换统计 (次数、平均耗时、像素数、基准结果)
+ */
+void gui_bwr_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_BWR_H
@@ -0,0 +1,881 @@
+/**
+ * @file gui_decode.cpp
+ * @brief 流式图片解码 + 抖动实现
+ * @details
+ * 结构：输入缓冲 (in_t) -> 格式解码器 (逐行输出 8bit 亮度) -> 行管线 (pipe_t) -> 1bit 目标。
+ * 行管线：
+ * - 亮度先查伽马表，再按整数倍 f 盒式累加 (f 由源图与目标区域大小决定，最大 16)；
+ * - 源图第 y 行属于输出行 y / f，输出行号变化时把累加结果求平均后抖动写出。
+ *   BMP 自底向上时输出行倒序到达，不影响结果 (Floyd-Steinberg 的误差按到达顺序向 "下一行" 扩散)。
+ * 亮度、伽马、抖动的整数运算与 tools/img_dither.py 完全一致，两边输出可逐位对照。
+ *
+ * 内存只经 _alloc / _free 分配 (PSRAM)，用于统计工作内存峰值。所有接口只在 GUI 线程中调用。
+ */
+#include "gui_decode.h"
+#include "gui_pack.h"
+#include "common/Log.h"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <math.h>
+
+#if __has_include(<rom/miniz.h>)
+#include <rom/miniz.h>
+#define DECODE_HAS_PNG 1
+#else
+#define DECODE_HAS_PNG 0
+#endif
+
+#if __has_include(<rom/tjpgd.h>)
+#include <rom/tjpgd.h>
+#define DECODE_HAS_JPEG 1
+#else
+#define DECODE_HAS_JPEG 0
+#endif
+
+#define MAX_SCALE       16
+#define JPEG_POOL_SIZE  3100    ///< TJpgDec 工作区 (JD_SZBUF = 512)
+
+static const uint8_t s_bayer[8][8] = {
+    { 0, 32,  8, 40,  2, 34, 10, 42},
+    {48, 16, 56, 24, 50, 18, 58, 26},
+    {12, 44,  4, 36, 14, 46,  6, 38},
+    {60, 28, 52, 20, 62, 30, 54, 22},
+    { 3, 35, 11, 43,  1, 33,  9, 41},
+    {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47,  7, 39, 13, 45,  5, 37},
+    {63, 31, 55, 23, 61, 29, 53, 21},
+};
+
+static uint8_t s_lut[256];
+static bool s_lut_ready = false;
+
+// 内存统计 (单次解码)
+static uint32_t s_mem_cur = 0;
+static uint32_t s_mem_peak = 0;
+
+// 累计统计
+static uint32_t s_decodes = 0;
+static uint32_t s_failures = 0;
+static uint32_t s_total_us = 0;
+static uint32_t s_peak_max = 0;
+
+static void *_alloc(uint32_t size) {
+    void *p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (p == NULL) {
+        LOG_E("[Decode] Alloc failed (%lu B)", size);
+        return NULL;
+    }
+    s_mem_cur += size;
+    if (s_mem_cur > s_mem_peak) s_mem_peak = s_mem_cur;
+    return p;
+}
+
+static void _free(void *p, uint32_t size) {
+    if (p == NULL) return;
+    heap_caps_free(p);
+    s_mem_cur -= size;
+}
+
+static inline uint8_t _luma(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint8_t)((r * 77 + g * 150 + b * 29 + 128) >> 8);
+}
+
+static inline uint8_t _over_white(uint8_t v, uint8_t a) {
+    return (uint8_t)((v * a + 255 * (255 - a) + 127) / 255);
+}
+
+/**
+ * @brief 设置伽马
+ */
+void gui_decode_set_gamma(float gamma) {
+    for (int i = 0; i < 256; i++) s_lut[i] = (uint8_t)(255.0f * powf(i / 255.0f, gamma) + 0.5f);
+    s_lut_ready = true;
+}
+
+/* --- 输入缓冲 --- */
+
+typedef struct {
+    gui_decode_read_cb_t cb;
+    void *ud;
+    uint8_t buf[GUI_DECODE_IN_BUF];
+    uint32_t pos;
+    uint32_t len;
+} in_t;
+
+/**
+ * @brief 缓冲区读空时补充数据
+ * @return false 数据结束
+ */
+static bool _in_fill(in_t *in) {
+    if (in->pos < in->len) return true;
+    in->pos = 0;
+    in->len = in->cb(in->ud, in->buf, sizeof(in->buf));
+    return in->len > 0;
+}
+
+/**
+ * @brief 读 n 字节 (dst 为 NULL 时跳过)
+ * @return 实际字节数
+ */
+static uint32_t _in_read(in_t *in, uint8_t *dst, uint32_t n) {
+    uint32_t done = 0;
+    while (done < n) {
+        if (in->pos == in->len) {
+            // 大块跳过直接交给回调，不经过缓冲区
+            if (dst == NULL && n - done >= sizeof(in->buf)) {
+                uint32_t k = in->cb(in->ud, NULL, n - done);
+                if (k == 0) break;
+                done += k;
+                continue;
+            }
+            if (!_in_fill(in)) break;
+        }
+        uint32_t k = min(n - done, in->len - in->pos);
+        if (dst) memcpy(dst + done, in->buf + in->pos, k);
+        in->pos += k;
+        done += k;
+    }
+    return done;
+}
+
+static inline bool _in_exact(in_t *in, void *dst, uint32_t n) {
+    return _in_read(in, (uint8_t *)dst, n) == n;
+}
+
+static inline uint32_t _le32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+static inline uint16_t _le16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+static inline uint32_t _be32(const uint8_t *p) { return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3]; }
+
+/* --- 行管线 --- */
+
+typedef struct {
+    gui_decode_target_t dst;
+    lv_img_dsc_t **img_out;  ///< 非 NULL 时在 _pipe_init 中按输出尺寸分配图片
+    gui_dither_t dither;
+    uint16_t src_w, src_h;   ///< 送入管线的尺寸 (JPEG 为解码缩放之后)
+    uint16_t img_w, img_h;   ///< 原图尺寸
+    uint8_t shift;           ///< 解码缩放 (JPEG，1 / 2^shift)
+    uint16_t out_w, out_h;
+    uint8_t f;               ///< 盒式缩小倍数
+    uint8_t bin_rows;        ///< 当前输出行已累加的源行数
+    int32_t bin;             ///< 当前输出行号
+    uint32_t emitted;        ///< 已输出行数 (决定蛇形扫描方向)
+    uint16_t *acc;
+    uint8_t *line;
+    int16_t *err;
+    int16_t *err_next;
+    uint32_t acc_size, line_size, err_size;
+} pipe_t;
+
+/**
+ * @brief 源图尺寸确定后初始化管线
+ */
+static bool _pipe_init(pipe_t *p, uint16_t src_w, uint16_t src_h) {
+    if (src_w == 0 || src_h == 0 || src_w > GUI_DECODE_MAX_W) {
+        LOG_E("[Decode] Unsupported size %ux%u", src_w, src_h);
+        return false;
+    }
+    uint8_t f = 1;
+    while (f < MAX_SCALE && ((src_w + f - 1) / f > p->dst.w || (src_h + f - 1) / f > p->dst.h)) f++;
+    p->f = f;
+    p->src_w = p->img_w = src_w;
+    p->src_h = p->img_h = src_h;
+    p->out_w = min((src_w + f - 1) / f, (int)p->dst.w);
+    p->out_h = min((src_h + f - 1) / f, (int)p->dst.h);
+    p->bin = -1;
+
+    if (p->img_out != NULL) {
+        uint32_t stride = (p->out_w + 7) / 8;
+        uint32_t bytes = stride * p->out_h;
+        lv_img_dsc_t *img = (lv_img_dsc_t *)heap_caps_calloc(1, sizeof(lv_img_dsc_t) + bytes, MALLOC_CAP_SPIRAM);
+        if (img == NULL) {
+            LOG_E("[Decode] Image alloc failed (%ux%u)", p->out_w, p->out_h);
+            return false;
+        }
+        img->header.w = p->out_w;
+        img->header.h = p->out_h;
+        img->header.cf = LV_IMG_CF_ALPHA_1BIT;
+        img->data_size = bytes;
+        img->data = (const uint8_t *)(img + 1);
+        *p->img_out = img;
+        p->dst.buf = (uint8_t *)(img + 1);
+        p->dst.stride = stride;
+        p->dst.x = p->dst.y = 0;
+        p->dst.ink = 1;
+    }
+
+    p->acc_size = sizeof(uint16_t) * ((src_w + f - 1) / f);
+    p->line_size = p->out_w;
+    p->err_size = p->dither == GUI_DITHER_FS ? sizeof(int16_t) * (p->out_w + 2) : 0;
+    p->acc = (uint16_t *)_alloc(p->acc_size);
+    p->line = (uint8_t *)_alloc(p->line_size);
+    if (p->err_size) {
+        p->err = (int16_t *)_alloc(p->err_size);
+        p->err_next = (int16_t *)_alloc(p->err_size);
+    }
+    if (p->acc == NULL || p->line == NULL || (p->err_size && (p->err == NULL || p->err_next == NULL))) return false;
+    memset(p->acc, 0, p->acc_size);
+    if (p->err_size) memset(p->err, 0, p->err_size);
+    return true;
+}
+
+static void _pipe_free(pipe_t *p) {
+    _free(p->acc, p->acc_size);
+    _free(p->line, p->line_size);
+    _free(p->err, p->err_size);
+    _free(p->err_next, p->err_size);
+    p->acc = NULL;
+    p->line = NULL;
+    p->err = p->err_next = NULL;
+}
+
+static inline void _put(uint8_t *row, uint32_t bit, bool on) {
+    if (on) row[bit >> 3] |= 0x80 >> (bit & 7);
+    else    row[bit >> 3] &= ~(0x80 >> (bit & 7));
+}
+
+/**
+ * @brief 抖动一行并写入目标
+ */
+static void _pipe_dither(pipe_t *p, uint16_t oy) {
+    const uint8_t *line = p->line;
+    uint16_t w = p->out_w;
+    uint8_t *row = p->dst.buf + (uint32_t)(p->dst.y + oy) * p->dst.stride;
+    uint32_t x0 = p->dst.x;
+    bool ink1 = p->dst.ink != 0;
+
+    switch (p->dither) {
+        case GUI_DITHER_NONE:
+            for (uint16_t x = 0; x < w; x++) _put(row, x0 + x, (line[x] < 128) == ink1);
+            break;
+        case GUI_DITHER_ORDERED: {
+            const uint8_t *m = s_bayer[oy & 7];
+            for (uint16_t x = 0; x < w; x++) _put(row, x0 + x, (line[x] < m[x & 7] * 4 + 2) == ink1);
+            break;
+        }
+        default: {
+            int16_t *cur = p->err, *nxt = p->err_next;
+            memset(nxt, 0, p->err_size);
+            bool ltr = (p->emitted & 1) == 0;
+            int d = ltr ? 1 : -1;
+            for (int x = ltr ? 0 : w - 1; x >= 0 && x < w; x += d) {
+                int e = line[x] + cur[x + 1];
+                int q;
+                if (e < 128) {
+                    _put(row, x0 + x, ink1);
+                    q = e;
+                } else {
+                    _put(row, x0 + x, !ink1);
+                    q = e - 255;
+                }
+                cur[x + 1 + d] += (q * 7) >> 4;
+                nxt[x + 1 - d] += (q * 3) >> 4;
+                nxt[x + 1] += (q * 5) >> 4;
+                nxt[x + 1 + d] += q >> 4;
+            }
+            p->err = nxt;
+            p->err_next = cur;
+            break;
+        }
+    }
+}
+
+/**
+ * @brief 输出当前累加的一行
+ */
+static void _pipe_flush(pipe_t *p) {
+    if (p->bin_rows == 0) return;
+    uint8_t f = p->f;
+    for (uint16_t x = 0; x < p->out_w; x++) {
+        uint32_t cols = min((uint32_t)f, (uint32_t)(p->src_w - x * f));
+        p->line[x] = (uint8_t)(p->acc[x] / (cols * p->bin_rows));
+    }
+    memset(p->acc, 0, p->acc_size);
+    p->bin_rows = 0;
+    if (p->bin < p->out_h) _pipe_dither(p, (uint16_t)p->bin);
+    p->emitted++;
+}
+
+/**
+ * @brief 送入源图第 y 行的亮度 (未经伽马)
+ */
+static void _pipe_row(pipe_t *p, uint16_t y, const uint8_t *px) {
+    int32_t b = y / p->f;
+    if (b != p->bin) {
+        _pipe_flush(p);
+        p->bin = b;
+    }
+    uint16_t *acc = p->acc;
+    if (p->f == 1) {
+        for (uint16_t x = 0; x < p->src_w; x++) acc[x] = s_lut[px[x]];
+    } else {
+        uint8_t f = p->f;
+        for (uint16_t x = 0; x < p->src_w; x++) acc[x / f] += s_lut[px[x]];
+    }
+    p->bin_rows++;
+}
+
+/* --- BMP --- */
+
+static bool _decode_bmp(in_t *in, pipe_t *p) {
+    uint8_t fh[14], ih[40];
+    if (!_in_exact(in, fh, sizeof(fh)) || !_in_exact(in, ih, sizeof(ih))) return false;
+    uint32_t off = _le32(fh + 10);
+    uint32_t dib = _le32(ih);
+    int32_t w = (int32_t)_le32(ih + 4);
+    int32_t h = (int32_t)_le32(ih + 8);
+    uint16_t bpp = _le16(ih + 14);
+    uint32_t comp = _le32(ih + 16);
+    uint32_t ncolors = _le32(ih + 32);
+    if (comp != 0 || (bpp != 1 && bpp != 4 && bpp != 8 && bpp != 24 && bpp != 32) || dib < 40 || w <= 0 || h == 0) {
+        LOG_E("[Decode] Unsupported BMP (bpp %u, compression %lu)", bpp, comp);
+        return false;
+    }
+    _in_read(in, NULL, dib - 40);
+
+    uint8_t pal[256];
+    uint32_t npal = 0;
+    if (bpp <= 8) {
+        npal = ncolors ? (ncolors < 256 ? ncolors : 256) : (1UL << bpp);
+        for (uint32_t i = 0; i < npal; i++) {
+            uint8_t c[4];
+            if (!_in_exact(in, c, 4)) return false;
+            pal[i] = _luma(c[2], c[1], c[0]);
+        }
+    }
+    uint32_t pos = 14 + dib + 4 * npal;
+    if (off < pos) return false;
+    _in_read(in, NULL, off - pos);
+
+    bool bottom_up = h > 0;
+    if (h < 0) h = -h;
+    if (!_pipe_init(p, (uint16_t)w, (uint16_t)h)) return false;
+
+    uint32_t stride = ((uint32_t)w * bpp + 31) / 32 * 4;
+    uint8_t *raw = (uint8_t *)_alloc(stride);
+    uint8_t *px = (uint8_t *)_alloc(w);
+    bool ok = raw != NULL && px != NULL;
+    for (int32_t i = 0; ok && i < h; i++) {
+        if (!_in_exact(in, raw, stride)) {
+            LOG_E("[Decode] Truncated BMP at row %ld", i);
+            ok = false;
+            break;
+        }
+        if (bpp >= 24) {
+            uint8_t n = bpp / 8;
+            for (int32_t x = 0; x < w; x++) px[x] = _luma(raw[x * n + 2], raw[x * n + 1], raw[x * n]);
+        } else {
+            uint8_t per = 8 / bpp, mask = (1 << bpp) - 1;
+            for (int32_t x = 0; x < w; x++) {
+                uint8_t v = (raw[x / per] >> (8 - bpp * (x % per + 1))) & mask;
+                px[x] = v < npal ? pal[v] : 0;
+            }
+        }
+        _pipe_row(p, bottom_up ? h - 1 - i : i, px);
+    }
+    _free(raw, stride);
+    _free(px, w);
+    return ok;
+}
+
+/* --- PNG --- */
+
+#if DECODE_HAS_PNG
+
+typedef struct {
+    uint32_t w, h;
+    uint8_t depth, ctype, bpp;
+    uint32_t row_bytes;
+    uint8_t *cur, *prev;     ///< 扫描线 (首字节为过滤类型)
+    uint32_t fill;
+    uint32_t y;
+    uint8_t *px;
+    uint8_t pal[256];
+    uint8_t trns[256];
+    uint16_t npal, ntrns;
+} png_t;
+
+static inline uint8_t _paeth(uint8_t a, uint8_t b, uint8_t c) {
+    int pp = a + b - c;
+    int pa = abs(pp - a), pb = abs(pp - b), pc = abs(pp - c);
+    return (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+}
+
+static bool _png_unfilter(png_t *g) {
+    uint8_t *cur = g->cur, *prev = g->prev;
+    uint32_t n = g->row_bytes + 1, bpp = g->bpp;
+    switch (cur[0]) {
+        case 0: break;
+        case 1: for (uint32_t i = 1 + bpp; i < n; i++) cur[i] += cur[i - bpp]; break;
+        case 2: for (uint32_t i = 1; i < n; i++) cur[i] += prev[i]; break;
+        case 3:
+            for (uint32_t i = 1; i < n; i++) cur[i] += ((i > bpp ? cur[i - bpp] : 0) + prev[i]) >> 1;
+            break;
+        case 4:
+            for (uint32_t i = 1; i < n; i++) {
+                cur[i] += _paeth(i > bpp ? cur[i - bpp] : 0, prev[i], i > bpp ? prev[i - bpp] : 0);
+            }
+            break;
+        default:
+            LOG_E("[Decode] Bad PNG filter %u", cur[0]);
+            return false;
+    }
+    return true;
+}
+
+static inline uint8_t _png_index(png_t *g, uint8_t v) {
+    uint8_t a = v < g->ntrns ? g->trns[v] : 255;
+    return _over_white(v < g->npal ? g->pal[v] : 0, a);
+}
+
+/**
+ * @brief 一行扫描线转换为亮度
+ */
+static void _png_luma(png_t *g) {
+    const uint8_t *d = g->cur + 1;
+    uint8_t *px = g->px;
+    uint32_t w = g->w;
+    if (g->depth < 8) {
+        uint8_t depth = g->depth, per = 8 / depth, mask = (1 << depth) - 1;
+        for (uint32_t x = 0; x < w; x++) {
+            uint8_t v = (d[x / per] >> (8 - depth * (x % per + 1))) & mask;
+            px[x] = g->ctype == 3 ? _png_index(g, v) : v * 255 / mask;
+        }
+        return;
+    }
+    uint8_t s = g->depth / 8;    // 16bit 取高字节
+    switch (g->ctype) {
+        case 0: for (uint32_t x = 0; x < w; x++) px[x] = d[x * s]; break;
+        case 2:
+            for (uint32_t x = 0, o = 0; x < w; x++, o += 3 * s) px[x] = _luma(d[o], d[o + s], d[o + 2 * s]);
+            break;
+        case 3: for (uint32_t x = 0; x < w; x++) px[x] = _png_index(g, d[x]); break;
+        case 4:
+            for (uint32_t x = 0, o = 0; x < w; x++, o += 2 * s) px[x] = _over_white(d[o], d[o + s]);
+            break;
+        default:
+            for (uint32_t x = 0, o = 0; x < w; x++, o += 4 * s) {
+                px[x] = _over_white(_luma(d[o], d[o + s], d[o + 2 * s]), d[o + 3 * s]);
+            }
+            break;
+    }
+}
+
+/**
+ * @brief 解压出的数据拼成扫描线，每满一行送入管线
+ */
+static bool _png_feed(png_t *g, pipe_t *p, const uint8_t *data, uint32_t n) {
+    uint32_t line = g->row_bytes + 1;
+    while (n > 0 && g->y < g->h) {
+        uint32_t k = min(n, line - g->fill);
+        memcpy(g->cur + g->fill, data, k);
+        g->fill += k;
+        data += k;
+        n -= k;
+        if (g->fill == line) {
+            if (!_png_unfilter(g)) return false;
+            _png_luma(g);
+            _pipe_row(p, g->y++, g->px);
+            g->fill = 0;
+            uint8_t *t = g->cur;
+            g->cur = g->prev;
+            g->prev = t;
+        }
+    }
+    return true;
+}
+
+static bool _decode_png(in_t *in, pipe_t *p) {
+    static const uint8_t sig[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    uint8_t hdr[13];
+    if (!_in_exact(in, hdr, 8) || memcmp(hdr, sig, 8) != 0) return false;
+
+    png_t *g = (png_t *)_alloc(sizeof(png_t));
+    tinfl_decompressor *inf = (tinfl_decompressor *)_alloc(sizeof(tinfl_decompressor));
+    uint8_t *dict = (uint8_t *)_alloc(TINFL_LZ_DICT_SIZE);
+    uint32_t line_size = 0;
+    bool ok = g != NULL && inf != NULL && dict != NULL;
+    bool have_ihdr = false, z_done = false;
+    uint32_t dict_ofs = 0;
+    if (ok) {
+        memset(g, 0, sizeof(png_t));
+        tinfl_init(inf);
+    }
+
+    while (ok) {
+        uint8_t ch[8];
+        if (!_in_exact(in, ch, 8)) {
+            ok = false;
+            break;
+        }
+        uint32_t len = _be32(ch);
+        if (memcmp(ch + 4, "IHDR", 4) == 0) {
+            if (len != 13 || !_in_exact(in, hdr, 13)) { ok = false; break; }
+            g->w = _be32(hdr);
+            g->h = _be32(hdr + 4);
+            g->depth = hdr[8];
+            g->ctype = hdr[9];
+            static const uint8_t chans[7] = {1, 0, 3, 1, 2, 0, 4};
+            uint8_t c = g->ctype <= 6 ? chans[g->ctype] : 0;
+            if (c == 0 || hdr[12] != 0 || g->w > 0xFFFF || g->h > 0xFFFF) {
+                LOG_E("[Decode] Unsupported PNG (type %u, interlace %u)", g->ctype, hdr[12]);
+                ok = false;
+                break;
+            }
+            g->bpp = max(1, c * g->depth / 8);
+            g->row_bytes = (g->w * c * g->depth + 7) / 8;
+            line_size = g->row_bytes + 1;
+            if (!_pipe_init(p, (uint16_t)g->w, (uint16_t)g->h)) { ok = false; break; }
+            g->cur = (uint8_t *)_alloc(line_size);
+            g->prev = (uint8_t *)_alloc(line_size);
+            g->px = (uint8_t *)_alloc(g->w);
+            if (g->cur == NULL || g->prev == NULL || g->px == NULL) { ok = false; break; }
+            memset(g->prev, 0, line_size);
+            have_ihdr = true;
+        } else if (memcmp(ch + 4, "PLTE", 4) == 0 && len <= 768) {
+            g->npal = len / 3;
+            for (uint16_t i = 0; i < g->npal; i++) {
+                uint8_t c[3];
+                if (!_in_exact(in, c, 3)) { ok = false; break; }
+                g->pal[i] = _luma(c[0], c[1], c[2]);
+            }
+            _in_read(in, NULL, len - g->npal * 3);
+        } else if (memcmp(ch + 4, "tRNS", 4) == 0 && g->ctype == 3 && len <= 256) {
+            g->ntrns = len;
+            ok = _in_exact(in, g->trns, len);
+        } else if (memcmp(ch + 4, "IDAT", 4) == 0 && have_ihdr && !z_done) {
+            uint32_t left = len;
+            while (ok) {
+                if (left > 0 && !_in_fill(in)) { ok = false; break; }
+                size_t in_sz = min(left, in->len - in->pos);
+                size_t out_sz = TINFL_LZ_DICT_SIZE - dict_ofs;
+                tinfl_status st = tinfl_decompress(inf, in->buf + in->pos, &in_sz, dict, dict + dict_ofs, &out_sz,
+                                                   TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_HAS_MORE_INPUT);
+                in->pos += in_sz;
+                left -= in_sz;
+                ok = _png_feed(g, p, dict + dict_ofs, out_sz);
+                dict_ofs = (dict_ofs + out_sz) & (TINFL_LZ_DICT_SIZE - 1);
+                if (st < 0) {
+                    LOG_E("[Decode] Inflate error %d", st);
+                    ok = false;
+                } else if (st == TINFL_STATUS_DONE) {
+                    z_done = true;
+                    _in_read(in, NULL, left);
+                    break;
+                } else if (st == TINFL_STATUS_NEEDS_MORE_INPUT && left == 0) {
+                    break;    // 数据在下一个 IDAT 中
+                }
+            }
+        } else if (memcmp(ch + 4, "IEND", 4) == 0) {
+            break;
+        } else {
+            _in_read(in, NULL, len);
+        }
+        _in_read(in, NULL, 4);    // CRC (整包由 gui_pack 或传输层校验，这里不重复计算)
+    }
+
+    if (ok && (!have_ihdr || g->y < g->h)) {
+        LOG_E("[Decode] Truncated PNG (%lu of %lu rows)", g ? g->y : 0, g ? g->h : 0);
+        ok = false;
+    }
+    if (g != NULL) {
+        _free(g->cur, line_size);
+        _free(g->prev, line_size);
+        _free(g->px, g->w);
+    }
+    _free(g, sizeof(png_t));
+    _free(inf, sizeof(tinfl_decompressor));
+    _free(dict, TINFL_LZ_DICT_SIZE);
+    return ok;
+}
+
+#endif // DECODE_HAS_PNG
+
+/* --- JPEG --- */
+
+#if DECODE_HAS_JPEG
+
+typedef struct {
+    in_t *in;
+    pipe_t *p;
+    uint8_t *band;           ///< 一个 MCU 行的亮度 (src_w x 16)
+    uint16_t w, h;           ///< 解码缩放后的尺寸
+} jpg_t;
+
+static UINT _jpg_in(JDEC *jd, BYTE *buf, UINT len) {
+    jpg_t *j = (jpg_t *)jd->device;
+    return _in_read(j->in, buf, len);
+}
+
+/**
+ * @brief MCU 输出：亮度写入行带，一行 MCU 写满后整带送入管线
+ */
+static UINT _jpg_out(JDEC *jd, void *bitmap, JRECT *rect) {
+    jpg_t *j = (jpg_t *)jd->device;
+    const uint8_t *rgb = (const uint8_t *)bitmap;
+    for (uint16_t y = rect->top; y <= rect->bottom; y++) {
+        uint8_t *dst = j->band + (uint32_t)(y - rect->top) * j->w;
+        for (uint16_t x = rect->left; x <= rect->right; x++, rgb += 3) {
+            if (x < j->w) dst[x] = _luma(rgb[0], rgb[1], rgb[2]);
+        }
+    }
+    if (rect->right + 1 >= j->w) {
+        for (uint16_t y = rect->top; y <= rect->bottom && y < j->h; y++) {
+            _pipe_row(j->p, y, j->band + (uint32_t)(y - rect->top) * j->w);
+        }
+    }
+    return 1;
+}
+
+static bool _decode_jpeg(in_t *in, pipe_t *p) {
+    JDEC jd;
+    jpg_t j = {in, p, NULL, 0, 0};
+    void *pool = _alloc(JPEG_POOL_SIZE);
+    if (pool == NULL) return false;
+
+    bool ok = false;
+    uint32_t band_size = 0;
+    JRESULT r = jd_prepare(&jd, _jpg_in, pool, JPEG_POOL_SIZE, &j);
+    if (r != JDR_OK) {
+        LOG_E("[Decode] JPEG prepare failed (%d)", r);
+    } else {
+        // 解码缩放: 1/1 ~ 1/8 中能放进目标区域的最大一档，其余由盒式缩小完成
+        uint8_t s = 0;
+        while (s < 3 && (((uint32_t)jd.width >> s) > p->dst.w || ((uint32_t)jd.height >> s) > p->dst.h)) s++;
+        j.w = (jd.width + (1 << s) - 1) >> s;
+        j.h = (jd.height + (1 << s) - 1) >> s;
+        band_size = (uint32_t)j.w * 16;
+        j.band = (uint8_t *)_alloc(band_size);
+        if (j.band != NULL && _pipe_init(p, j.w, j.h)) {
+            p->img_w = jd.width;
+            p->img_h = jd.height;
+            p->shift = s;
+            r = jd_decomp(&jd, _jpg_out, s);
+            ok = r == JDR_OK;
+            if (!ok) LOG_E("[Decode] JPEG decode failed (%d)", r);
+        }
+    }
+    _free(j.band, band_size);
+    _free(pool, JPEG_POOL_SIZE);
+    return ok;
+}
+
+#endif // DECODE_HAS_JPEG
+
+/* --- 入口 --- */
+
+/**
+ * @brief 识别格式并解码，结束后输出最后一行、释放管线
+ */
+static bool _decode(gui_decode_read_cb_t read_cb, void *user_data, pipe_t *p, gui_decode_info_t *info) {
+    if (!s_lut_ready) gui_decode_set_gamma(GUI_DECODE_GAMMA);
+    s_mem_cur = 0;
+    s_mem_peak = 0;
+    uint32_t t0 = micros();
+
+    const char *fmt = NULL;
+    bool ok = false;
+    in_t *in = (in_t *)_alloc(sizeof(in_t));
+    if (in != NULL) {
+        in->cb = read_cb;
+        in->ud = user_data;
+        in->pos = in->len = 0;
+        const uint8_t *b = in->buf;
+        if (!_in_fill(in) || in->len < 4) {
+            LOG_E("[Decode] Empty input");
+        } else if (b[0] == 'B' && b[1] == 'M') {
+            fmt = "BMP";
+            ok = _decode_bmp(in, p);
+#if DECODE_HAS_PNG
+        } else if (b[0] == 0x89 && b[1] == 'P' && b[2] == 'N' && b[3] == 'G') {
+            fmt = "PNG";
+            ok = _decode_png(in, p);
+#endif
+#if DECODE_HAS_JPEG
+        } else if (b[0] == 0xFF && b[1] == 0xD8) {
+            fmt = "JPEG";
+            ok = _decode_jpeg(in, p);
+#endif
+        } else {
+            LOG_E("[Decode] Unknown format %02x %02x %02x %02x", b[0], b[1], b[2], b[3]);
+        }
+    }
+    if (ok) _pipe_flush(p);
+    _pipe_free(p);
+    _free(in, sizeof(in_t));
+    uint32_t us = micros() - t0;
+
+    s_decodes++;
+    if (!ok) s_failures++;
+    s_total_us += us;
+    if (s_mem_peak > s_peak_max) s_peak_max = s_mem_peak;
+    if (info != NULL) {
+        info->format = fmt ? fmt : "?";
+        info->src_w = p->img_w;
+        info->src_h = p->img_h;
+        info->out_w = p->out_w;
+        info->out_h = p->out_h;
+        info->scale = (uint8_t)(p->f << p->shift);
+        info->us = us;
+        info->peak = s_mem_peak;
+    }
+    LOG_D("[Decode] %s %ux%u -> %ux%u: %s, %lu us, peak %lu B", fmt ? fmt : "?", p->img_w, p->img_h,
+          p->out_w, p->out_h, ok ? "ok" : "FAILED", us, s_mem_peak);
+    return ok;
+}
+
+/**
+ * @brief 流式解码到 1bit 区域
+ */
+bool gui_decode_stream(gui_decode_read_cb_t read_cb, void *user_data, const gui_decode_target_t *dst,
+                       gui_dither_t dither, gui_decode_info_t *info) {
+    if (read_cb == NULL || dst == NULL || dst->buf == NULL || dst->w == 0 || dst->h == 0) return false;
+    pipe_t p = {};
+    p.dst = *dst;
+    p.dither = dither;
+    return _decode(read_cb, user_data, &p, info);
+}
+
+/**
+ * @brief 内存数据源
+ */
+typedef struct {
+    const uint8_t *data;
+    uint32_t size;
+    uint32_t pos;
+} mem_src_t;
+
+static uint32_t _mem_read(void *user_data, uint8_t *buf, uint32_t len) {
+    mem_src_t *m = (mem_src_t *)user_data;
+    uint32_t n = min(len, m->size - m->pos);
+    if (buf != NULL) memcpy(buf, m->data + m->pos, n);
+    m->pos += n;
+    return n;
+}
+
+/**
+ * @brief 从内存解码到 1bit 区域
+ */
+bool gui_decode_mem(const void *data, uint32_t size, const gui_decode_target_t *dst,
+                    gui_dither_t dither, gui_decode_info_t *info) {
+    if (data == NULL) return false;
+    mem_src_t m = {(const uint8_t *)data, size, 0};
+    return gui_decode_stream(_mem_read, &m, dst, dither, info);
+}
+
+/**
+ * @brief 解码为 ALPHA_1BIT 图片
+ */
+lv_img_dsc_t *gui_decode_img(const void *data, uint32_t size, uint16_t max_w, uint16_t max_h,
+                             gui_dither_t dither) {
+    if (data == NULL || max_w == 0 || max_h == 0) return NULL;
+    lv_img_dsc_t *img = NULL;
+    mem_src_t m = {(const uint8_t *)data, size, 0};
+    pipe_t p = {};
+    p.dst.w = max_w;
+    p.dst.h = max_h;
+    p.img_out = &img;
+    p.dither = dither;
+    if (!_decode(_mem_read, &m, &p, NULL)) {
+        gui_decode_img_free(img);
+        return NULL;
+    }
+    return img;
+}
+
+/**
+ * @brief 释放图片
+ */
+void gui_decode_img_free(lv_img_dsc_t *img) {
+    heap_caps_free(img);
+}
+
+/**
+ * @brief 生成 24bit BMP 合成测试图 (与 tools/img_dither.py 的 synthetic() 相同)
+ * @return BMP 数据 (PSRAM)，调用方释放
+ */
+static uint8_t *_synthetic_bmp(uint16_t w, uint16_t h, uint32_t *size) {
+    uint32_t stride = ((uint32_t)w * 3 + 3) / 4 * 4;
+    uint32_t total = 54 + stride * h;
+    uint8_t *bmp = (uint8_t *)heap_caps_calloc(1, total, MALLOC_CAP_SPIRAM);
+    if (bmp == NULL) return NULL;
+
+    uint8_t *p = bmp;
+    p[0] = 'B';
+    p[1] = 'M';
+    memcpy(p + 2, &total, 4);
+    p[10] = 54;
+    p[14] = 40;
+    int32_t iw = w, ih = h;
+    memcpy(p + 18, &iw, 4);
+    memcpy(p + 22, &ih, 4);
+    p[26] = 1;
+    p[28] = 24;
+
+    int32_t r = h / 3;
+    for (uint16_t y = 0; y < h; y++) {
+        uint8_t *row = bmp + 54 + (uint32_t)(h - 1 - y) * stride;
+        for (uint16_t x = 0; x < w; x++) {
+            uint8_t v = x * 255 / (w - 1);
+            int32_t dx = x - w / 2, dy = y - h / 2;
+            if (dx * dx + dy * dy < r * r) v = 255 - v;
+            row[x * 3] = v;
+            row[x * 3 + 1] = (uint8_t)(v + y);
+            row[x * 3 + 2] = v;
+        }
+    }
+    *size = total;
+    return bmp;
+}
+
+/**
+ * @brief 解码基准测试
+ */
+void gui_decode_bench(void) {
+    static const char *const dither_names[] = {"none", "ordered", "fs"};
+    static const char *const pack_names[] = {"bench_bmp", "bench_png", "bench_jpg"};
+    const uint16_t w = 264, h = 176;
+
+    uint32_t bits_size = (w + 7) / 8 * h;
+    uint8_t *bits = (uint8_t *)heap_caps_malloc(bits_size, MALLOC_CAP_SPIRAM);
+    uint32_t syn_size = 0;
+    uint8_t *syn = _synthetic_bmp(w, h, &syn_size);
+    if (bits == NULL || syn == NULL) {
+        LOG_E("[Decode] Bench alloc failed");
+        heap_caps_free(bits);
+        heap_caps_free(syn);
+        return;
+    }
+
+    gui_decode_target_t dst = {bits, (uint16_t)((w + 7) / 8), 0, 0, w, h, 1};
+    for (int src = -1; src < (int)(sizeof(pack_names) / sizeof(pack_names[0])); src++) {
+        const void *data = syn;
+        uint32_t size = syn_size;
+        const char *name = "synthetic";
+        if (src >= 0) {
+            name = pack_names[src];
+            data = gui_pack_find(name, GUI_PACK_FMT_RAW, &size);
+            if (data == NULL) continue;
+        }
+        for (int d = GUI_DITHER_NONE; d <= GUI_DITHER_FS; d++) {
+            gui_decode_info_t info;
+            bool ok = gui_decode_mem(data, size, &dst, (gui_dither_t)d, &info);
+            uint32_t ink = 0;
+            for (uint32_t i = 0; i < bits_size; i++) ink += __builtin_popcount(bits[i]);
+            LOG_I("[Decode] Bench %-10s %-4s %7lu B %ux%u -> %ux%u (1/%u) %-7s %6lu us peak %6lu B ink %lu%%%s",
+                  name, info.format, size, info.src_w, info.src_h, info.out_w, info.out_h, info.scale,
+                  dither_names[d], info.us, info.peak, ink * 100 / ((uint32_t)w * h), ok ? "" : " (FAILED)");
+        }
+    }
+    heap_caps_free(bits);
+    heap_caps_free(syn);
+}
+
+/**
+ * @brief 输出解码统计
+ */
+void gui_decode_report(void) {
+    if (s_decodes == 0) return;
+    LOG_I("[Decode] decodes=%lu failed=%lu avg=%lu us peak=%lu B (png=%d jpeg=%d)",
+          s_decodes, s_failures, s_total_us / s_decodes, s_peak_max, DECODE_HAS_PNG, DECODE_HAS_JPEG);
+}
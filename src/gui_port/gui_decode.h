@@ -0,0 +1,142 @@
+/**
+ * @file gui_decode.h
+ * @brief 流式图片解码 + 抖动 (BMP / PNG / JPEG -> 1bit)
+ * @details 照片、天气云图、专辑封面这类连续色调图片，整幅解码为 RGB 再二值化需要几百 KB，
+ *          且墨水屏只有黑白两色，直接阈值化会丢掉全部灰阶。本模块按行流式处理：
+ *          解码器每产生一行就经过 "亮度 -> 伽马查表 -> 盒式缩小 -> 抖动" 写入 1bit 目标区域，
+ *          任何时候只保留几行扫描线 (PNG 另需 32 KB 解压窗口，JPEG 为一个 MCU 行)。
+ *          - BMP：1/4/8/24/32 位未压缩，自底向上或自顶向下；
+ *          - PNG：非隔行，全部颜色类型与位深 (16 位取高字节)，带 alpha 时与白色混合，用 ROM 中的 tinfl 解压；
+ *          - JPEG：基线，用 ROM 中的 TJpgDec，按目标大小选择 1/1 ~ 1/8 解码缩放。
+ *          抖动支持阈值、8x8 有序 (Bayer) 与 Floyd-Steinberg (蛇形扫描)。
+ *          算法与 tools/img_dither.py 一致，主机端可用它离线转换并对照耗时与内存。
+ */
+#ifndef GUI_DECODE_H
+#define GUI_DECODE_H
+
+#include <lvgl.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// 默认伽马 (sRGB 亮度转线性后再抖动，否则中间调偏亮)
+#ifndef GUI_DECODE_GAMMA
+#define GUI_DECODE_GAMMA 2.2f
+#endif
+
+// 输入缓冲区字节数
+#ifndef GUI_DECODE_IN_BUF
+#define GUI_DECODE_IN_BUF 1024
+#endif
+
+// 支持的最大源图宽度 (像素)
+#ifndef GUI_DECODE_MAX_W
+#define GUI_DECODE_MAX_W 2048
+#endif
+
+// 启动时对合成测试图 (以及资源包中的 bench_bmp / bench_png / bench_jpg) 做一次解码基准测试
+#ifndef GUI_DECODE_BENCH
+#define GUI_DECODE_BENCH 0
+#endif
+
+/**
+ * @brief 抖动方式
+ */
+typedef enum {
+    GUI_DITHER_NONE = 0,     ///< 阈值 (亮度 < 128 着墨)
+    GUI_DITHER_ORDERED,      ///< 8x8 Bayer 有序抖动 (无误差传播，局部修改不影响周围像素)
+    GUI_DITHER_FS,           ///< Floyd-Steinberg 误差扩散 (照片效果最好)
+} gui_dither_t;
+
+/**
+ * @brief 读取回调
+ * @param user_data 用户数据
+ * @param buf       输出缓冲区；为 NULL 时表示跳过 len 字节
+ * @param len       请求字节数
+ * @return 实际读取 (跳过) 的字节数，0 表示数据结束
+ */
+typedef uint32_t (*gui_decode_read_cb_t)(void *user_data, uint8_t *buf, uint32_t len);
+
+/**
+ * @brief 1bit 目标区域 (每行按字节对齐，MSB 在前)
+ * @details 图片放在 (x, y) 处，超出 w x h 的部分裁掉；源图大于区域时先按整数倍缩小。
+ *          区域内的每个像素都会被写入 (着墨或留白)，其余位置不变。
+ */
+typedef struct {
+    uint8_t *buf;            ///< 位图
+    uint16_t stride;         ///< 每行字节数
+    uint16_t x, y;           ///< 区域左上角 (像素)
+    uint16_t w, h;           ///< 区域大小
+    uint8_t ink;             ///< 着墨像素的位值 (LV_IMG_CF_ALPHA_1BIT 为 1，墨水屏显存为 0)
+} gui_decode_target_t;
+
+/**
+ * @brief 一次解码的结果
+ */
+typedef struct {
+    const char *format;      ///< "BMP" / "PNG" / "JPEG"
+    uint16_t src_w, src_h;   ///< 源图尺寸
+    uint16_t out_w, out_h;   ///< 写入的尺寸 (缩小、裁剪之后)
+    uint8_t scale;           ///< 总缩小倍数 (JPEG 解码缩放 x 盒式缩小)
+    uint32_t us;             ///< 解码耗时
+    uint32_t peak;           ///< 工作内存峰值 (字节，不含目标位图)
+} gui_decode_info_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 设置抖动前使用的伽马 (重新生成查找表)
+ * @param gamma 1.0 为不校正；墨水屏网点扩大明显时可适当减小
+ */
+void gui_decode_set_gamma(float gamma);
+
+/**
+ * @brief 从读取回调流式解码到 1bit 区域
+ * @param read_cb   读取回调 (HTTP 下载、文件等)
+ * @param user_data 回调的用户数据
+ * @param dst       目标区域
+ * @param dither    抖动方式
+ * @param info      输出解码结果 (可为 NULL)
+ * @return false 格式不支持、数据损坏或内存不足 (目标区域可能已部分写入)
+ */
+bool gui_decode_stream(gui_decode_read_cb_t read_cb, void *user_data, const gui_decode_target_t *dst,
+                       gui_dither_t dither, gui_decode_info_t *info);
+
+/**
+ * @brief 从内存 (或资源包映射地址) 解码到 1bit 区域
+ */
+bool gui_decode_mem(const void *data, uint32_t size, const gui_decode_target_t *dst,
+                    gui_dither_t dither, gui_decode_info_t *info);
+
+/**
+ * @brief 解码为 LV_IMG_CF_ALPHA_1BIT 图片 (可直接用于 lv_img，走 gui_img 的快速路径)
+ * @param max_w, max_h 最大尺寸 (源图更大时缩小)
+ * @return 图片 (描述符与位图同一块 PSRAM)，失败返回 NULL；用 gui_decode_img_free 释放
+ */
+lv_img_dsc_t *gui_decode_img(const void *data, uint32_t size, uint16_t max_w, uint16_t max_h,
+                             gui_dither_t dither);
+
+/**
+ * @brief 释放 gui_decode_img 返回的图片
+ */
+void gui_decode_img_free(lv_img_dsc_t *img);
+
+/**
+ * @brief 解码基准测试
+ * @details 264x176 合成测试图 (与 tools/img_dither.py --bench 相同) 以及资源包中名为
+ *          bench_bmp / bench_png / bench_jpg 的原始数据，逐一按三种抖动方式解码，
+ *          输出耗时与工作内存峰值。
+ */
+void gui_decode_bench(void);
+
+/**
+ * @brief 输出解码统计 (次数、失败数、平均耗时、内存峰值)
+ */
+void gui_decode_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_DECODE_H
@@ -0,0 +1,377 @@
+/**
+ * @file gui_fb.cpp
+ * @brief 1bit 即时模式画布实现
+ * @details
+ * 显存布局 (与 gui_port_convert_area 一致)：逻辑坐标 (x, y) 在显存第 x 行、第 y 位
+ * (每行 EPD_WIDTH 位，MSB 在前，0 为黑)。因此：
+ * - 逻辑矩形 [x1, x2] x [y1, y2] = 显存第 x1..x2 行上的同一段位区间，
+ *   每行先处理首尾不完整的字节，中间按 32 位字对齐后整字操作；
+ * - 位图的一列对应显存的一行，按显存字节边界每次收集 8 个源像素，再整字节做 ROP。
+ * 脏区域直接以显存坐标累积 (行区间 + 位区间)，提交时交给 gui_port_refresh_region。
+ */
+#include "gui_fb.h"
+#include "gui_asset.h"
+#include "gui_port.h"
+#include "common/Log.h"
+#include "ui/ui.h"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <string.h>
+
+#define FB_W        EPD_HEIGHT                  ///< 逻辑宽度 (显存行数)
+#define FB_H        EPD_WIDTH                   ///< 逻辑高度 (显存每行位数)
+#define FB_STRIDE   ((EPD_WIDTH + 7) / 8)       ///< 显存每行字节数
+
+// 脏区域 (逻辑坐标)
+static lv_area_t s_dirty;
+static bool s_dirty_valid = false;
+
+// 统计
+static uint32_t s_ops = 0;
+static uint32_t s_commits = 0;
+static uint32_t s_commit_px = 0;
+static uint32_t s_bench_lvgl_us = 0;
+static uint32_t s_bench_fb_us = 0;
+
+/**
+ * @brief 裁剪到屏幕并记入脏区域
+ * @return false 完全在屏幕外 (或显存未分配)
+ */
+static bool _clip(lv_area_t *a) {
+    static const lv_area_t screen = {0, 0, FB_W - 1, FB_H - 1};
+    if (gui_port_framebuffer() == NULL || !_lv_area_intersect(a, a, &screen)) return false;
+    if (s_dirty_valid) _lv_area_join(&s_dirty, &s_dirty, a);
+    else s_dirty = *a;
+    s_dirty_valid = true;
+    s_ops++;
+    return true;
+}
+
+/**
+ * @brief 对一个字节中 mask 选中的位做 ROP (显存中 0 为黑)
+ */
+static inline void _rop8(uint8_t *p, uint8_t mask, gui_fb_rop_t rop) {
+    switch (rop) {
+        case GUI_FB_PAPER: *p |= mask; break;
+        case GUI_FB_XOR:   *p ^= mask; break;
+        default:           *p &= ~mask; break;
+    }
+}
+
+static inline void _rop32(uint32_t *p, gui_fb_rop_t rop) {
+    switch (rop) {
+        case GUI_FB_PAPER: *p = 0xFFFFFFFF; break;
+        case GUI_FB_XOR:   *p = ~*p; break;
+        default:           *p = 0; break;
+    }
+}
+
+/**
+ * @brief 显存一行中的位区间 [b0, b1] 做 ROP
+ */
+static void _span(uint8_t *row, int b0, int b1, gui_fb_rop_t rop) {
+    int B0 = b0 >> 3, B1 = b1 >> 3;
+    uint8_t m0 = 0xFF >> (b0 & 7);
+    uint8_t m1 = 0xFF << (7 - (b1 & 7));
+    if (B0 == B1) {
+        _rop8(row + B0, m0 & m1, rop);
+        return;
+    }
+    _rop8(row + B0, m0, rop);
+    uint8_t *p = row + B0 + 1, *end = row + B1;
+    while (p < end && ((uintptr_t)p & 3)) _rop8(p++, 0xFF, rop);
+    for (; end - p >= 4; p += 4) _rop32((uint32_t *)p, rop);
+    while (p < end) _rop8(p++, 0xFF, rop);
+    _rop8(row + B1, m1, rop);
+}
+
+/**
+ * @brief 填充矩形
+ */
+void gui_fb_fill(lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h, gui_fb_rop_t rop) {
+    if (w <= 0 || h <= 0) return;
+    lv_area_t a = {x, y, (lv_coord_t)(x + w - 1), (lv_coord_t)(y + h - 1)};
+    if (!_clip(&a)) return;
+    uint8_t *fb = gui_port_framebuffer();
+    for (lv_coord_t r = a.x1; r <= a.x2; r++) _span(fb + r * FB_STRIDE, a.y1, a.y2, rop);
+}
+
+/**
+ * @brief 矩形边框
+ */
+void gui_fb_rect(lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h, gui_fb_rop_t rop) {
+    if (w <= 0 || h <= 0) return;
+    gui_fb_fill(x, y, w, 1, rop);
+    if (h > 1) gui_fb_fill(x, y + h - 1, w, 1, rop);
+    if (h > 2) {
+        gui_fb_fill(x, y + 1, 1, h - 2, rop);
+        if (w > 1) gui_fb_fill(x + w - 1, y + 1, 1, h - 2, rop);
+    }
+}
+
+/**
+ * @brief 直线
+ */
+void gui_fb_line(lv_coord_t x0, lv_coord_t y0, lv_coord_t x1, lv_coord_t y1, gui_fb_rop_t rop) {
+    if (y0 == y1 || x0 == x1) {
+        gui_fb_fill(min(x0, x1), min(y0, y1), abs(x1 - x0) + 1, abs(y1 - y0) + 1, rop);
+        return;
+    }
+    lv_area_t a = {min(x0, x1), min(y0, y1), max(x0, x1), max(y0, y1)};
+    if (!_clip(&a)) return;
+
+    uint8_t *fb = gui_port_framebuffer();
+    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    int x = x0, y = y0;
+    for (;;) {
+        if (x >= 0 && x < FB_W && y >= 0 && y < FB_H) _rop8(fb + x * FB_STRIDE + (y >> 3), 0x80 >> (y & 7), rop);
+        if (x == x1 && y == y1) break;
+        int e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x += sx; }
+        if (e2 <= dx) { err += dx; y += sy; }
+    }
+}
+
+/**
+ * @brief 位图 (bpp = 1 / 2 / 4 / 8，多 bpp 按半灰度阈值化) 写入显存
+ */
+static void _blit(lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h,
+                  const uint8_t *bits, uint32_t px_stride, uint8_t bpp, gui_fb_rop_t rop) {
+    if (bits == NULL || w <= 0 || h <= 0) return;
+    lv_area_t a = {x, y, (lv_coord_t)(x + w - 1), (lv_coord_t)(y + h - 1)};
+    if (!_clip(&a)) return;
+
+    uint8_t *fb = gui_port_framebuffer();
+    uint8_t vmask = (1 << bpp) - 1, half = (vmask + 1) >> 1;
+    for (lv_coord_t r = a.x1; r <= a.x2; r++) {
+        uint8_t *row = fb + r * FB_STRIDE;
+        uint32_t sx = r - x;
+        lv_coord_t b = a.y1;
+        while (b <= a.y2) {
+            lv_coord_t b_end = min((lv_coord_t)(b | 7), a.y2);
+            uint8_t mask = 0, ink = 0;
+            for (lv_coord_t yy = b; yy <= b_end; yy++) {
+                uint8_t m = 0x80 >> (yy & 7);
+                uint32_t i = ((uint32_t)(yy - y) * px_stride + sx) * bpp;
+                uint8_t v = (bits[i >> 3] >> (8 - bpp - (i & 7))) & vmask;
+                mask |= m;
+                if (v >= half) ink |= m;
+            }
+            uint8_t *p = row + (b >> 3);
+            switch (rop) {
+                case GUI_FB_COPY:  *p = (*p & ~mask) | (~ink & mask); break;
+                case GUI_FB_PAPER: *p |= ink; break;
+                case GUI_FB_XOR:   *p ^= ink; break;
+                default:           *p &= ~ink; break;
+            }
+            b = b_end + 1;
+        }
+    }
+}
+
+/**
+ * @brief 绘制 1bit 位图
+ */
+void gui_fb_blit_bits(lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h,
+                      const uint8_t *bits, uint32_t bit_stride, gui_fb_rop_t rop) {
+    _blit(x, y, w, h, bits, bit_stride, 1, rop);
+}
+
+/**
+ * @brief 绘制 ALPHA_1BIT 图片
+ */
+void gui_fb_blit(lv_coord_t x, lv_coord_t y, const lv_img_dsc_t *img, gui_fb_rop_t rop) {
+    if (img == NULL) return;
+    const uint8_t *bits = NULL;
+    if (img->header.cf == LV_IMG_CF_ALPHA_1BIT) bits = img->data;
+    else if (gui_asset_is_encoded(img)) bits = gui_asset_get_1bit(img);
+    if (bits == NULL) {
+        LOG_E("[FB] Unsupported image cf=%u", img->header.cf);
+        return;
+    }
+    _blit(x, y, img->header.w, img->header.h, bits, (img->header.w + 7) / 8 * 8, 1, rop);
+}
+
+/**
+ * @brief 绘制一行文字
+ */
+lv_coord_t gui_fb_text(lv_coord_t x, lv_coord_t y, const char *txt, const lv_font_t *font, gui_fb_rop_t rop) {
+    if (txt == NULL || font == NULL) return x;
+    lv_coord_t top = y + (font->line_height - font->base_line);
+    uint32_t i = 0;
+    uint32_t letter = _lv_txt_encoded_next(txt, &i);
+    while (letter != 0) {
+        uint32_t next = _lv_txt_encoded_next(txt, &i);
+        lv_font_glyph_dsc_t g;
+        if (lv_font_get_glyph_dsc(font, &g, letter, next)) {
+            if (g.box_w > 0 && g.box_h > 0 && !g.is_placeholder) {
+                const uint8_t *bmp = lv_font_get_glyph_bitmap(g.resolved_font, letter);
+                if (bmp != NULL && (g.bpp == 1 || g.bpp == 2 || g.bpp == 4 || g.bpp == 8)) {
+                    _blit(x + g.ofs_x, top - g.box_h - g.ofs_y, g.box_w, g.box_h, bmp, g.box_w, g.bpp, rop);
+                }
+            }
+            x += g.adv_w;
+        }
+        letter = next;
+    }
+    return x;
+}
+
+/**
+ * @brief 提交脏区域
+ */
+bool gui_fb_commit(epd_refresh_mode_t mode) {
+    if (!s_dirty_valid) return false;
+    // 逻辑 x -> 显存行，逻辑 y -> 显存位
+    gui_port_refresh_region(s_dirty.y1, s_dirty.x1, lv_area_get_height(&s_dirty), lv_area_get_width(&s_dirty), mode);
+    s_commits++;
+    s_commit_px += lv_area_get_size(&s_dirty);
+    s_dirty_valid = false;
+    return true;
+}
+
+/**
+ * @brief 丢弃脏区域
+ */
+void gui_fb_discard(void) {
+    s_dirty_valid = false;
+}
+
+/* --- 基准测试 --- */
+
+#define BENCH_ROUNDS 20
+#define BAR_H        20
+
+static const char *const s_bar_time = "12:34";
+static const char *const s_bar_day = "星期三";
+
+/**
+ * @brief 用 gui_fb 绘制状态栏
+ */
+static void _bar_fb(void) {
+    const lv_font_t *font = &ui_font_ChineseSong16;
+    gui_fb_fill(0, 0, FB_W, BAR_H, GUI_FB_PAPER);
+    gui_fb_line(0, BAR_H - 1, FB_W - 1, BAR_H - 1, GUI_FB_INK);
+    gui_fb_text(4, 2, s_bar_time, font, GUI_FB_INK);
+    lv_coord_t end = gui_fb_text(64, 2, s_bar_day, font, GUI_FB_INK);
+    gui_fb_fill(62, 1, end - 60, BAR_H - 3, GUI_FB_XOR);
+    for (int i = 0; i < 3; i++) gui_fb_fill(200 + i * 5, 13 - i * 3, 3, 3 + i * 3, GUI_FB_INK);
+    gui_fb_rect(232, 4, 24, 12, GUI_FB_INK);
+    gui_fb_fill(256, 8, 2, 4, GUI_FB_INK);
+    gui_fb_fill(234, 6, 14, 8, GUI_FB_INK);
+}
+
+/**
+ * @brief 用 LVGL 控件搭出同样的状态栏
+ */
+static lv_obj_t *_bar_lvgl(void) {
+    const lv_font_t *font = &ui_font_ChineseSong16;
+    lv_obj_t *bar = lv_obj_create(lv_layer_top());
+    lv_obj_remove_style_all(bar);
+    lv_obj_set_size(bar, FB_W, BAR_H);
+    lv_obj_set_style_bg_color(bar, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(bar, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_side(bar, LV_BORDER_SIDE_BOTTOM, 0);
+    lv_obj_set_style_border_width(bar, 1, 0);
+    lv_obj_set_style_border_color(bar, lv_color_black(), 0);
+
+    lv_obj_t *t = lv_label_create(bar);
+    lv_label_set_text_static(t, s_bar_time);
+    lv_obj_set_style_text_font(t, font, 0);
+    lv_obj_set_pos(t, 4, 2);
+
+    lv_obj_t *d = lv_label_create(bar);
+    lv_label_set_text_static(d, s_bar_day);
+    lv_obj_set_style_text_font(d, font, 0);
+    lv_obj_set_style_text_color(d, lv_color_white(), 0);
+    lv_obj_set_style_bg_color(d, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(d, LV_OPA_COVER, 0);
+    lv_obj_set_style_pad_hor(d, 2, 0);
+    lv_obj_set_style_pad_ver(d, 1, 0);
+    lv_obj_set_pos(d, 62, 1);
+
+    for (int i = 0; i < 3; i++) {
+        lv_obj_t *s = lv_obj_create(bar);
+        lv_obj_remove_style_all(s);
+        lv_obj_set_style_bg_color(s, lv_color_black(), 0);
+        lv_obj_set_style_bg_opa(s, LV_OPA_COVER, 0);
+        lv_obj_set_pos(s, 200 + i * 5, 13 - i * 3);
+        lv_obj_set_size(s, 3, 3 + i * 3);
+    }
+
+    lv_obj_t *batt = lv_obj_create(bar);
+    lv_obj_remove_style_all(batt);
+    lv_obj_set_style_border_width(batt, 1, 0);
+    lv_obj_set_style_border_color(batt, lv_color_black(), 0);
+    lv_obj_set_pos(batt, 232, 4);
+    lv_obj_set_size(batt, 24, 12);
+
+    lv_obj_t *nub = lv_obj_create(bar);
+    lv_obj_remove_style_all(nub);
+    lv_obj_set_style_bg_color(nub, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(nub, LV_OPA_COVER, 0);
+    lv_obj_set_pos(nub, 256, 8);
+    lv_obj_set_size(nub, 2, 4);
+
+    lv_obj_t *lvl = lv_obj_create(bar);
+    lv_obj_remove_style_all(lvl);
+    lv_obj_set_style_bg_color(lvl, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(lvl, LV_OPA_COVER, 0);
+    lv_obj_set_pos(lvl, 234, 6);
+    lv_obj_set_size(lvl, 14, 8);
+    return bar;
+}
+
+/**
+ * @brief 状态栏基准测试
+ */
+void gui_fb_bench(void) {
+    uint8_t *fb = gui_port_framebuffer();
+    if (fb == NULL) return;
+    const uint32_t fb_size = FB_STRIDE * EPD_HEIGHT;
+    uint8_t *saved = (uint8_t *)heap_caps_malloc(fb_size, MALLOC_CAP_SPIRAM);
+    if (saved == NULL) return;
+
+    lv_refr_now(NULL);
+    memcpy(saved, fb, fb_size);
+    gui_port_hold_refresh(true);
+
+    // LVGL: 创建控件 + 布局 + 16bit 渲染 + 1bit 转换 (创建控件的开销单独计)
+    uint32_t lvgl_us = 0, create_us = 0;
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        uint32_t t0 = micros();
+        lv_obj_t *bar = _bar_lvgl();
+        uint32_t t1 = micros();
+        lv_refr_now(NULL);
+        lvgl_us += micros() - t1;
+        create_us += t1 - t0;
+        lv_obj_del(bar);
+        lv_refr_now(NULL);
+    }
+
+    // gui_fb: 直接写显存
+    uint32_t t0 = micros();
+    for (int r = 0; r < BENCH_ROUNDS; r++) _bar_fb();
+    uint32_t fb_us = micros() - t0;
+    gui_fb_discard();
+
+    memcpy(fb, saved, fb_size);
+    heap_caps_free(saved);
+    gui_port_hold_refresh(false);
+
+    s_bench_lvgl_us = lvgl_us / BENCH_ROUNDS;
+    s_bench_fb_us = fb_us / BENCH_ROUNDS;
+    LOG_I("[FB] Status bar %dx%d: LVGL render+convert %lu us (+%lu us create), gui_fb %lu us (%lux)",
+          FB_W, BAR_H, s_bench_lvgl_us, create_us / BENCH_ROUNDS, s_bench_fb_us,
+          s_bench_fb_us ? s_bench_lvgl_us / s_bench_fb_us : 0);
+}
+
+/**
+ * @brief 输出绘制统计
+ */
+void gui_fb_report(void) {
+    LOG_I("[FB] ops=%lu commits=%lu avg commit area=%lu px, bench LVGL %lu us vs gui_fb %lu us",
+          s_ops, s_commits, s_commits ? s_commit_px / s_commits : 0, s_bench_lvgl_us, s_bench_fb_us);
+}
@@ -0,0 +1,102 @@
+/**
+ * @file gui_fb.h
+ * @brief 直接在墨水屏显存上绘制的 1bit 即时模式画布
+ * @details 状态栏、表盘、调试 HUD 这类简单图形走 LVGL 要经过 16bit 渲染缓冲再逐像素转换为 1bit，
+ *          而它们只需要几条线、几个矩形和一行字。本模块直接修改 Paint_Image：
+ *          - 坐标与 LVGL 相同 (横屏逻辑坐标，264x176)，内部换算到墨水屏原生方向；
+ *          - 逻辑坐标的一列对应显存中的一行，矩形填充按行做字节 / 32 位字宽的 ROP；
+ *            位图与字形按字节收集后整字节写入；
+ *          - 每次绘制累积脏区域，gui_fb_commit 只把这块区域交给刷屏线程 (不做整帧比较)。
+ *          画布与 LVGL 共用显存：LVGL 之后重绘同一区域会覆盖画布内容，适合画在 LVGL 不会重绘的位置，
+ *          或在 LVGL 刷新之后重新绘制。所有接口只在 GUI 线程中调用。
+ */
+#ifndef GUI_FB_H
+#define GUI_FB_H
+
+#include <lvgl.h>
+#include <stdint.h>
+#include "bsp/bsp_epd.h"
+
+// 启动时对比 LVGL 与 gui_fb 绘制同一个状态栏的耗时
+#ifndef GUI_FB_BENCH
+#define GUI_FB_BENCH 0
+#endif
+
+/**
+ * @brief 光栅操作
+ */
+typedef enum {
+    GUI_FB_INK = 0,    ///< 着墨 (黑)；位图只画源中着墨的像素
+    GUI_FB_PAPER,      ///< 留白 (白)；位图把源中着墨的像素擦成白色
+    GUI_FB_XOR,        ///< 反色；位图只反转源中着墨的像素
+    GUI_FB_COPY,       ///< 位图整块覆盖 (着墨为黑，其余为白)；填充时等同 GUI_FB_INK
+} gui_fb_rop_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 填充矩形
+ */
+void gui_fb_fill(lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h, gui_fb_rop_t rop);
+
+/**
+ * @brief 矩形边框 (1 像素)
+ */
+void gui_fb_rect(lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h, gui_fb_rop_t rop);
+
+/**
+ * @brief 直线 (水平 / 垂直线按矩形填充，其余用 Bresenham)
+ */
+void gui_fb_line(lv_coord_t x0, lv_coord_t y0, lv_coord_t x1, lv_coord_t y1, gui_fb_rop_t rop);
+
+/**
+ * @brief 绘制 1bit 位图
+ * @param bits       位图 (MSB 在前，1 = 着墨)
+ * @param bit_stride 每行的位数 (按字节对齐的图片为 ((w + 7) / 8) * 8，LVGL 字形为 w)
+ */
+void gui_fb_blit_bits(lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h,
+                      const uint8_t *bits, uint32_t bit_stride, gui_fb_rop_t rop);
+
+/**
+ * @brief 绘制 LV_IMG_CF_ALPHA_1BIT 图片 (或 gui_asset 的压缩图片)
+ */
+void gui_fb_blit(lv_coord_t x, lv_coord_t y, const lv_img_dsc_t *img, gui_fb_rop_t rop);
+
+/**
+ * @brief 绘制一行文字 (不换行)
+ * @param x, y 行框左上角 (与 lv_label 相同)
+ * @param font 字体 (1bpp 直接绘制；多 bpp 字体按半灰度阈值化)
+ * @return 文字末端的 x 坐标
+ */
+lv_coord_t gui_fb_text(lv_coord_t x, lv_coord_t y, const char *txt, const lv_font_t *font, gui_fb_rop_t rop);
+
+/**
+ * @brief 提交累积的脏区域并请求刷新
+ * @param mode 刷新方式 (状态栏一类的小区域通常用 EPD_REFRESH_PARTIAL)
+ * @return false 自上次提交以来没有绘制
+ */
+bool gui_fb_commit(epd_refresh_mode_t mode);
+
+/**
+ * @brief 丢弃累积的脏区域 (显存内容已由其他途径刷新时使用)
+ */
+void gui_fb_discard(void);
+
+/**
+ * @brief 状态栏基准测试：同样的内容分别用 LVGL 控件与 gui_fb 绘制，输出耗时
+ * @details 测试期间扣住刷屏，结束后恢复显存，不产生实际刷新。须在首页显示之后调用。
+ */
+void gui_fb_bench(void);
+
+/**
+ * @brief 输出绘制统计 (操作数、提交次数、提交区域面积、基准结果)
+ */
+void gui_fb_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_FB_H
@@ -0,0 +1,265 @@
+/**
+ * @file gui_font.cpp
+ * @brief 1bpp 字体快速绘制与字形索引实现
+ * @details
+ * 快速路径的条件：
+ * - 字形所在字体 (含 fallback 后的 resolved_font) 是 lv_font_fmt_txt 格式、bpp == 1、未压缩；
+ * - 文字不透明 (opa >= LV_OPA_MAX)，普通混合模式，且当前没有绘制遮罩 (圆角裁剪等)。
+ * 字形定位与 lv_draw_sw_letter 一致，字形位图逐行连续存放 (行间不补齐)，MSB 在前。
+ * 渲染缓冲区最终由 disp_flush 转换为 1bit，所以这里直接写入文字颜色即可。
+ *
+ * 字形索引的查表结果与 lv_font_get_glyph_dsc_fmt_txt 逐字段一致 (含 '\t' 按两个空格处理)。
+ */
+#include "gui_font.h"
+#include "gui_font_stream.h"
+#include "common/Log.h"
+#include <Arduino.h>
+
+static void (*s_sw_draw_letter)(lv_draw_ctx_t *draw_ctx, const lv_draw_label_dsc_t *dsc,
+                                const lv_point_t *pos_p, uint32_t letter) = NULL;
+
+// 统计
+static uint32_t s_fast_glyphs = 0;
+static uint32_t s_fast_us = 0;
+static uint32_t s_sw_glyphs = 0;
+static uint32_t s_sw_us = 0;
+static uint32_t s_index_lookups = 0;
+static uint32_t s_index_misses = 0;
+
+/**
+ * @brief 32 位整数混合 (须与 tools/font_index.py 的 mix() 一致)
+ */
+static inline uint32_t _mix(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+    return x;
+}
+
+/**
+ * @brief 完美哈希查字形 id
+ * @return 字形 id，未收录返回 0
+ */
+static uint32_t _index_lookup(const gui_font_index_t *idx, uint32_t letter) {
+    if (letter == 0 || letter > 0xFFFF) return 0;
+    uint32_t seed = idx->seeds[_mix(letter) & idx->bucket_mask];
+    uint32_t slot = _mix(letter + (seed + 1) * 0x9E3779B9u) & idx->size_mask;
+    return idx->keys[slot] == letter ? idx->gids[slot] : 0;
+}
+
+/**
+ * @brief 字体是否为未压缩的 1bpp 字体 (lv_font_fmt_txt 或流式字体)
+ */
+static bool _is_plain_1bpp(const lv_font_t *font) {
+    if (font == NULL) return false;
+    if (font->get_glyph_bitmap == gui_font_stream_get_bitmap) return true;  // 流式字体固定为 1bpp
+    if (font->get_glyph_bitmap != lv_font_get_bitmap_fmt_txt &&
+        font->get_glyph_bitmap != gui_font_get_bitmap_indexed) return false;
+    const lv_font_fmt_txt_dsc_t *fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+    return fdsc->bpp == 1 && fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN;
+}
+
+/**
+ * @brief 按位把字形写入渲染缓冲区
+ * @return false 不满足快速路径条件，需交给 LVGL
+ */
+static bool _blit_1bpp(lv_draw_ctx_t *draw_ctx, const lv_draw_label_dsc_t *dsc,
+                       const lv_point_t *pos_p, uint32_t letter) {
+    if (dsc->opa < LV_OPA_MAX || dsc->blend_mode != LV_BLEND_MODE_NORMAL) return false;
+
+    lv_font_glyph_dsc_t g;
+    if (!lv_font_get_glyph_dsc(dsc->font, &g, letter, '\0')) return false;  // 缺字占位框由 LVGL 画
+    if (!_is_plain_1bpp(g.resolved_font) || g.resolved_font->subpx != LV_FONT_SUBPX_NONE) return false;
+    if (g.box_w == 0 || g.box_h == 0) return true;
+
+    lv_area_t glyph;
+    glyph.x1 = pos_p->x + g.ofs_x;
+    glyph.y1 = pos_p->y + (dsc->font->line_height - dsc->font->base_line) - g.box_h - g.ofs_y;
+    glyph.x2 = glyph.x1 + g.box_w - 1;
+    glyph.y2 = glyph.y1 + g.box_h - 1;
+
+    lv_area_t clip;
+    if (!_lv_area_intersect(&clip, draw_ctx->clip_area, &glyph)) return true;
+    if (lv_draw_mask_is_any(&clip)) return false;
+
+    const uint8_t *map = lv_font_get_glyph_bitmap(g.resolved_font, letter);
+    if (map == NULL) return true;
+
+    lv_color_t *buf = (lv_color_t *)draw_ctx->buf;
+    const lv_area_t *buf_area = draw_ctx->buf_area;
+    lv_coord_t stride = lv_area_get_width(buf_area);
+    lv_color_t color = dsc->color;
+
+    for (lv_coord_t y = clip.y1; y <= clip.y2; y++) {
+        uint32_t bit = (uint32_t)(y - glyph.y1) * g.box_w + (clip.x1 - glyph.x1);
+        lv_color_t *dst = buf + (y - buf_area->y1) * stride + (clip.x1 - buf_area->x1);
+        for (lv_coord_t x = clip.x1; x <= clip.x2; x++, bit++, dst++) {
+            if (map[bit >> 3] & (0x80 >> (bit & 7))) *dst = color;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 替换后的 draw_letter
+ */
+static void _draw_letter(lv_draw_ctx_t *draw_ctx, const lv_draw_label_dsc_t *dsc,
+                         const lv_point_t *pos_p, uint32_t letter) {
+    uint32_t t0 = micros();
+#if GUI_FONT_FAST_BLIT
+    if (_blit_1bpp(draw_ctx, dsc, pos_p, letter)) {
+        s_fast_us += micros() - t0;
+        s_fast_glyphs++;
+        return;
+    }
+#endif
+    s_sw_draw_letter(draw_ctx, dsc, pos_p, letter);
+    s_sw_us += micros() - t0;
+    s_sw_glyphs++;
+}
+
+/**
+ * @brief 替换绘制上下文的 draw_letter
+ */
+void gui_font_install(lv_draw_ctx_t *draw_ctx) {
+    s_sw_draw_letter = draw_ctx->draw_letter;
+    draw_ctx->draw_letter = _draw_letter;
+}
+
+/**
+ * @brief 查表版 get_glyph_dsc
+ */
+bool gui_font_get_glyph_dsc_indexed(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out,
+                                    uint32_t unicode_letter, uint32_t unicode_letter_next) {
+    const lv_font_fmt_txt_dsc_t *fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+    const gui_font_index_t *idx = (const gui_font_index_t *)font->user_data;
+    if (idx == NULL || fdsc->kern_dsc != NULL) {
+        return lv_font_get_glyph_dsc_fmt_txt(font, dsc_out, unicode_letter, unicode_letter_next);
+    }
+
+    bool is_tab = false;
+    if (unicode_letter == '\t') {
+        is_tab = true;
+        unicode_letter = ' ';
+    }
+
+    s_index_lookups++;
+    uint32_t gid = _index_lookup(idx, unicode_letter);
+    if (gid == 0) {
+        s_index_misses++;
+        return false;
+    }
+
+    const lv_font_fmt_txt_glyph_dsc_t *gdsc = &fdsc->glyph_dsc[gid];
+    uint32_t adv_w = gdsc->adv_w;
+    if (is_tab) adv_w *= 2;
+
+    dsc_out->adv_w = (adv_w + (1 << 3)) >> 4;
+    dsc_out->box_h = gdsc->box_h;
+    dsc_out->box_w = is_tab ? gdsc->box_w * 2 : gdsc->box_w;
+    dsc_out->ofs_x = gdsc->ofs_x;
+    dsc_out->ofs_y = gdsc->ofs_y;
+    dsc_out->bpp = (uint8_t)fdsc->bpp;
+    dsc_out->is_placeholder = false;
+    return true;
+}
+
+/**
+ * @brief 查表版 get_glyph_bitmap
+ */
+const uint8_t *gui_font_get_bitmap_indexed(const lv_font_t *font, uint32_t unicode_letter) {
+    const lv_font_fmt_txt_dsc_t *fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+    const gui_font_index_t *idx = (const gui_font_index_t *)font->user_data;
+    if (idx == NULL || fdsc->bitmap_format != LV_FONT_FMT_TXT_PLAIN) {
+        return lv_font_get_bitmap_fmt_txt(font, unicode_letter);
+    }
+
+    if (unicode_letter == '\t') unicode_letter = ' ';
+    uint32_t gid = _index_lookup(idx, unicode_letter);
+    if (gid == 0) return NULL;
+    return &fdsc->glyph_bitmap[fdsc->glyph_dsc[gid].bitmap_index];
+}
+
+/* --- 基准测试 --- */
+
+#define BENCH_MAX_LETTERS 512
+#define BENCH_ROUNDS      50
+
+typedef struct {
+    const lv_font_t *font;
+    uint32_t letter;
+} bench_item_t;
+
+/**
+ * @brief 收集页面上使用了字形索引的文字
+ */
+static void _bench_collect(lv_obj_t *obj, bench_item_t *items, uint32_t *cnt) {
+    const char *txt = NULL;
+    if (lv_obj_check_type(obj, &lv_label_class)) txt = lv_label_get_text(obj);
+#if LV_USE_TEXTAREA
+    else if (lv_obj_check_type(obj, &lv_textarea_class)) txt = lv_textarea_get_text(obj);
+#endif
+
+    const lv_font_t *font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    if (txt != NULL && font != NULL && font->get_glyph_dsc == gui_font_get_glyph_dsc_indexed) {
+        uint32_t i = 0;
+        while (txt[i] != '\0' && *cnt < BENCH_MAX_LETTERS) {
+            items[*cnt].font = font;
+            items[*cnt].letter = _lv_txt_encoded_next(txt, &i);
+            (*cnt)++;
+        }
+    }
+
+    uint32_t n = lv_obj_get_child_cnt(obj);
+    for (uint32_t c = 0; c < n; c++) _bench_collect(lv_obj_get_child(obj, c), items, cnt);
+}
+
+/**
+ * @brief 字形查找基准测试
+ */
+void gui_font_bench_screen(lv_obj_t *scr, const char *tag) {
+    static bench_item_t items[BENCH_MAX_LETTERS];
+    uint32_t cnt = 0;
+    _bench_collect(scr, items, &cnt);
+    if (cnt == 0) return;
+
+    lv_font_glyph_dsc_t g;
+    uint32_t found = 0;
+    uint32_t lookups_before = s_index_lookups;
+
+    uint32_t t0 = micros();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        for (uint32_t i = 0; i < cnt; i++) {
+            found += gui_font_get_glyph_dsc_indexed(items[i].font, &g, items[i].letter, 0);
+        }
+    }
+    uint32_t t_index = micros() - t0;
+
+    t0 = micros();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        for (uint32_t i = 0; i < cnt; i++) {
+            found -= lv_font_get_glyph_dsc_fmt_txt(items[i].font, &g, items[i].letter, 0);
+        }
+    }
+    uint32_t t_lvgl = micros() - t0;
+    s_index_lookups = lookups_before;   // 基准测试不计入运行统计
+
+    uint32_t total = cnt * BENCH_ROUNDS;
+    LOG_I("[Font] Bench %s: %lu letters x %d, index %lu k/s, lvgl %lu k/s%s",
+          tag ? tag : "screen", cnt, BENCH_ROUNDS,
+          t_index ? (uint32_t)((uint64_t)total * 1000 / t_index) : 0,
+          t_lvgl ? (uint32_t)((uint64_t)total * 1000 / t_lvgl) : 0,
+          found != 0 ? " (MISMATCH)" : "");
+}
+
+/**
+ * @brief 输出字形绘制统计
+ */
+void gui_font_report(void) {
+    LOG_I("[Font] fast glyphs=%lu avg=%lu us, lvgl glyphs=%lu avg=%lu us, index lookups=%lu misses=%lu",
+          s_fast_glyphs, s_fast_glyphs ? s_fast_us / s_fast_glyphs : 0,
+          s_sw_glyphs, s_sw_glyphs ? s_sw_us / s_sw_glyphs : 0,
+          s_index_lookups, s_index_misses);
+}
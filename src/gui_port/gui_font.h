@@ -0,0 +1,82 @@
+/**
+ * @file gui_font.h
+ * @brief 1bpp 字体快速绘制与 O(1) 字形索引
+ * @details LVGL 的软件渲染按字体 bpp 生成 8bit 透明度遮罩，再逐像素与背景混合。
+ *          对 1bpp 字体 (见 tools/font_1bpp.py) 来说遮罩只有 0 / 255 两种值，混合毫无意义。
+ *          本模块替换绘制上下文的 draw_letter：1bpp、不透明、无遮罩的字形按位直接写入渲染缓冲区，
+ *          其余情况 (4bpp 字体、半透明、圆角裁剪等) 仍交给 LVGL 原实现。
+ *
+ *          字形索引：lv_font_fmt_txt 的稀疏 cmap 每个字符二分查找一次，取位图时再查一次。
+ *          tools/font_index.py 在构建前生成完美哈希表并写入字体文件，
+ *          字体的 get_glyph_dsc / get_glyph_bitmap 改用本模块的查表实现，一次哈希即可定位字形。
+ */
+#ifndef GUI_FONT_H
+#define GUI_FONT_H
+
+#include <lvgl.h>
+
+// 快速字形绘制开关 (0: 全部交给 LVGL，仅用于对比渲染耗时)
+#ifndef GUI_FONT_FAST_BLIT
+#define GUI_FONT_FAST_BLIT 1
+#endif
+
+// 页面构建后对页面上的文字做一次字形查找基准测试 (查表 vs LVGL 二分查找)
+#ifndef GUI_FONT_BENCH
+#define GUI_FONT_BENCH 0
+#endif
+
+/**
+ * @brief 字形索引 (完美哈希，由 tools/font_index.py 生成，挂在 lv_font_t::user_data 上)
+ * @details bucket = mix(c) & bucket_mask; slot = mix(c + (seeds[bucket] + 1) * 0x9E3779B9) & size_mask;
+ *          keys[slot] == c 时 gids[slot] 即字形 id。
+ */
+typedef struct {
+    uint16_t size_mask;      ///< 槽位数 - 1 (槽位数为 2 的幂)
+    uint16_t bucket_mask;    ///< 桶数 - 1
+    const uint8_t *seeds;    ///< 每个桶的位移种子
+    const uint16_t *keys;    ///< 槽位中的 unicode (0 为空槽)
+    const uint16_t *gids;    ///< 槽位对应的字形 id
+} gui_font_index_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 替换绘制上下文的 draw_letter
+ * @details 须在 lv_draw_sw_init_ctx 之后调用 (gui_port 的 draw_ctx_init 中)。
+ */
+void gui_font_install(lv_draw_ctx_t *draw_ctx);
+
+/**
+ * @brief 查表版 get_glyph_dsc (字体文件中由 tools/font_index.py 设置)
+ * @details 结果与 lv_font_get_glyph_dsc_fmt_txt 相同；带字距表的字体交给 LVGL 原实现。
+ */
+bool gui_font_get_glyph_dsc_indexed(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out,
+                                    uint32_t unicode_letter, uint32_t unicode_letter_next);
+
+/**
+ * @brief 查表版 get_glyph_bitmap
+ * @details 压缩字体交给 LVGL 原实现 (需要解压缓冲)。
+ */
+const uint8_t *gui_font_get_bitmap_indexed(const lv_font_t *font, uint32_t unicode_letter);
+
+/**
+ * @brief 字形查找基准测试
+ * @param scr 页面，收集其中所有 label / textarea 的文字
+ * @param tag 日志标签 (可为 NULL)
+ * @details 对收集到的字符分别用查表与 LVGL 二分查找各重复查找若干轮，输出每秒查找次数。
+ *          只统计使用了字形索引的字体；GUI_FONT_BENCH 为 1 时页面构建后自动调用。
+ */
+void gui_font_bench_screen(lv_obj_t *scr, const char *tag);
+
+/**
+ * @brief 输出字形绘制统计 (快速路径 / LVGL 路径的字形数与平均耗时、索引查找次数)
+ */
+void gui_font_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_FONT_H
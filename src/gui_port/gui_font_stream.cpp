@@ -0,0 +1,406 @@
+/**
+ * @file gui_font_stream.cpp
+ * @brief 流式字体实现
+ * @details
+ * 镜像格式见 tools/font_pack.py。查字流程：
+ * 1. 页目录 (256 项，挂载时读入内存) 按 unicode 高字节找到页表；
+ * 2. 读页表项 (4 B) 得到字形记录偏移，再读字形记录 (6 B 头 + 1bpp 位图)。
+ * 缓存：固定槽位，槽位位图大小按镜像头中的最大字形尺寸分配；
+ * 哈希桶 + 链表定位，双向链表维护 LRU。字体中没有的字也缓存 ("缺字" 槽位)，
+ * 避免 fallback 字体的字每次渲染都去读 flash。
+ * 映射模式：资源包 (gui_pack) 中带有 EPF1 字体时，镜像已整体映射到地址空间，
+ * 页表项与字形记录直接按地址读取，位图返回映射地址本身，不分配缓存、不拷贝。
+ * 所有接口只在 GUI 线程中调用，不加锁。
+ */
+#include "gui_font_stream.h"
+#include "gui_pack.h"
+#include "common/Log.h"
+#include <Arduino.h>
+#include <esp_partition.h>
+
+#define EPF_MAGIC   "EPF1"
+#define SLOT_NONE   0xFFFF
+
+/**
+ * @brief 镜像头部
+ */
+typedef struct __attribute__((packed)) {
+    char magic[4];
+    uint16_t version;
+    uint8_t line_height;
+    uint8_t base_line;
+    uint32_t glyph_count;
+    uint8_t max_box_w;
+    uint8_t max_box_h;
+    uint16_t reserved;
+    uint32_t dir_offset;
+    uint32_t image_size;
+} epf_header_t;
+
+/**
+ * @brief 字形记录头部 (后接 1bpp 位图)
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t adv_w;
+    uint8_t box_w;
+    uint8_t box_h;
+    int8_t ofs_x;
+    int8_t ofs_y;
+    uint8_t reserved;
+} epf_glyph_t;
+
+/**
+ * @brief 缓存槽位
+ */
+typedef struct {
+    uint32_t letter;
+    epf_glyph_t g;
+    bool used;
+    bool missing;       ///< 字体中没有该字
+    uint16_t prev;      ///< LRU 链表 (靠近 s_mru 为最近使用)
+    uint16_t next;
+    uint16_t hnext;     ///< 哈希桶链表
+} slot_t;
+
+static const esp_partition_t *s_part = NULL;
+static epf_header_t s_hdr;
+static uint32_t s_dir[256];             ///< 页目录
+static lv_font_t s_font;
+static bool s_mounted = false;
+static const uint8_t *s_map = NULL;     ///< 映射模式下的镜像地址 (资源包内)
+
+static slot_t *s_slots = NULL;
+static uint8_t *s_bitmaps = NULL;       ///< 槽位位图 (每槽 s_slot_bytes)
+static uint16_t s_slot_bytes = 0;
+static uint16_t s_buckets[FONT_STREAM_CACHE_SLOTS];
+static uint16_t s_mru = SLOT_NONE;
+static uint16_t s_lru = SLOT_NONE;
+
+// 统计
+static uint32_t s_hits = 0;
+static uint32_t s_misses = 0;
+static uint32_t s_miss_us = 0;
+static uint32_t s_read_bytes = 0;
+
+static const char *const s_sample_page =
+    "今天福州多云，气温十二到十八摄氏度，东北风三级。"
+    "明天阴转小雨，出门请带好雨具，注意保暖。"
+    "备忘：上午九点部门例会，讨论下季度产品规划；"
+    "下午两点去银行办理账户业务，顺路取快递。"
+    "晚上复习英语单词，完成三篇阅读理解练习，"
+    "周末和朋友去鼓山爬山，记得提前预订门票。"
+    "本周空气质量良好，适宜户外运动和开窗通风。";
+
+static inline uint16_t _bucket(uint32_t letter) {
+    return (uint16_t)((letter * 2654435761u) >> 16) & (FONT_STREAM_CACHE_SLOTS - 1);
+}
+
+static inline uint8_t *_bitmap_of(uint16_t i) {
+    return s_bitmaps + (uint32_t)i * s_slot_bytes;
+}
+
+/**
+ * @brief 从 LRU 链表中摘下槽位
+ */
+static void _lru_unlink(uint16_t i) {
+    slot_t *s = &s_slots[i];
+    if (s->prev != SLOT_NONE) s_slots[s->prev].next = s->next; else s_mru = s->next;
+    if (s->next != SLOT_NONE) s_slots[s->next].prev = s->prev; else s_lru = s->prev;
+}
+
+/**
+ * @brief 槽位移到最近使用端
+ */
+static void _lru_touch(uint16_t i) {
+    if (s_mru == i) return;
+    _lru_unlink(i);
+    s_slots[i].prev = SLOT_NONE;
+    s_slots[i].next = s_mru;
+    if (s_mru != SLOT_NONE) s_slots[s_mru].prev = i;
+    s_mru = i;
+    if (s_lru == SLOT_NONE) s_lru = i;
+}
+
+/**
+ * @brief 从哈希桶中移除槽位
+ */
+static void _hash_remove(uint16_t i) {
+    uint16_t *link = &s_buckets[_bucket(s_slots[i].letter)];
+    while (*link != SLOT_NONE) {
+        if (*link == i) {
+            *link = s_slots[i].hnext;
+            return;
+        }
+        link = &s_slots[*link].hnext;
+    }
+}
+
+/**
+ * @brief 清空缓存 (全部槽位串成 LRU 链表)
+ */
+static void _cache_reset(void) {
+    for (uint16_t i = 0; i < FONT_STREAM_CACHE_SLOTS; i++) {
+        s_buckets[i] = SLOT_NONE;
+        s_slots[i].used = false;
+        s_slots[i].prev = i == 0 ? SLOT_NONE : i - 1;
+        s_slots[i].next = i + 1 == FONT_STREAM_CACHE_SLOTS ? SLOT_NONE : i + 1;
+        s_slots[i].hnext = SLOT_NONE;
+    }
+    s_mru = 0;
+    s_lru = FONT_STREAM_CACHE_SLOTS - 1;
+}
+
+/**
+ * @brief 从分区读取字形到槽位
+ */
+static void _load(slot_t *s, uint16_t i, uint32_t letter) {
+    s->missing = true;
+    if (letter > 0xFFFF || s_dir[letter >> 8] == 0) return;
+
+    uint32_t rec = 0;
+    if (esp_partition_read(s_part, s_dir[letter >> 8] + (letter & 0xFF) * 4, &rec, sizeof(rec)) != ESP_OK) return;
+    s_read_bytes += sizeof(rec);
+    if (rec == 0 || rec + sizeof(epf_glyph_t) > s_hdr.image_size) return;
+
+    if (esp_partition_read(s_part, rec, &s->g, sizeof(epf_glyph_t)) != ESP_OK) return;
+    uint32_t n = ((uint32_t)s->g.box_w * s->g.box_h + 7) / 8;
+    if (n > s_slot_bytes) return;
+    if (n > 0 && esp_partition_read(s_part, rec + sizeof(epf_glyph_t), _bitmap_of(i), n) != ESP_OK) return;
+    s_read_bytes += sizeof(epf_glyph_t) + n;
+    s->missing = false;
+}
+
+/**
+ * @brief 查找字形 (未命中时淘汰最久未用的槽位并从 flash 读取)
+ * @return 槽位序号
+ */
+static uint16_t _fetch(uint32_t letter) {
+    for (uint16_t i = s_buckets[_bucket(letter)]; i != SLOT_NONE; i = s_slots[i].hnext) {
+        if (s_slots[i].letter == letter) {
+            s_hits++;
+            _lru_touch(i);
+            return i;
+        }
+    }
+
+    uint32_t t0 = micros();
+    uint16_t i = s_lru;
+    slot_t *s = &s_slots[i];
+    if (s->used) _hash_remove(i);
+
+    s->letter = letter;
+    s->used = true;
+    _load(s, i, letter);
+
+    uint16_t b = _bucket(letter);
+    s->hnext = s_buckets[b];
+    s_buckets[b] = i;
+    _lru_touch(i);
+
+    s_misses++;
+    s_miss_us += micros() - t0;
+    return i;
+}
+
+/**
+ * @brief 映射模式下查找字形记录
+ * @return 字形记录 (其后紧跟位图)，字体中没有该字返回 NULL
+ */
+static const epf_glyph_t *_mapped(uint32_t letter) {
+    if (letter > 0xFFFF || s_dir[letter >> 8] == 0) return NULL;
+    uint32_t rec;
+    memcpy(&rec, s_map + s_dir[letter >> 8] + (letter & 0xFF) * 4, sizeof(rec));
+    if (rec == 0 || rec + sizeof(epf_glyph_t) > s_hdr.image_size) return NULL;
+    const epf_glyph_t *g = (const epf_glyph_t *)(s_map + rec);
+    if (rec + sizeof(epf_glyph_t) + ((uint32_t)g->box_w * g->box_h + 7) / 8 > s_hdr.image_size) return NULL;
+    return g;
+}
+
+/**
+ * @brief 流式字体的 get_glyph_dsc
+ */
+bool gui_font_stream_get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out,
+                                   uint32_t unicode_letter, uint32_t unicode_letter_next) {
+    LV_UNUSED(font);
+    LV_UNUSED(unicode_letter_next);
+    bool is_tab = unicode_letter == '\t';
+    if (is_tab) unicode_letter = ' ';
+
+    const epf_glyph_t *g;
+    if (s_map != NULL) {
+        g = _mapped(unicode_letter);
+        s_hits++;
+        if (g == NULL) return false;
+    } else {
+        const slot_t *s = &s_slots[_fetch(unicode_letter)];
+        if (s->missing) return false;
+        g = &s->g;
+    }
+
+    dsc_out->adv_w = is_tab ? g->adv_w * 2 : g->adv_w;
+    dsc_out->box_w = is_tab ? g->box_w * 2 : g->box_w;
+    dsc_out->box_h = g->box_h;
+    dsc_out->ofs_x = g->ofs_x;
+    dsc_out->ofs_y = g->ofs_y;
+    dsc_out->bpp = 1;
+    dsc_out->is_placeholder = false;
+    return true;
+}
+
+/**
+ * @brief 流式字体的 get_glyph_bitmap
+ */
+const uint8_t *gui_font_stream_get_bitmap(const lv_font_t *font, uint32_t unicode_letter) {
+    LV_UNUSED(font);
+    if (unicode_letter == '\t') unicode_letter = ' ';
+    if (s_map != NULL) {
+        const epf_glyph_t *g = _mapped(unicode_letter);
+        return g == NULL ? NULL : (const uint8_t *)(g + 1);
+    }
+    uint16_t i = _fetch(unicode_letter);
+    return s_slots[i].missing ? NULL : _bitmap_of(i);
+}
+
+/**
+ * @brief 填写 lv_font_t 并标记为已挂载
+ */
+static void _setup_font(const lv_font_t *fallback) {
+    lv_memset_00(&s_font, sizeof(s_font));
+    s_font.get_glyph_dsc = gui_font_stream_get_glyph_dsc;
+    s_font.get_glyph_bitmap = gui_font_stream_get_bitmap;
+    s_font.line_height = s_hdr.line_height;
+    s_font.base_line = s_hdr.base_line;
+    s_font.subpx = LV_FONT_SUBPX_NONE;
+    s_font.underline_position = -1;
+    s_font.underline_thickness = 1;
+    s_font.fallback = fallback;
+    s_mounted = true;
+}
+
+/**
+ * @brief 挂载流式字体
+ */
+const lv_font_t *gui_font_stream_init(const lv_font_t *fallback) {
+    if (s_mounted) return &s_font;
+
+    uint32_t map_size = 0;
+    const uint8_t *map = (const uint8_t *)gui_pack_find("font", GUI_PACK_FMT_EPF1, &map_size);
+    if (map != NULL) {
+        memcpy(&s_hdr, map, sizeof(s_hdr));
+        if (map_size >= sizeof(s_hdr) && memcmp(s_hdr.magic, EPF_MAGIC, 4) == 0 && s_hdr.version == 1 &&
+            s_hdr.image_size <= map_size && s_hdr.dir_offset + sizeof(s_dir) <= s_hdr.image_size) {
+            memcpy(s_dir, map + s_hdr.dir_offset, sizeof(s_dir));
+            s_map = map;
+            _setup_font(fallback);
+            LOG_I("[FontStream] %lu glyphs, %u px line, mapped from asset pack (no cache)",
+                  s_hdr.glyph_count, s_hdr.line_height);
+            return &s_font;
+        }
+        LOG_E("[FontStream] Invalid font in asset pack, trying '%s' partition", FONT_STREAM_PARTITION);
+    }
+
+    s_part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, FONT_STREAM_PARTITION);
+    if (s_part == NULL) {
+        LOG_I("[FontStream] No '%s' partition, using built-in font", FONT_STREAM_PARTITION);
+        return NULL;
+    }
+    if (esp_partition_read(s_part, 0, &s_hdr, sizeof(s_hdr)) != ESP_OK ||
+        memcmp(s_hdr.magic, EPF_MAGIC, 4) != 0 || s_hdr.version != 1 || s_hdr.image_size > s_part->size) {
+        LOG_I("[FontStream] No font image in '%s', using built-in font", FONT_STREAM_PARTITION);
+        return NULL;
+    }
+    if (esp_partition_read(s_part, s_hdr.dir_offset, s_dir, sizeof(s_dir)) != ESP_OK) {
+        LOG_E("[FontStream] Directory read failed");
+        return NULL;
+    }
+
+    s_slot_bytes = ((uint16_t)s_hdr.max_box_w * s_hdr.max_box_h + 7) / 8;
+    size_t slots_size = sizeof(slot_t) * FONT_STREAM_CACHE_SLOTS;
+    size_t bitmaps_size = (size_t)s_slot_bytes * FONT_STREAM_CACHE_SLOTS;
+    s_slots = (slot_t *)heap_caps_malloc(slots_size, MALLOC_CAP_SPIRAM);
+    s_bitmaps = (uint8_t *)heap_caps_malloc(bitmaps_size, MALLOC_CAP_SPIRAM);
+    if (s_slots == NULL || s_bitmaps == NULL) {
+        LOG_E("[FontStream] Cache alloc failed");
+        heap_caps_free(s_slots);
+        heap_caps_free(s_bitmaps);
+        s_slots = NULL;
+        s_bitmaps = NULL;
+        return NULL;
+    }
+    _cache_reset();
+    _setup_font(fallback);
+
+    LOG_I("[FontStream] %lu glyphs, %u px line, cache %u x %u B (%u B)",
+          s_hdr.glyph_count, s_hdr.line_height, FONT_STREAM_CACHE_SLOTS, s_slot_bytes,
+          (unsigned)(slots_size + bitmaps_size));
+    return &s_font;
+}
+
+/**
+ * @brief 获取流式字体
+ */
+const lv_font_t *gui_font_stream_get(void) {
+    return s_mounted ? &s_font : NULL;
+}
+
+/**
+ * @brief 页面控件改用流式字体
+ */
+void gui_font_stream_apply(lv_obj_t *scr) {
+    if (!s_mounted || scr == NULL) return;
+
+    lv_style_value_t v;
+    if (lv_obj_get_local_style_prop(scr, LV_STYLE_TEXT_FONT, &v, LV_PART_MAIN) == LV_STYLE_RES_FOUND &&
+        v.ptr == s_font.fallback) {
+        lv_obj_set_style_text_font(scr, &s_font, LV_PART_MAIN);
+    }
+
+    uint32_t cnt = lv_obj_get_child_cnt(scr);
+    for (uint32_t i = 0; i < cnt; i++) gui_font_stream_apply(lv_obj_get_child(scr, i));
+}
+
+/**
+ * @brief 首屏延迟测试
+ */
+void gui_font_stream_bench(const char *text) {
+    if (!s_mounted) return;
+    if (text == NULL) text = s_sample_page;
+
+    lv_font_glyph_dsc_t g;
+    uint32_t us[2], reads[2], letters = 0;
+    if (s_map == NULL) _cache_reset();
+
+    for (int pass = 0; pass < 2; pass++) {
+        uint32_t bytes0 = s_read_bytes;
+        uint32_t t0 = micros();
+        uint32_t i = 0;
+        letters = 0;
+        while (text[i] != '\0') {
+            uint32_t letter = _lv_txt_encoded_next(text, &i);
+            if (gui_font_stream_get_glyph_dsc(&s_font, &g, letter, 0)) {
+                gui_font_stream_get_bitmap(&s_font, letter);
+            }
+            letters++;
+        }
+        us[pass] = micros() - t0;
+        reads[pass] = s_read_bytes - bytes0;
+    }
+
+    LOG_I("[FontStream] Page of %lu letters: cold %lu us (%lu B read), warm %lu us",
+          letters, us[0], reads[0], us[1]);
+}
+
+/**
+ * @brief 输出缓存统计
+ */
+void gui_font_stream_report(void) {
+    if (!s_mounted) return;
+    if (s_map != NULL) {
+        LOG_I("[FontStream] mapped at %p, lookups=%lu (zero copy)", s_map, s_hits);
+        return;
+    }
+    uint32_t total = s_hits + s_misses;
+    LOG_I("[FontStream] hits=%lu misses=%lu hit rate=%lu%% miss avg=%lu us flash read=%lu B",
+          s_hits, s_misses, total ? s_hits * 100 / total : 0,
+          s_misses ? s_miss_us / s_misses : 0, s_read_bytes);
+}
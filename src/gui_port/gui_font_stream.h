@@ -0,0 +1,77 @@
+/**
+ * @file gui_font_stream.h
+ * @brief 流式字体 (字形按需从 flash 分区读取)
+ * @details 编译进固件的字体只有约 140 个汉字，整套 GB2312 / GBK 编译进去会让固件膨胀几百 KB 到 1 MB。
+ *          流式字体把 tools/font_pack.py 生成的 EPF1 镜像放在独立的 font 分区，
+ *          显示时按字读取，最近用过的字形保存在 LRU 缓存中 (优先 PSRAM)。
+ *          资源包 (gui_pack) 中带有名为 "font" 的 EPF1 字体时优先使用它：镜像已映射到地址空间，
+ *          字形位图直接返回映射地址，不需要缓存。
+ *          对 LVGL 来说它就是一个普通的 1bpp lv_font_t，可走 gui_font 的快速绘制路径。
+ */
+#ifndef GUI_FONT_STREAM_H
+#define GUI_FONT_STREAM_H
+
+#include <lvgl.h>
+#include <stdbool.h>
+
+// 分区名称 (partitions.csv)
+#ifndef FONT_STREAM_PARTITION
+#define FONT_STREAM_PARTITION "font"
+#endif
+
+// 字形缓存槽位数 (2 的幂)，一屏汉字约 150 个
+#ifndef FONT_STREAM_CACHE_SLOTS
+#define FONT_STREAM_CACHE_SLOTS 256
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 挂载流式字体 (资源包中的字体优先，其次 font 分区)
+ * @param fallback 流式字体中没有的字改用的字体 (通常为固件内置字体，可为 NULL)
+ * @return 流式字体；分区不存在或镜像无效时返回 NULL (界面继续使用内置字体)
+ */
+const lv_font_t *gui_font_stream_init(const lv_font_t *fallback);
+
+/**
+ * @brief 获取已挂载的流式字体 (未挂载返回 NULL)
+ */
+const lv_font_t *gui_font_stream_get(void);
+
+/**
+ * @brief 页面上使用 fallback 字体的控件改用流式字体
+ * @param scr 页面 (screen_init 之后调用)
+ * @details 只替换本地样式中的 text_font；未挂载流式字体时不做任何事。
+ */
+void gui_font_stream_apply(lv_obj_t *scr);
+
+/**
+ * @brief 流式字体的 get_glyph_dsc
+ */
+bool gui_font_stream_get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out,
+                                   uint32_t unicode_letter, uint32_t unicode_letter_next);
+
+/**
+ * @brief 流式字体的 get_glyph_bitmap (返回缓存中的 1bpp 位图，下一次缓存未命中前有效；映射模式下长期有效)
+ */
+const uint8_t *gui_font_stream_get_bitmap(const lv_font_t *font, uint32_t unicode_letter);
+
+/**
+ * @brief 首屏延迟测试
+ * @param text UTF-8 文本 (NULL 使用内置的一整屏中文样例)
+ * @details 清空缓存后查找全部字形 (冷)，再查找一遍 (热)，输出两次耗时与 flash 读取量。
+ */
+void gui_font_stream_bench(const char *text);
+
+/**
+ * @brief 输出缓存统计 (命中率、未命中平均耗时、flash 读取字节数)
+ */
+void gui_font_stream_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_FONT_STREAM_H
@@ -0,0 +1,141 @@
+/**
+ * @file gui_img.cpp
+ * @brief 1bit 图片快速绘制实现
+ * @details
+ * 快速路径的条件：
+ * - 图片源是 C 数组 (LV_IMG_SRC_VARIABLE)，格式为 LV_IMG_CF_ALPHA_1BIT，
+ *   或 gui_asset 的压缩格式 (从解码缓存取 1bit 位图)；
+ * - 不缩放、不旋转，绘制区域与图片尺寸一致；
+ * - 不透明 (opa >= LV_OPA_MAX)，普通混合模式，且当前没有绘制遮罩 (圆角裁剪等)。
+ * 图片每行按字节对齐、MSB 在前，置位像素写入 recolor (与 LVGL 解码 ALPHA 格式时取的颜色相同)。
+ *
+ * LVGL 8.3 的 lv_draw_img 在 draw_ctx->draw_img 返回 LV_RES_INV 时直接画错误占位，不会回退，
+ * 所以其余图片由本模块临时清空 draw_img 后重新调用 lv_draw_img，走 LVGL 原来的解码 + 混合流程。
+ */
+#include "gui_img.h"
+#include "gui_asset.h"
+#include "common/Log.h"
+#include <Arduino.h>
+
+typedef struct {
+    const void *src;
+    uint16_t w;
+    uint16_t h;
+    uint8_t cf;
+    uint32_t draws;
+    uint32_t us;
+} img_stat_t;
+
+// 统计
+static img_stat_t s_stats[GUI_IMG_STATS_MAX];
+static uint32_t s_fast_draws = 0;
+static uint32_t s_fast_us = 0;
+static uint32_t s_sw_draws = 0;
+static uint32_t s_sw_us = 0;
+
+/**
+ * @brief 按位把 ALPHA_1BIT (或压缩的 1bit) 图片写入渲染缓冲区
+ * @return false 不满足快速路径条件，需交给 LVGL
+ */
+static bool _blit_1bit(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *dsc,
+                       const lv_area_t *coords, const lv_img_dsc_t *img) {
+    if (img->header.cf != LV_IMG_CF_ALPHA_1BIT && !gui_asset_is_encoded(img)) return false;
+    if (dsc->angle != 0 || dsc->zoom != LV_IMG_ZOOM_NONE) return false;
+    if (dsc->opa < LV_OPA_MAX || dsc->blend_mode != LV_BLEND_MODE_NORMAL) return false;
+    if (lv_area_get_width(coords) != img->header.w || lv_area_get_height(coords) != img->header.h) return false;
+
+    lv_area_t clip;
+    if (!_lv_area_intersect(&clip, draw_ctx->clip_area, coords)) return true;
+    if (lv_draw_mask_is_any(&clip)) return false;
+
+    const uint8_t *bits = img->header.cf == LV_IMG_CF_ALPHA_1BIT ? img->data : gui_asset_get_1bit(img);
+    if (bits == NULL) return false;
+
+    lv_color_t *buf = (lv_color_t *)draw_ctx->buf;
+    const lv_area_t *buf_area = draw_ctx->buf_area;
+    lv_coord_t stride = lv_area_get_width(buf_area);
+    uint32_t row_bytes = (img->header.w + 7) / 8;
+    lv_color_t color = dsc->recolor;
+
+    for (lv_coord_t y = clip.y1; y <= clip.y2; y++) {
+        const uint8_t *row = bits + (uint32_t)(y - coords->y1) * row_bytes;
+        uint32_t bit = clip.x1 - coords->x1;
+        lv_color_t *dst = buf + (y - buf_area->y1) * stride + (clip.x1 - buf_area->x1);
+        for (lv_coord_t x = clip.x1; x <= clip.x2; x++, bit++, dst++) {
+            if (row[bit >> 3] & (0x80 >> (bit & 7))) *dst = color;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 记录单张图片的绘制耗时
+ */
+static void _record(const void *src, uint32_t us) {
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) return;
+    const lv_img_dsc_t *img = (const lv_img_dsc_t *)src;
+    for (int i = 0; i < GUI_IMG_STATS_MAX; i++) {
+        img_stat_t &s = s_stats[i];
+        if (s.src == NULL) {
+            s.src = src;
+            s.w = img->header.w;
+            s.h = img->header.h;
+            s.cf = img->header.cf;
+        }
+        if (s.src == src) {
+            s.draws++;
+            s.us += us;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief 替换后的 draw_img
+ */
+static lv_res_t _draw_img_cb(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *dsc,
+                             const lv_area_t *coords, const void *src) {
+    uint32_t t0 = micros();
+#if GUI_IMG_FAST_BLIT
+    if (lv_img_src_get_type(src) == LV_IMG_SRC_VARIABLE &&
+        _blit_1bit(draw_ctx, dsc, coords, (const lv_img_dsc_t *)src)) {
+        uint32_t us = micros() - t0;
+        s_fast_us += us;
+        s_fast_draws++;
+        _record(src, us);
+        return LV_RES_OK;
+    }
+#endif
+    // 交给 LVGL: lv_draw_img 在 draw_img 为空时走内置解码 + 混合
+    draw_ctx->draw_img = NULL;
+    lv_draw_img(draw_ctx, dsc, coords, src);
+    draw_ctx->draw_img = _draw_img_cb;
+
+    uint32_t us = micros() - t0;
+    s_sw_us += us;
+    s_sw_draws++;
+    _record(src, us);
+    return LV_RES_OK;
+}
+
+/**
+ * @brief 替换绘制上下文的 draw_img
+ */
+void gui_img_install(lv_draw_ctx_t *draw_ctx) {
+    draw_ctx->draw_img = _draw_img_cb;
+}
+
+/**
+ * @brief 输出图片绘制统计
+ */
+void gui_img_report(void) {
+    LOG_I("[Img] fast draws=%lu avg=%lu us, lvgl draws=%lu avg=%lu us",
+          s_fast_draws, s_fast_draws ? s_fast_us / s_fast_draws : 0,
+          s_sw_draws, s_sw_draws ? s_sw_us / s_sw_draws : 0);
+    for (int i = 0; i < GUI_IMG_STATS_MAX; i++) {
+        const img_stat_t &s = s_stats[i];
+        if (s.src == NULL) break;
+        LOG_RAW("  img %p %ux%u cf=%u draws=%lu avg=%lu us\n", s.src, s.w, s.h, s.cf,
+                s.draws, s.draws ? s.us / s.draws : 0);
+    }
+}
@@ -0,0 +1,43 @@
+/**
+ * @file gui_img.h
+ * @brief 1bit 图片快速绘制
+ * @details SquareLine 导出的图标经 tools/img_1bpp.py 转换为 LV_IMG_CF_ALPHA_1BIT。
+ *          LVGL 绘制 ALPHA_1BIT 图片时先由解码器逐行展开为 ARGB，再逐像素混合；
+ *          本模块替换绘制上下文的 draw_img：不缩放、不旋转、不透明、无遮罩的 1bit 图片
+ *          按位直接写入渲染缓冲区，其余图片仍交给 LVGL。
+ */
+#ifndef GUI_IMG_H
+#define GUI_IMG_H
+
+#include <lvgl.h>
+
+// 快速图片绘制开关 (0: 全部交给 LVGL，仅用于对比渲染耗时)
+#ifndef GUI_IMG_FAST_BLIT
+#define GUI_IMG_FAST_BLIT 1
+#endif
+
+// 统计表记录的图片数 (超出部分只计入总数)
+#ifndef GUI_IMG_STATS_MAX
+#define GUI_IMG_STATS_MAX 8
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 替换绘制上下文的 draw_img
+ * @details 须在 lv_draw_sw_init_ctx 之后调用 (gui_port 的 draw_ctx_init 中)。
+ */
+void gui_img_install(lv_draw_ctx_t *draw_ctx);
+
+/**
+ * @brief 输出图片绘制统计 (快速路径 / LVGL 路径的次数与平均耗时，按图片列出)
+ */
+void gui_img_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_IMG_H
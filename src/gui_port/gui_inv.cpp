@@ -0,0 +1,246 @@
+/**
+ * @file gui_inv.cpp
+ * @brief 失效来源分析实现
+ * @details 全部函数都运行在 GUI 线程 (lv_timer_handler / 事件回调) 中，无需加锁。
+ *          统计表只保存控件指针的数值、类型名和页面名，控件删除后不会再被访问。
+ */
+#include "gui_inv.h"
+#include "gui_audit.h"
+#include "common/Log.h"
+#include "system/PageBridge.h"
+#include <Arduino.h>
+
+/**
+ * @brief 控件统计
+ */
+typedef struct {
+    const lv_obj_t *obj;    ///< 控件地址 (仅作标识)
+    const char *cls;        ///< 类型名
+    const char *scr;        ///< 所属页面名
+    uint32_t invalidations; ///< 失效次数
+    uint32_t refreshes;     ///< 参与的墨水屏刷新次数
+    uint32_t wasted;        ///< 参与的 "帧未变化" 渲染次数
+    uint32_t px;            ///< 累计失效面积
+} inv_obj_t;
+
+/**
+ * @brief 页面统计
+ */
+typedef struct {
+    const char *name;
+    uint32_t invalidations;
+    uint32_t refreshes;
+    uint32_t wasted;
+} inv_scr_t;
+
+/**
+ * @brief 待结算的脏区域
+ */
+typedef struct {
+    uint8_t obj_idx;        ///< s_objs 下标
+    uint8_t scr_idx;        ///< s_scrs 下标
+    lv_area_t area;
+} inv_rec_t;
+
+static const lv_obj_t *s_ctx = NULL;            ///< 当前正在失效的控件 (gui_overlay 也要用，始终记录)
+
+#if GUI_INV_PROFILE
+static inv_obj_t s_objs[GUI_INV_TRACK_MAX + 1]; ///< 最后一项为 "(other)"
+static uint8_t s_obj_cnt = 0;
+static inv_scr_t s_scrs[GUI_INV_SCREEN_MAX + 1];
+static uint8_t s_scr_cnt = 0;
+static inv_rec_t s_pending[GUI_INV_PENDING_MAX];
+static uint8_t s_pending_cnt = 0;
+static uint32_t s_pending_lost = 0;             ///< 明细放不下的区域个数
+static uint32_t s_refreshes = 0;
+static uint32_t s_wasted = 0;
+#endif
+
+/* ==================================================================
+ * 链接器 --wrap 挂钩
+ * ================================================================== */
+extern "C" {
+void __real_lv_obj_invalidate(const lv_obj_t *obj);
+void __real_lv_obj_invalidate_area(const lv_obj_t *obj, const lv_area_t *area);
+
+void __wrap_lv_obj_invalidate(const lv_obj_t *obj) {
+    const lv_obj_t *prev = s_ctx;
+    s_ctx = obj;
+    __real_lv_obj_invalidate(obj);
+    s_ctx = prev;
+}
+
+void __wrap_lv_obj_invalidate_area(const lv_obj_t *obj, const lv_area_t *area) {
+    const lv_obj_t *prev = s_ctx;
+    s_ctx = obj;
+    __real_lv_obj_invalidate_area(obj, area);
+    s_ctx = prev;
+}
+}
+
+#if GUI_INV_PROFILE
+/**
+ * @brief 查找或登记页面统计
+ */
+static uint8_t _scr_index(const char *name) {
+    for (uint8_t i = 0; i < s_scr_cnt; i++) {
+        if (s_scrs[i].name == name) return i;
+    }
+    if (s_scr_cnt >= GUI_INV_SCREEN_MAX) {
+        s_scrs[GUI_INV_SCREEN_MAX].name = "(other)";
+        return GUI_INV_SCREEN_MAX;
+    }
+    s_scrs[s_scr_cnt].name = name;
+    return s_scr_cnt++;
+}
+
+/**
+ * @brief 查找或登记控件统计
+ */
+static uint8_t _obj_index(const lv_obj_t *obj, const char *cls, const char *scr) {
+    for (uint8_t i = 0; i < s_obj_cnt; i++) {
+        // 同一地址被删除后复用为其他控件时，类型或页面不同，视为新控件
+        if (s_objs[i].obj == obj && s_objs[i].cls == cls && s_objs[i].scr == scr) return i;
+    }
+    if (s_obj_cnt >= GUI_INV_TRACK_MAX) {
+        inv_obj_t *o = &s_objs[GUI_INV_TRACK_MAX];
+        o->obj = NULL;
+        o->cls = "(other)";
+        o->scr = "-";
+        return GUI_INV_TRACK_MAX;
+    }
+    inv_obj_t *o = &s_objs[s_obj_cnt];
+    o->obj = obj;
+    o->cls = cls;
+    o->scr = scr;
+    return s_obj_cnt++;
+}
+#endif
+
+/**
+ * @brief 当前正在失效的控件
+ */
+const lv_obj_t *gui_inv_current_obj(void) {
+    return s_ctx;
+}
+
+/**
+ * @brief 记录一块脏区域
+ */
+void gui_inv_record_area(const lv_area_t *area) {
+#if GUI_INV_PROFILE
+    const lv_obj_t *obj = s_ctx;
+    const char *cls;
+    const lv_obj_t *scr;
+
+    if (obj != NULL) {
+        cls = gui_audit_class_name(obj);
+        scr = lv_obj_get_screen(obj);
+    } else {
+        cls = "(internal)";
+        scr = lv_scr_act();
+    }
+
+    const char *scr_name = page_screen_name(scr);
+    if (scr_name == NULL) scr_name = (scr == lv_layer_top() || scr == lv_layer_sys()) ? "(layer)" : "(unknown)";
+
+    uint8_t oi = _obj_index(obj, cls, scr_name);
+    uint8_t si = _scr_index(scr_name);
+    s_objs[oi].invalidations++;
+    s_objs[oi].px += lv_area_get_size(area);
+    s_scrs[si].invalidations++;
+
+    if (s_pending_cnt < GUI_INV_PENDING_MAX) {
+        inv_rec_t *r = &s_pending[s_pending_cnt++];
+        r->obj_idx = oi;
+        r->scr_idx = si;
+        r->area = *area;
+    } else {
+        s_pending_lost++;
+    }
+#else
+    LV_UNUSED(area);
+#endif
+}
+
+/**
+ * @brief 结算累积的脏区域
+ */
+void gui_inv_on_refresh(bool refreshed) {
+#if GUI_INV_PROFILE
+    if (s_pending_cnt == 0) return;
+
+    if (refreshed) s_refreshes++;
+    else s_wasted++;
+
+    LOG_D("[Inv] %s #%lu: %u regions%s", refreshed ? "EPD refresh" : "Unchanged render",
+          refreshed ? s_refreshes : s_wasted, s_pending_cnt, s_pending_lost ? " (+lost)" : "");
+
+    // 同一控件 / 页面在一次刷新中只计一次
+    bool obj_seen[GUI_INV_TRACK_MAX + 1] = {};
+    bool scr_seen[GUI_INV_SCREEN_MAX + 1] = {};
+
+    for (uint8_t i = 0; i < s_pending_cnt; i++) {
+        const inv_rec_t *r = &s_pending[i];
+        inv_obj_t *o = &s_objs[r->obj_idx];
+
+        LOG_D("[Inv]   %-10s %p %-12s (%d,%d)-(%d,%d)", o->cls, (const void *)o->obj, s_scrs[r->scr_idx].name,
+              r->area.x1, r->area.y1, r->area.x2, r->area.y2);
+
+        if (!obj_seen[r->obj_idx]) {
+            obj_seen[r->obj_idx] = true;
+            if (refreshed) o->refreshes++;
+            else o->wasted++;
+        }
+        if (!scr_seen[r->scr_idx]) {
+            scr_seen[r->scr_idx] = true;
+            if (refreshed) s_scrs[r->scr_idx].refreshes++;
+            else s_scrs[r->scr_idx].wasted++;
+        }
+    }
+
+    s_pending_cnt = 0;
+    s_pending_lost = 0;
+
+#if GUI_INV_REPORT_EVERY > 0
+    if (refreshed && s_refreshes % GUI_INV_REPORT_EVERY == 0) gui_inv_report();
+#endif
+#else
+    LV_UNUSED(refreshed);
+#endif
+}
+
+/**
+ * @brief 输出报告
+ */
+void gui_inv_report(void) {
+#if GUI_INV_PROFILE
+    LOG_I("[Inv] Invalidation report: %lu EPD refreshes, %lu unchanged renders", s_refreshes, s_wasted);
+
+    for (uint8_t i = 0; i <= GUI_INV_SCREEN_MAX; i++) {
+        const inv_scr_t *s = &s_scrs[i];
+        if (s->name == NULL) continue;
+        LOG_RAW("  screen %-12s inv=%lu refresh=%lu wasted=%lu\n", s->name, s->invalidations, s->refreshes, s->wasted);
+    }
+
+    // 按参与刷新次数选出前 N 个控件 (表很小，直接选择排序)
+    bool taken[GUI_INV_TRACK_MAX + 1] = {};
+    for (uint8_t n = 0; n < GUI_INV_TOP_N; n++) {
+        int best = -1;
+        for (uint8_t i = 0; i <= GUI_INV_TRACK_MAX; i++) {
+            const inv_obj_t *o = &s_objs[i];
+            if (taken[i] || o->cls == NULL || o->invalidations == 0) continue;
+            if (best < 0 || o->refreshes > s_objs[best].refreshes ||
+                (o->refreshes == s_objs[best].refreshes && o->invalidations > s_objs[best].invalidations)) {
+                best = i;
+            }
+        }
+        if (best < 0) break;
+        taken[best] = true;
+
+        const inv_obj_t *o = &s_objs[best];
+        LOG_RAW("  #%u %-10s %p %-12s inv=%lu refresh=%lu wasted=%lu px=%lu\n", n + 1, o->cls, (const void *)o->obj,
+                o->scr, o->invalidations, o->refreshes, o->wasted, o->px);
+    }
+#endif
+}
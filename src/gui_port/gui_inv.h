@@ -0,0 +1,82 @@
+/**
+ * @file gui_inv.h
+ * @brief 失效来源分析 (哪个控件引起了哪次刷屏)
+ * @details
+ * 两个挂钩点：
+ * 1. 链接器 --wrap 拦截 lv_obj_invalidate / lv_obj_invalidate_area，记下 "当前正在失效的控件"。
+ * 2. disp_drv.rounder_cb (LVGL 每登记一块脏区域都会调用) 中记录区域，并归属到上面的控件。
+ * gui_port 在请求刷屏 (或判定帧未变化而跳过) 时，把累积的记录结算到这一次刷新上。
+ *
+ * @note 需要在 platformio.ini 的 build_flags 中加入
+ *       -Wl,--wrap=lv_obj_invalidate -Wl,--wrap=lv_obj_invalidate_area。
+ *       --wrap 只对跨目标文件的调用生效，lv_obj_pos.c 内部 (如 lv_obj_set_pos) 直接调用的失效
+ *       无法得知控件，记为 "(internal)" 并归到当前页面。
+ */
+#ifndef GUI_INV_H
+#define GUI_INV_H
+
+#include <lvgl.h>
+#include <stdbool.h>
+
+// 分析开关 (0: 只保留对 LVGL 原函数的转发)
+#ifndef GUI_INV_PROFILE
+#define GUI_INV_PROFILE 1
+#endif
+
+// 统计的控件个数上限 (超出后归入 "(other)")
+#ifndef GUI_INV_TRACK_MAX
+#define GUI_INV_TRACK_MAX 32
+#endif
+
+// 统计的页面个数上限
+#ifndef GUI_INV_SCREEN_MAX
+#define GUI_INV_SCREEN_MAX 8
+#endif
+
+// 单次刷新最多保留的脏区域明细
+#ifndef GUI_INV_PENDING_MAX
+#define GUI_INV_PENDING_MAX 16
+#endif
+
+// 报告中列出的控件个数
+#ifndef GUI_INV_TOP_N
+#define GUI_INV_TOP_N 8
+#endif
+
+// 每多少次刷屏自动输出一次报告 (0: 不自动输出)
+#ifndef GUI_INV_REPORT_EVERY
+#define GUI_INV_REPORT_EVERY 16
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 记录一块脏区域 (在 rounder_cb 中调用)
+ * @param area 屏幕坐标下的区域 (已裁剪到屏幕内)
+ */
+void gui_inv_record_area(const lv_area_t *area);
+
+/**
+ * @brief 当前正在失效的控件 (在 rounder_cb 中调用有效)
+ * @return NULL 表示 LVGL 内部直接调用的失效，无法得知控件
+ */
+const lv_obj_t *gui_inv_current_obj(void);
+
+/**
+ * @brief 结算累积的脏区域 (gui_port 在一次渲染结束时调用)
+ * @param refreshed true: 触发了墨水屏刷新; false: 帧未变化被跳过 (白白渲染了一次)
+ */
+void gui_inv_on_refresh(bool refreshed);
+
+/**
+ * @brief 通过串口输出报告：各页面统计与引起刷屏最多的 GUI_INV_TOP_N 个控件
+ */
+void gui_inv_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_INV_H
@@ -0,0 +1,157 @@
+/**
+ * @file gui_launcher.cpp
+ * @brief 图标启动器实现
+ * @details
+ * - 状态结构体放在 lv_mem 中，挂在启动器对象的 user_data 上，LV_EVENT_DELETE 时释放。
+ * - 绘制：DRAW_MAIN 中只绘制与当前裁剪区相交的格子 (局部刷新时只画受影响的图标)，
+ *   图标颜色取 bg_img_recolor / bg_img_opa 样式，与 gui_atlas_attach 一致。
+ * - 点击：CLICKED 时按按下点所在格子回调；格子之间没有按下反馈 (墨水屏上反馈会多一次刷屏)。
+ */
+#include "gui_launcher.h"
+#include "common/Log.h"
+#include <Arduino.h>
+
+/**
+ * @brief 启动器状态
+ */
+typedef struct {
+    const gui_atlas_t *atlas;
+    const uint16_t *icons;
+    uint16_t count;
+    uint8_t cols;
+    gui_launcher_cb_t cb;
+    void *user_data;
+} launcher_t;
+
+// 统计
+static uint32_t s_passes = 0;
+static uint32_t s_icons = 0;
+static uint32_t s_us = 0;
+static uint32_t s_clicks = 0;
+
+static inline launcher_t *_get(const lv_obj_t *obj) {
+    return obj ? (launcher_t *)lv_obj_get_user_data((lv_obj_t *)obj) : NULL;
+}
+
+/**
+ * @brief 计算格子 index 的区域
+ */
+static void _cell_area(const launcher_t *ln, const lv_area_t *content, uint16_t index, lv_area_t *out) {
+    uint16_t rows = (ln->count + ln->cols - 1) / ln->cols;
+    lv_coord_t cw = lv_area_get_width(content) / ln->cols;
+    lv_coord_t ch = lv_area_get_height(content) / (rows ? rows : 1);
+    out->x1 = content->x1 + (index % ln->cols) * cw;
+    out->y1 = content->y1 + (index / ln->cols) * ch;
+    out->x2 = out->x1 + cw - 1;
+    out->y2 = out->y1 + ch - 1;
+}
+
+/**
+ * @brief 一次绘制全部 (可见) 图标
+ */
+static void _draw(lv_obj_t *obj, launcher_t *ln, lv_event_t *e) {
+    lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
+    lv_color_t color = lv_obj_get_style_bg_img_recolor_filtered(obj, LV_PART_MAIN);
+    lv_opa_t opa = lv_obj_get_style_bg_img_opa(obj, LV_PART_MAIN);
+
+    lv_area_t content;
+    lv_obj_get_content_coords(obj, &content);
+
+    uint32_t t0 = micros();
+    uint32_t drawn = 0;
+    for (uint16_t i = 0; i < ln->count; i++) {
+        lv_area_t cell, tmp;
+        _cell_area(ln, &content, i, &cell);
+        if (!_lv_area_intersect(&tmp, &cell, draw_ctx->clip_area)) continue;
+
+        uint16_t id = ln->icons[i];
+        if (id >= ln->atlas->count) continue;
+        const gui_atlas_sprite_t *s = &ln->atlas->sprites[id];
+        lv_coord_t x = cell.x1 + (lv_area_get_width(&cell) - s->full_w) / 2;
+        lv_coord_t y = cell.y1 + (lv_area_get_height(&cell) - s->full_h) / 2;
+        gui_atlas_draw(draw_ctx, ln->atlas, id, x, y, color, opa);
+        drawn++;
+    }
+    s_us += micros() - t0;
+    s_icons += drawn;
+    s_passes++;
+}
+
+/**
+ * @brief 点击位置换算为格子序号
+ */
+static void _click(lv_obj_t *obj, launcher_t *ln) {
+    lv_indev_t *indev = lv_indev_get_act();
+    if (indev == NULL || ln->cb == NULL) return;
+
+    lv_point_t p;
+    lv_indev_get_point(indev, &p);
+    lv_area_t content;
+    lv_obj_get_content_coords(obj, &content);
+
+    for (uint16_t i = 0; i < ln->count; i++) {
+        lv_area_t cell;
+        _cell_area(ln, &content, i, &cell);
+        if (_lv_area_is_point_on(&cell, &p, 0)) {
+            s_clicks++;
+            ln->cb(i, ln->user_data);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief 启动器事件回调
+ */
+static void _event_cb(lv_event_t *e) {
+    lv_obj_t *obj = lv_event_get_target(e);
+    launcher_t *ln = _get(obj);
+    if (ln == NULL) return;
+
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_DRAW_MAIN: _draw(obj, ln, e); break;
+        case LV_EVENT_CLICKED:   _click(obj, ln); break;
+        case LV_EVENT_DELETE:
+            lv_obj_set_user_data(obj, NULL);
+            lv_mem_free(ln);
+            break;
+        default: break;
+    }
+}
+
+/**
+ * @brief 创建启动器
+ */
+lv_obj_t *gui_launcher_create(lv_obj_t *parent, const gui_atlas_t *atlas, const uint16_t *icons,
+                              uint16_t count, uint8_t cols, gui_launcher_cb_t cb, void *user_data) {
+    if (atlas == NULL || icons == NULL || cols == 0) return NULL;
+
+    launcher_t *ln = (launcher_t *)lv_mem_alloc(sizeof(launcher_t));
+    if (ln == NULL) {
+        LOG_E("[Launcher] Create failed: out of lv_mem");
+        return NULL;
+    }
+    ln->atlas = atlas;
+    ln->icons = icons;
+    ln->count = count;
+    ln->cols = cols;
+    ln->cb = cb;
+    ln->user_data = user_data;
+
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, lv_pct(100), lv_pct(100));
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_user_data(obj, ln);
+    lv_obj_add_event_cb(obj, _event_cb, LV_EVENT_ALL, NULL);
+    return obj;
+}
+
+/**
+ * @brief 输出启动器统计
+ */
+void gui_launcher_report(void) {
+    LOG_I("[Launcher] passes=%lu icons/pass=%lu avg=%lu us clicks=%lu",
+          s_passes, s_passes ? s_icons / s_passes : 0, s_passes ? s_us / s_passes : 0, s_clicks);
+}
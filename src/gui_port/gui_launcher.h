@@ -0,0 +1,49 @@
+/**
+ * @file gui_launcher.h
+ * @brief 图标启动器网格
+ * @details 启动器是一个普通 lv_obj：没有子控件，全部图标在它的一次 DRAW_MAIN 事件中从图标集绘制，
+ *          点击位置换算为格子序号。与 "每格一个按钮 + bg_img" 相比，
+ *          不需要每个图标一个控件、一份本地样式和一次 lv_draw_img。
+ */
+#ifndef GUI_LAUNCHER_H
+#define GUI_LAUNCHER_H
+
+#include <lvgl.h>
+#include <stdint.h>
+#include "gui_atlas.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 格子点击回调
+ * @param index     被点击的格子序号
+ * @param user_data gui_launcher_create 传入的用户数据
+ */
+typedef void (*gui_launcher_cb_t)(uint16_t index, void *user_data);
+
+/**
+ * @brief 创建启动器
+ * @param parent    父控件
+ * @param atlas     图标集
+ * @param icons     每个格子的图标序号 (数组须在启动器存活期间保持有效)
+ * @param count     格子数
+ * @param cols      列数 (行数按 count 计算，格子平分启动器内容区)
+ * @param cb        点击回调
+ * @param user_data 传给点击回调的用户数据
+ * @return 启动器对象 (默认填满父控件，可按常规方式修改大小、位置和样式)
+ */
+lv_obj_t *gui_launcher_create(lv_obj_t *parent, const gui_atlas_t *atlas, const uint16_t *icons,
+                              uint16_t count, uint8_t cols, gui_launcher_cb_t cb, void *user_data);
+
+/**
+ * @brief 输出启动器统计 (绘制次数、每次绘制的图标数与平均耗时)
+ */
+void gui_launcher_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_LAUNCHER_H
@@ -0,0 +1,333 @@
+/**
+ * @file gui_overlay.cpp
+ * @brief 覆盖层快照与恢复实现
+ * @details 快照按显存原生方向保存：逻辑区域 [x1, x2] x [y1, y2] 对应显存第 x1..x2 行的
+ *          第 y1/8 .. y2/8 字节，每行整字节拷贝。为此记录的区域在 y 方向扩展到字节边界，
+ *          作废判断也用扩展后的区域，保证恢复时拷回的每一位都是下面的画面。
+ */
+#include "gui_overlay.h"
+#include "gui_inv.h"
+#include "gui_port.h"
+#include "common/Log.h"
+#include "bsp/bsp_epd.h"
+#include "ui/ui.h"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <string.h>
+
+#define FB_STRIDE ((EPD_WIDTH + 7) / 8)     ///< 显存每行字节数
+
+/**
+ * @brief 已登记的覆盖层
+ */
+typedef struct {
+    lv_obj_t *obj;
+    lv_area_t area;         ///< 快照区域 (逻辑坐标，含扩展绘制区域，y 按字节对齐)
+    uint8_t *snap;          ///< 快照 (PSRAM)
+    uint32_t size;          ///< 快照字节数
+    bool stale;             ///< 下面的画面已变化
+} overlay_t;
+
+// 按打开顺序排列 (后打开的在上面)
+static overlay_t s_ovl[GUI_OVERLAY_MAX];
+static uint8_t s_cnt = 0;
+static bool s_bench = false;
+
+// 统计
+static uint32_t s_opens = 0;
+static uint32_t s_restores = 0;
+static uint32_t s_fallbacks = 0;
+static uint32_t s_stales = 0;
+static uint32_t s_restore_us = 0;
+static uint32_t s_snap_bytes = 0;
+static uint32_t s_snap_peak = 0;
+static uint32_t s_bench_restore_us = 0;
+static uint32_t s_bench_rerender_us = 0;
+
+static int _find(const lv_obj_t *obj) {
+    for (int i = 0; i < s_cnt; i++) {
+        if (s_ovl[i].obj == obj) return i;
+    }
+    return -1;
+}
+
+/**
+ * @brief 移除登记并释放快照
+ */
+static void _release(int i) {
+    heap_caps_free(s_ovl[i].snap);
+    s_snap_bytes -= s_ovl[i].size;
+    for (int j = i; j + 1 < s_cnt; j++) s_ovl[j] = s_ovl[j + 1];
+    s_cnt--;
+}
+
+/**
+ * @brief 覆盖层被删除 (包括 gui_overlay_close 之外的途径)
+ */
+static void _delete_cb(lv_event_t *e) {
+    int i = _find(lv_event_get_target(e));
+    if (i >= 0) _release(i);
+}
+
+/**
+ * @brief 显存与快照之间拷贝
+ * @param save true: 显存 -> 快照; false: 快照 -> 显存
+ */
+static void _copy(const overlay_t *o, bool save) {
+    uint8_t *fb = gui_port_framebuffer();
+    uint16_t b0 = o->area.y1 / 8;
+    uint16_t nb = o->area.y2 / 8 - b0 + 1;
+    uint8_t *s = o->snap;
+    for (lv_coord_t r = o->area.x1; r <= o->area.x2; r++, s += nb) {
+        uint8_t *row = fb + r * FB_STRIDE + b0;
+        if (save) memcpy(s, row, nb);
+        else memcpy(row, s, nb);
+    }
+}
+
+static bool _is_descendant(const lv_obj_t *obj, const lv_obj_t *root) {
+    for (; obj != NULL; obj = lv_obj_get_parent(obj)) {
+        if (obj == root) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief 登记覆盖层
+ */
+bool gui_overlay_open(lv_obj_t *obj) {
+    if (obj == NULL) return false;
+    if (_find(obj) >= 0) return true;
+#if EPD_BWR
+    // 快照只含黑白平面，三色屏关闭时一律重新渲染
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    return false;
+#endif
+
+    // 先隐藏：布局更新与补渲染时不画覆盖层 (已画出过的也会被擦掉)
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_update_layout(obj);
+
+    bool ok = false;
+    lv_disp_t *disp = lv_obj_get_disp(obj);
+    lv_area_t a;
+    lv_obj_get_coords(obj, &a);
+    lv_coord_t ext = _lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&a, ext, ext);
+    a.y1 &= ~7;
+    a.y2 |= 7;
+    static const lv_area_t screen = {0, 0, EPD_HEIGHT - 1, EPD_WIDTH - 1};
+
+    if (gui_port_framebuffer() == NULL || s_cnt >= GUI_OVERLAY_MAX) {
+        LOG_E("[Overlay] Cannot register %p (%u open)", (void *)obj, s_cnt);
+    } else if (_lv_area_intersect(&a, &a, &screen)) {
+        // 被覆盖区域还有未渲染的变化时先渲染，使显存就是下面的画面
+        for (uint16_t i = 0; i < disp->inv_p; i++) {
+            if (!disp->inv_area_joined[i] && _lv_area_is_on(&disp->inv_areas[i], &a)) {
+                lv_refr_now(disp);
+                break;
+            }
+        }
+
+        uint32_t size = (a.x2 - a.x1 + 1) * (a.y2 / 8 - a.y1 / 8 + 1);
+        uint8_t *snap = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+        if (snap == NULL) {
+            LOG_E("[Overlay] Snapshot alloc failed (%lu B)", size);
+        } else {
+            overlay_t *o = &s_ovl[s_cnt++];
+            o->obj = obj;
+            o->area = a;
+            o->snap = snap;
+            o->size = size;
+            o->stale = false;
+            _copy(o, true);
+            lv_obj_add_event_cb(obj, _delete_cb, LV_EVENT_DELETE, NULL);
+
+            s_opens++;
+            s_snap_bytes += size;
+            if (s_snap_bytes > s_snap_peak) s_snap_peak = s_snap_bytes;
+            LOG_D("[Overlay] Open %p (%d,%d)-(%d,%d), snapshot %lu B", (void *)obj, a.x1, a.y1, a.x2, a.y2, size);
+            ok = true;
+        }
+    }
+
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    return ok;
+}
+
+/**
+ * @brief 关闭覆盖层
+ */
+void gui_overlay_close(lv_obj_t *obj) {
+    if (obj == NULL) return;
+    int i = _find(obj);
+    overlay_t *o = i >= 0 ? &s_ovl[i] : NULL;
+
+    // 上面还有与之重叠的覆盖层时，拷回快照会擦掉上层
+    bool covered = false;
+    for (int j = i + 1; o != NULL && j < s_cnt; j++) {
+        if (_lv_area_is_on(&s_ovl[j].area, &o->area)) covered = true;
+    }
+
+    if (o == NULL || o->stale || covered) {
+        if (o != NULL) {
+            s_fallbacks++;
+            LOG_D("[Overlay] Close %p by re-render (%s)", (void *)obj, o->stale ? "stale" : "covered");
+        }
+#if GUI_OVERLAY_PROBE
+        if (!s_bench) gui_port_latency_probe("Overlay close (re-render)");
+#endif
+        gui_port_request_mode(GUI_OVERLAY_MODE);
+        lv_obj_del(obj);
+        return;
+    }
+
+#if GUI_OVERLAY_PROBE
+    if (!s_bench) gui_port_latency_probe("Overlay close (restore)");
+#endif
+    uint32_t t0 = micros();
+    lv_area_t a = o->area;
+    _copy(o, false);
+
+    // 删除时不登记失效区域 (快照已恢复，无需重新渲染)
+    lv_disp_t *disp = lv_obj_get_disp(obj);
+    lv_disp_enable_invalidation(disp, false);
+    lv_obj_del(obj);
+    lv_disp_enable_invalidation(disp, true);
+
+    // 逻辑 x -> 显存行，逻辑 y -> 显存位
+    gui_port_refresh_region(a.y1, a.x1, lv_area_get_height(&a), lv_area_get_width(&a), GUI_OVERLAY_MODE);
+    s_restores++;
+    s_restore_us += micros() - t0;
+}
+
+/**
+ * @brief 判断一块脏区域是否使快照作废
+ * @details 覆盖层自身 (及其子控件) 在快照区域内的重绘不影响下面的画面；LVGL 内部直接调用的失效
+ *          无法得知控件，完全落在覆盖层范围内时视为覆盖层自身的重绘。
+ */
+void gui_overlay_on_area(const lv_area_t *area) {
+    if (s_cnt == 0) return;
+    const lv_obj_t *ctx = gui_inv_current_obj();
+    for (int i = 0; i < s_cnt; i++) {
+        overlay_t *o = &s_ovl[i];
+        if (o->stale || !_lv_area_is_on(area, &o->area)) continue;
+
+        bool own;
+        if (ctx != NULL) {
+            own = _is_descendant(ctx, o->obj);
+        } else {
+            lv_area_t c;
+            lv_obj_get_coords(o->obj, &c);
+            lv_coord_t ext = _lv_obj_get_ext_draw_size(o->obj);
+            lv_area_increase(&c, ext, ext);
+            own = _lv_area_is_in(area, &c, 0);
+        }
+        // 覆盖层移动 / 变大超出快照区域时，区域外的像素无法恢复
+        if (own && _lv_area_is_in(area, &o->area, 0)) continue;
+
+        o->stale = true;
+        s_stales++;
+        LOG_D("[Overlay] Snapshot of %p stale: (%d,%d)-(%d,%d) by %p", (void *)o->obj,
+              area->x1, area->y1, area->x2, area->y2, (const void *)ctx);
+    }
+}
+
+/* --- 提示框 --- */
+
+static void _toast_timer_cb(lv_timer_t *t) {
+    gui_overlay_close((lv_obj_t *)t->user_data);
+}
+
+static void _toast_delete_cb(lv_event_t *e) {
+    lv_timer_del((lv_timer_t *)lv_event_get_user_data(e));
+}
+
+static lv_obj_t *_toast_create(const char *text) {
+    lv_obj_t *label = lv_label_create(lv_layer_top());
+    lv_obj_add_flag(label, LV_OBJ_FLAG_HIDDEN);
+    lv_label_set_text(label, text);
+    lv_obj_set_style_text_font(label, &ui_font_ChineseSong16, 0);
+    lv_obj_set_style_text_color(label, lv_color_white(), 0);
+    lv_obj_set_style_bg_color(label, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(label, LV_OPA_COVER, 0);
+    lv_obj_set_style_pad_hor(label, 8, 0);
+    lv_obj_set_style_pad_ver(label, 4, 0);
+    lv_obj_align(label, LV_ALIGN_BOTTOM_MID, 0, -8);
+    return label;
+}
+
+/**
+ * @brief 显示提示
+ */
+void gui_overlay_toast(const char *text, uint32_t ms) {
+    if (text == NULL) return;
+    lv_obj_t *label = _toast_create(text);
+    lv_timer_t *t = lv_timer_create(_toast_timer_cb, ms, label);
+    lv_obj_add_event_cb(label, _toast_delete_cb, LV_EVENT_DELETE, t);
+    gui_overlay_open(label);
+}
+
+/* --- 基准测试 --- */
+
+#define BENCH_ROUNDS 10
+
+/**
+ * @brief 快照恢复 vs 重新渲染
+ */
+void gui_overlay_bench(void) {
+    uint8_t *fb = gui_port_framebuffer();
+    if (fb == NULL) return;
+    const uint32_t fb_size = FB_STRIDE * EPD_HEIGHT;
+    uint8_t *saved = (uint8_t *)heap_caps_malloc(fb_size, MALLOC_CAP_SPIRAM);
+    if (saved == NULL) return;
+
+    lv_disp_t *disp = lv_disp_get_default();
+    lv_refr_now(disp);
+    memcpy(saved, fb, fb_size);
+    gui_port_hold_refresh(true);
+    s_bench = true;
+
+    uint32_t restore_us = 0, rerender_us = 0;
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        // 快照恢复：拷回显存 + 删除控件
+        lv_obj_t *a = _toast_create("设置已保存");
+        gui_overlay_open(a);
+        lv_refr_now(disp);
+        uint32_t t0 = micros();
+        gui_overlay_close(a);
+        restore_us += micros() - t0;
+
+        // 重新渲染：删除控件 + LVGL 渲染被覆盖区域 + 1bit 转换
+        lv_obj_t *b = _toast_create("设置已保存");
+        gui_overlay_open(b);
+        lv_refr_now(disp);
+        int i = _find(b);
+        if (i >= 0) s_ovl[i].stale = true;
+        t0 = micros();
+        gui_overlay_close(b);
+        lv_refr_now(disp);
+        rerender_us += micros() - t0;
+    }
+
+    s_bench = false;
+    memcpy(fb, saved, fb_size);
+    heap_caps_free(saved);
+    gui_port_hold_refresh(false);
+
+    s_bench_restore_us = restore_us / BENCH_ROUNDS;
+    s_bench_rerender_us = rerender_us / BENCH_ROUNDS;
+    LOG_I("[Overlay] Toast close: restore %lu us, re-render %lu us", s_bench_restore_us, s_bench_rerender_us);
+}
+
+/**
+ * @brief 输出统计
+ */
+void gui_overlay_report(void) {
+    LOG_I("[Overlay] open=%lu restore=%lu (avg %lu us) re-render=%lu stale=%lu, snapshot %lu B (peak %lu B)",
+          s_opens, s_restores, s_restores ? s_restore_us / s_restores : 0, s_fallbacks, s_stales,
+          s_snap_bytes, s_snap_peak);
+    if (s_bench_restore_us || s_bench_rerender_us) {
+        LOG_RAW("  bench: restore %lu us vs re-render %lu us\n", s_bench_restore_us, s_bench_rerender_us);
+    }
+}
@@ -0,0 +1,86 @@
+/**
+ * @file gui_overlay.h
+ * @brief 弹窗 / 提示 / 键盘等覆盖层的显存快照与恢复
+ * @details 覆盖层关闭时 LVGL 会把它盖住的区域连同下面的全部控件重新渲染一遍，再逐像素转换为 1bit。
+ *          而下面的画面在覆盖层打开前就在显存里，本模块在打开时把被覆盖区域的 1bit 显存存为快照，
+ *          关闭时暂停 LVGL 失效登记删除覆盖层，把快照拷回显存，只局刷这一块区域。
+ *          - 覆盖层打开期间下面的控件发生变化 (失效区域与快照相交且不属于覆盖层)，快照作废，
+ *            关闭时退回由 LVGL 重新渲染；
+ *          - 后打开的覆盖层与之重叠且尚未关闭时同样退回重新渲染；
+ *          - 覆盖层被其他途径删除 (如切换页面) 时自动释放快照。
+ *          失效来源由 gui_inv 的 --wrap 挂钩提供。所有接口只在 GUI 线程中调用。
+ */
+#ifndef GUI_OVERLAY_H
+#define GUI_OVERLAY_H
+
+#include <lvgl.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// 同时打开的覆盖层个数上限
+#ifndef GUI_OVERLAY_MAX
+#define GUI_OVERLAY_MAX 4
+#endif
+
+// 恢复快照后的刷新方式
+#ifndef GUI_OVERLAY_MODE
+#define GUI_OVERLAY_MODE EPD_REFRESH_PARTIAL
+#endif
+
+// 关闭时测量关闭到上墨的延迟 (gui_port_latency_probe)
+#ifndef GUI_OVERLAY_PROBE
+#define GUI_OVERLAY_PROBE 1
+#endif
+
+// 启动时对比快照恢复与 LVGL 重新渲染关闭同一个提示框的耗时
+#ifndef GUI_OVERLAY_BENCH
+#define GUI_OVERLAY_BENCH 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 登记覆盖层并保存它将盖住的显存
+ * @details 应在覆盖层创建后、首次渲染前调用 (最好创建时带 LV_OBJ_FLAG_HIDDEN，由本函数显示)。
+ *          被覆盖区域还有未渲染的变化时先渲染一次，保证快照就是下面的画面。
+ * @param obj 覆盖层 (通常位于 lv_layer_top)
+ * @return false 未登记 (显存未分配、个数已满、内存不足或三色屏)，此时覆盖层照常显示，关闭时走重新渲染
+ */
+bool gui_overlay_open(lv_obj_t *obj);
+
+/**
+ * @brief 关闭 (删除) 覆盖层
+ * @details 快照有效时恢复显存并局刷该区域，否则按普通方式删除由 LVGL 重新渲染。
+ *          未登记的控件直接删除。
+ */
+void gui_overlay_close(lv_obj_t *obj);
+
+/**
+ * @brief 在屏幕底部显示一条提示，ms 毫秒后自动关闭
+ * @param text 提示文字 (复制保存)
+ */
+void gui_overlay_toast(const char *text, uint32_t ms);
+
+/**
+ * @brief 记录一块脏区域 (在 rounder_cb 中调用，判断快照是否作废)
+ */
+void gui_overlay_on_area(const lv_area_t *area);
+
+/**
+ * @brief 基准测试：同一个提示框分别用快照恢复与重新渲染关闭，输出 CPU 耗时
+ * @details 测试期间扣住刷屏，结束后恢复显存，不产生实际刷新。须在首页显示之后调用。
+ */
+void gui_overlay_bench(void);
+
+/**
+ * @brief 输出统计 (打开、恢复、退回重新渲染次数，关闭耗时，快照内存)
+ */
+void gui_overlay_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_OVERLAY_H
@@ -0,0 +1,246 @@
+/**
+ * @file gui_pack.cpp
+ * @brief 资源包实现
+ * @details
+ * 资源包格式见 tools/asset_pack.py。挂载流程：
+ * 1. esp_partition_read 读头部，检查 magic / 版本 / 大小；
+ * 2. esp_partition_mmap 映射 [0, image_size)，校验 CRC-32 (整包只在启动时校验一次)；
+ * 3. 为每个图片条目生成一个 lv_img_dsc_t (放在内部 RAM，每个 16 B)，data 指向映射地址。
+ * 映射在整个运行期间保持，不解除。所有接口只在 GUI 线程中调用。
+ */
+#include "gui_pack.h"
+#include "common/Log.h"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <esp_idf_version.h>
+#include <esp_partition.h>
+#include <esp_rom_crc.h>
+
+#define EPA_MAGIC "EPA1"
+
+// IDF 5 起映射句柄与解除映射改为 esp_partition_* 接口
+#if ESP_IDF_VERSION_MAJOR >= 5
+typedef esp_partition_mmap_handle_t pack_mmap_handle_t;
+#define PACK_MMAP_DATA ESP_PARTITION_MMAP_DATA
+#define PACK_MUNMAP(h) esp_partition_munmap(h)
+#else
+typedef spi_flash_mmap_handle_t pack_mmap_handle_t;
+#define PACK_MMAP_DATA SPI_FLASH_MMAP_DATA
+#define PACK_MUNMAP(h) spi_flash_munmap(h)
+#endif
+
+/**
+ * @brief 资源包头部
+ */
+typedef struct __attribute__((packed)) {
+    char magic[4];
+    uint16_t version;
+    uint16_t count;
+    uint32_t index_offset;
+    uint32_t image_size;
+    uint32_t build;
+    uint32_t crc32;
+    uint8_t reserved[8];
+} epa_header_t;
+
+/**
+ * @brief 索引条目
+ */
+typedef struct __attribute__((packed)) {
+    char name[16];
+    uint8_t fmt;
+    uint8_t reserved;
+    uint16_t w;
+    uint16_t h;
+    uint16_t reserved2;
+    uint32_t offset;
+    uint32_t size;
+} epa_entry_t;
+
+/**
+ * @brief 登记的内置图片
+ */
+typedef struct {
+    const char *name;
+    const lv_img_dsc_t *builtin;
+    const lv_img_dsc_t *packed;   ///< 包内同名图片 (没有则为 NULL)
+} builtin_t;
+
+static const uint8_t *s_map = NULL;
+static epa_header_t s_hdr;
+static const epa_entry_t *s_index = NULL;
+static lv_img_dsc_t *s_imgs = NULL;      ///< 与索引一一对应 (非图片条目不使用)
+static builtin_t s_builtins[GUI_PACK_BUILTIN_MAX];
+static uint16_t s_builtin_cnt = 0;
+
+// 统计
+static uint32_t s_mount_us = 0;
+static uint32_t s_replaced = 0;
+
+static inline bool _is_img(const epa_entry_t *e) {
+    return e->fmt == GUI_PACK_FMT_1BIT || e->fmt == GUI_PACK_FMT_RLE;
+}
+
+/**
+ * @brief 按名称查找索引条目
+ * @return 条目序号，找不到返回 -1
+ */
+static int _find(const char *name, uint8_t fmt) {
+    if (s_map == NULL || name == NULL) return -1;
+    for (uint16_t i = 0; i < s_hdr.count; i++) {
+        if (s_index[i].fmt == fmt && strncmp(s_index[i].name, name, sizeof(s_index[i].name)) == 0) return i;
+    }
+    return -1;
+}
+
+/**
+ * @brief 映射 assets 分区并校验资源包
+ */
+bool gui_pack_init(void) {
+    if (s_map != NULL) return true;
+    uint32_t t0 = micros();
+
+    const esp_partition_t *part =
+        esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, GUI_PACK_PARTITION);
+    if (part == NULL) {
+        LOG_I("[Pack] No '%s' partition, using built-in assets", GUI_PACK_PARTITION);
+        return false;
+    }
+    if (esp_partition_read(part, 0, &s_hdr, sizeof(s_hdr)) != ESP_OK ||
+        memcmp(s_hdr.magic, EPA_MAGIC, 4) != 0 || s_hdr.version != 1 ||
+        s_hdr.image_size > part->size || s_hdr.image_size < sizeof(s_hdr) ||
+        s_hdr.index_offset + (uint32_t)s_hdr.count * sizeof(epa_entry_t) > s_hdr.image_size) {
+        LOG_I("[Pack] No asset pack in '%s', using built-in assets", GUI_PACK_PARTITION);
+        return false;
+    }
+
+    const void *ptr = NULL;
+    pack_mmap_handle_t handle;
+    esp_err_t err = esp_partition_mmap(part, 0, s_hdr.image_size, PACK_MMAP_DATA, &ptr, &handle);
+    if (err != ESP_OK) {
+        LOG_E("[Pack] mmap failed (%d)", err);
+        return false;
+    }
+
+    const uint8_t *map = (const uint8_t *)ptr;
+    uint32_t crc = esp_rom_crc32_le(0, map + sizeof(s_hdr), s_hdr.image_size - sizeof(s_hdr));
+    if (crc != s_hdr.crc32) {
+        LOG_E("[Pack] CRC mismatch (%08lx != %08lx), using built-in assets", crc, s_hdr.crc32);
+        PACK_MUNMAP(handle);
+        return false;
+    }
+
+    const epa_entry_t *index = (const epa_entry_t *)(map + s_hdr.index_offset);
+    s_imgs = (lv_img_dsc_t *)heap_caps_calloc(s_hdr.count ? s_hdr.count : 1, sizeof(lv_img_dsc_t), MALLOC_CAP_INTERNAL);
+    if (s_imgs == NULL) {
+        LOG_E("[Pack] Descriptor alloc failed");
+        PACK_MUNMAP(handle);
+        return false;
+    }
+
+    uint16_t imgs = 0;
+    for (uint16_t i = 0; i < s_hdr.count; i++) {
+        const epa_entry_t *e = &index[i];
+        if (e->offset + e->size > s_hdr.image_size) {
+            LOG_E("[Pack] Entry %.16s out of range, skipped", e->name);
+            continue;
+        }
+        if (!_is_img(e)) continue;
+        lv_img_dsc_t *d = &s_imgs[i];
+        d->header.always_zero = 0;
+        d->header.w = e->w;
+        d->header.h = e->h;
+        d->header.cf = e->fmt == GUI_PACK_FMT_RLE ? LV_IMG_CF_USER_ENCODED_0 : LV_IMG_CF_ALPHA_1BIT;
+        d->data_size = e->size;
+        d->data = map + e->offset;
+        imgs++;
+    }
+
+    s_map = map;
+    s_index = index;
+    s_mount_us = micros() - t0;
+    LOG_I("[Pack] Mapped %lu B at %p: %u entries (%u images), build %lu, %lu us",
+          s_hdr.image_size, s_map, s_hdr.count, imgs, s_hdr.build, s_mount_us);
+
+    // 挂载前登记的内置图片
+    for (uint16_t i = 0; i < s_builtin_cnt; i++) s_builtins[i].packed = gui_pack_img(s_builtins[i].name);
+    return true;
+}
+
+/**
+ * @brief 按名称查找资源
+ */
+const void *gui_pack_find(const char *name, gui_pack_fmt_t fmt, uint32_t *size) {
+    int i = _find(name, fmt);
+    if (i < 0 || s_index[i].offset + s_index[i].size > s_hdr.image_size) return NULL;
+    if (size) *size = s_index[i].size;
+    return s_map + s_index[i].offset;
+}
+
+/**
+ * @brief 按名称取图片描述符
+ */
+const lv_img_dsc_t *gui_pack_img(const char *name) {
+    int i = _find(name, GUI_PACK_FMT_RLE);
+    if (i < 0) i = _find(name, GUI_PACK_FMT_1BIT);
+    if (i < 0 || s_imgs[i].data == NULL) return NULL;
+    return &s_imgs[i];
+}
+
+/**
+ * @brief 登记固件内置图片的名称
+ */
+void gui_pack_register_img(const char *name, const lv_img_dsc_t *builtin) {
+    if (s_builtin_cnt >= GUI_PACK_BUILTIN_MAX) {
+        LOG_E("[Pack] Builtin table full, %s not registered", name);
+        return;
+    }
+    builtin_t &b = s_builtins[s_builtin_cnt++];
+    b.name = name;
+    b.builtin = builtin;
+    b.packed = gui_pack_img(name);
+}
+
+/**
+ * @brief 内置图片对应的包内图片
+ */
+static const void *_replacement(const void *src) {
+    if (src == NULL) return NULL;
+    for (uint16_t i = 0; i < s_builtin_cnt; i++) {
+        if (s_builtins[i].builtin == src) return s_builtins[i].packed;
+    }
+    return NULL;
+}
+
+/**
+ * @brief 页面上引用内置图片的控件改用资源包中的图片
+ */
+void gui_pack_apply(lv_obj_t *scr) {
+    if (s_map == NULL || scr == NULL) return;
+
+    const void *rep;
+    lv_style_value_t v;
+    if (lv_obj_get_local_style_prop(scr, LV_STYLE_BG_IMG_SRC, &v, LV_PART_MAIN) == LV_STYLE_RES_FOUND &&
+        (rep = _replacement(v.ptr)) != NULL) {
+        lv_obj_set_style_bg_img_src(scr, rep, LV_PART_MAIN);
+        s_replaced++;
+    }
+    if (lv_obj_check_type(scr, &lv_img_class) && (rep = _replacement(lv_img_get_src(scr))) != NULL) {
+        lv_img_set_src(scr, rep);
+        s_replaced++;
+    }
+
+    uint32_t cnt = lv_obj_get_child_cnt(scr);
+    for (uint32_t i = 0; i < cnt; i++) gui_pack_apply(lv_obj_get_child(scr, i));
+}
+
+/**
+ * @brief 输出资源包信息
+ */
+void gui_pack_report(void) {
+    if (s_map == NULL) return;
+    uint16_t overridden = 0;
+    for (uint16_t i = 0; i < s_builtin_cnt; i++) overridden += s_builtins[i].packed != NULL;
+    LOG_I("[Pack] %u entries, %lu B mapped, build %lu, mount %lu us, builtins overridden %u/%u, replaced=%lu",
+          s_hdr.count, s_hdr.image_size, s_hdr.build, s_mount_us, overridden, s_builtin_cnt, s_replaced);
+}
@@ -0,0 +1,87 @@
+/**
+ * @file gui_pack.h
+ * @brief 资源包 (assets 分区，内存映射)
+ * @details 编译进固件的图片和字体改动一次就要重新烧录整个固件，固件也随资源增多而变大。
+ *          资源包由 tools/asset_pack.py 生成 (EPA1 格式，带索引)，单独烧录到 assets 分区，
+ *          启动时用 esp_partition_mmap 整包映射到地址空间：
+ *          - 图片描述符 (lv_img_dsc_t) 的 data 直接指向映射后的 flash，不拷贝到 RAM；
+ *          - EPF1 字体交给 gui_font_stream 按映射地址直接取字形 (不再需要字形缓存)；
+ *          - 固件内置图片登记名称后，页面构建时自动换成包内的同名图片，包里没有的继续用内置版本。
+ */
+#ifndef GUI_PACK_H
+#define GUI_PACK_H
+
+#include <lvgl.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// 分区名称 (partitions.csv)
+#ifndef GUI_PACK_PARTITION
+#define GUI_PACK_PARTITION "assets"
+#endif
+
+// 可登记的内置图片数
+#ifndef GUI_PACK_BUILTIN_MAX
+#define GUI_PACK_BUILTIN_MAX 16
+#endif
+
+/**
+ * @brief 资源格式 (与 tools/asset_pack.py 一致)
+ */
+typedef enum {
+    GUI_PACK_FMT_RAW = 0,    ///< 原始数据
+    GUI_PACK_FMT_1BIT,       ///< 1bit 图片 (LV_IMG_CF_ALPHA_1BIT)
+    GUI_PACK_FMT_RLE,        ///< 游程压缩 1bit 图片 (gui_asset 解码)
+    GUI_PACK_FMT_EPF1,       ///< EPF1 字体镜像 (gui_font_stream)
+} gui_pack_fmt_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 映射 assets 分区并校验资源包
+ * @return false 分区不存在、包无效或映射失败 (界面继续使用内置资源)
+ * @details 须在 gui_font_stream_init 与构建页面之前调用。
+ */
+bool gui_pack_init(void);
+
+/**
+ * @brief 按名称查找资源
+ * @param name 名称
+ * @param fmt  期望的格式
+ * @param size 输出数据字节数 (可为 NULL)
+ * @return 映射后的数据地址 (只读，长期有效)，找不到返回 NULL
+ */
+const void *gui_pack_find(const char *name, gui_pack_fmt_t fmt, uint32_t *size);
+
+/**
+ * @brief 按名称取图片描述符 (data 指向映射后的 flash)
+ * @return 描述符，找不到返回 NULL
+ */
+const lv_img_dsc_t *gui_pack_img(const char *name);
+
+/**
+ * @brief 登记固件内置图片的名称 (页面构建时换成包内的同名图片)
+ * @param name    资源包中的名称 (tools/asset_pack.py 取自符号名，如 ui_img_back_png -> "back")
+ * @param builtin 内置图片
+ */
+void gui_pack_register_img(const char *name, const lv_img_dsc_t *builtin);
+
+/**
+ * @brief 页面上引用内置图片的控件改用资源包中的图片
+ * @param scr 页面 (screen_init 之后调用)
+ * @details 替换 lv_img 的图片源与本地样式中的 bg_img_src；资源包未挂载时不做任何事。
+ */
+void gui_pack_apply(lv_obj_t *scr);
+
+/**
+ * @brief 输出资源包信息 (条目数、映射大小、替换次数)
+ */
+void gui_pack_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_PACK_H
@@ -1,4 +1,10 @@
 #include "gui_port.h"
+#include "gui_bwr.h"
+#include "gui_font.h"
+#include "gui_img.h"
+#include "gui_inv.h"
+#include "gui_overlay.h"
+#include "gui_wf.h"
 #include <lvgl.h>
 #include <Arduino.h>
 #include "common/Log.h" // 引入日志系统
@@ -6,6 +12,8 @@
 #include "bsp/bsp_touch.h"
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <freertos/portmacro.h>
 #include "system/SysController.h" // 用于活动计时
 
 #define BLACK 0x00
@@ -27,6 +35,14 @@ static lv_disp_drv_t disp_drv;
 // 【优化】改为指针，后续在 PSRAM 中动态分配
 uint8_t *Paint_Image = NULL;
 uint8_t *Shadow_Image = NULL;
+// 刷屏线程私有的帧副本 (取任务时在 shadow_lock 内从 Shadow_Image 复制，传输与刷新期间 GUI 线程可继续提交)
+static uint8_t *Refresh_Image = NULL;
+#if EPD_BWR
+// 三色屏的红色平面 (布局同 Paint_Image，1:红)
+static uint8_t *Paint_Red = NULL;
+static uint8_t *Shadow_Red = NULL;
+static uint8_t *Refresh_Red = NULL;
+#endif
 
 static uint8_t WidthByte = (EPD_WIDTH % 8 == 0)? (EPD_WIDTH / 8 ): (EPD_WIDTH / 8 + 1);
 
@@ -38,6 +54,45 @@ TaskHandle_t hTouchTask = NULL;
 
 volatile bool is_epd_busy = false;
 
+// 刷新请求序号 (每次真正请求刷屏 +1)，用于延迟测量
+static volatile uint32_t refresh_req_seq = 0;
+// 刷屏请求被扣住 (UI 事务中) 及期间是否有请求
+static bool refresh_held = false;
+static bool refresh_deferred = false;
+// LVGL 渲染次数 (用于空闲刷新统计)
+static volatile uint32_t render_count = 0;
+// 首帧必须刷新 (上电时屏幕内容未知)
+static bool first_frame_pending = true;
+
+/**
+ * @brief 刷屏任务 (GUI 线程写入，刷屏线程取走)
+ * @details 刷屏线程还没取走时又来了新请求，则合并：窗口取并集，刷新方式取更强的一种。
+ */
+typedef struct {
+    bool valid;
+    epd_refresh_mode_t mode;
+    uint16_t x, y, w, h;    ///< 墨水屏原生坐标下的变化区域
+    uint8_t wf;             ///< 决定刷新方式的刷新类别 (gui_wf_class_t，用于按类别统计耗时)
+} refresh_job_t;
+
+static portMUX_TYPE refresh_mux = portMUX_INITIALIZER_UNLOCKED;
+// Shadow_Image 的锁：GUI 线程同步副本、刷屏线程复制快照 (整帧拷贝不能放在关中断的 refresh_mux 内)
+static SemaphoreHandle_t shadow_lock = NULL;
+static refresh_job_t pending_job = {};
+// 先于 pending_job 执行的局刷子任务 (gui_wf 拆分出的局刷类区域)
+static refresh_job_t pending_split = {};
+// 下一次刷屏使用的方式 (一次性，由 gui_port_request_mode 设置)
+static epd_refresh_mode_t next_mode = EPD_REFRESH_FULL;
+// 控制器旧图 RAM 无效 (上电 / 唤醒)，下一次必须全刷
+static volatile bool force_full = true;
+// 自上次全刷以来的连续局刷次数
+static uint16_t partial_streak = 0;
+
+// 输入到上墨延迟测量
+static const char * volatile probe_tag = NULL;
+static volatile uint32_t probe_seq = 0;
+static volatile uint32_t probe_start_ms = 0;
+
 // === 全局触摸缓存 (用于任务间通信) ===
 // 避免 GUI 线程再次读取 I2C，直接拿结果
 volatile bool g_touch_pressed = false;
@@ -112,37 +167,322 @@ void my_touch_read(lv_indev_drv_t * indev_driver, lv_indev_data_t * data) {
 }
 
 /* ==================================================================
- * 3. 显示刷新 (保持不变)
+ * 3. 显示刷新
  * LVGL 渲染完成后的回调，将像素数据转换为墨水屏格式并触发刷新
  * ================================================================== */
-void disp_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p) {
+
+/**
+ * @brief 将 LVGL 区域像素映射到 1bit 显存
+ * @details 横屏映射: LVGL 的 (x, y) 对应墨水屏的 (y, x)。
+ *          纯白 (0xFFFF) 为白，其余一律视为黑。
+ */
+void gui_port_convert_area(uint8_t *fb, const lv_area_t *area, const lv_color_t *color_p) {
     uint32_t w = (area->x2 - area->x1 + 1);
-    
+
     for(int y_lv = area->y1; y_lv <= area->y2; y_lv++) {
-        for(int x_lv = area->x1; x_lv <= area->x2; x_lv++) {
-            uint16_t pixel_color = color_p[(x_lv - area->x1) + (y_lv - area->y1) * w].full;
-            if(pixel_color==0xffff){
-                Paint_SetPixel(y_lv, x_lv, WHITE);
-            }else{
-                Paint_SetPixel(y_lv, x_lv, BLACK);
-
-            }
+        // 逻辑行 y_lv 对应墨水屏的第 y_lv 列，位掩码在整行内不变
+        if (y_lv < 0 || y_lv >= EPD_WIDTH) continue;
+        uint8_t mask = 0x80 >> (y_lv % 8);
+        uint32_t col = y_lv / 8;
+        const lv_color_t *src = &color_p[(y_lv - area->y1) * w];
+
+        for(int x_lv = area->x1; x_lv <= area->x2; x_lv++, src++) {
+            if (x_lv < 0 || x_lv >= EPD_HEIGHT) continue;
+            uint8_t *dst = &fb[col + x_lv * WidthByte];
+            if (src->full == 0xffff) *dst |= mask;
+            else                     *dst &= ~mask;
+        }
+    }
+}
+
+/**
+ * @brief 把一个平面与其副本的差异并入外接矩形 (行区间 + 字节列区间)
+ */
+static void _diff_plane(const uint8_t *cur, const uint8_t *prev, int *row0, int *row1, int *col0, int *col1) {
+    for (int row = 0; row < EPD_HEIGHT; row++) {
+        const uint8_t *a = cur + row * WidthByte;
+        const uint8_t *b = prev + row * WidthByte;
+        if (memcmp(a, b, WidthByte) == 0) continue;
+
+        if (*row0 < 0 || row < *row0) *row0 = row;
+        if (row > *row1) *row1 = row;
+        for (int c = 0; c < *col0; c++) {
+            if (a[c] != b[c]) { *col0 = c; break; }
+        }
+        for (int c = WidthByte - 1; c > *col1; c--) {
+            if (a[c] != b[c]) { *col1 = c; break; }
+        }
+    }
+}
+
+/**
+ * @brief 计算 Paint_Image 与 Shadow_Image 的差异外接矩形 (三色屏同时比较红色平面)
+ * @param[out] job 墨水屏原生坐标下的区域 (x/w 以 8 像素对齐)
+ * @return false 两帧完全相同
+ */
+static bool _diff_bbox(refresh_job_t *job) {
+    int row0 = -1, row1 = -1;
+    int col0 = WidthByte, col1 = -1;
+
+    _diff_plane(Paint_Image, Shadow_Image, &row0, &row1, &col0, &col1);
+#if EPD_BWR
+    _diff_plane(Paint_Red, Shadow_Red, &row0, &row1, &col0, &col1);
+#endif
+    if (row0 < 0) return false;
+
+    job->x = col0 * 8;
+    job->w = (col1 - col0 + 1) * 8;
+    job->y = row0;
+    job->h = row1 - row0 + 1;
+    return true;
+}
+
+/**
+ * @brief 把一次刷屏请求合并进待处理任务
+ */
+static void _merge_job(refresh_job_t *dst, const refresh_job_t *job) {
+    if (!dst->valid) {
+        *dst = *job;
+    } else {
+        uint16_t x1 = max(dst->x + dst->w, job->x + job->w);
+        uint16_t y1 = max(dst->y + dst->h, job->y + job->h);
+        dst->x = min(dst->x, job->x);
+        dst->y = min(dst->y, job->y);
+        dst->w = x1 - dst->x;
+        dst->h = y1 - dst->y;
+        // 枚举值越小越 "强" (FULL < FAST < PARTIAL)
+        if (job->mode < dst->mode) {
+            dst->mode = job->mode;
+            dst->wf = job->wf;
         }
     }
+    dst->valid = true;
+}
+
+/**
+ * @brief 把任务区域内的 Paint_Image 同步到 Shadow_Image (须持有 shadow_lock)
+ * @details 区域外两者本就相同 (差异外接矩形) 或不需要提交 (gui_port_refresh_region)。
+ */
+static void _sync_shadow(const refresh_job_t *job) {
+    const uint16_t xb = job->x / 8, nb = job->w / 8;
+    for (uint16_t row = job->y; row < job->y + job->h; row++) {
+        memcpy(Shadow_Image + row * WidthByte + xb, Paint_Image + row * WidthByte + xb, nb);
+#if EPD_BWR
+        memcpy(Shadow_Red + row * WidthByte + xb, Paint_Red + row * WidthByte + xb, nb);
+#endif
+    }
+}
+
+/**
+ * @brief 同步副本并把任务并入待处理任务
+ * @details 副本的写入与刷屏线程复制副本都持有 shadow_lock，刷屏线程不会读到一半新一半旧的帧；
+ *          入队在副本写完之后、释放锁之前，刷屏线程取到任务时副本已包含该区域。
+ */
+static void _queue_job(const refresh_job_t *job, const refresh_job_t *split = NULL) {
+    xSemaphoreTake(shadow_lock, portMAX_DELAY);
+    _sync_shadow(job);
+    portENTER_CRITICAL(&refresh_mux);
+    if (split != NULL) _merge_job(&pending_split, split);
+    _merge_job(&pending_job, job);
+    portEXIT_CRITICAL(&refresh_mux);
+    xSemaphoreGive(shadow_lock);
+}
+
+/**
+ * @brief 请求墨水屏刷新 Paint_Image 中的当前内容
+ * @details 内容与上一帧完全相同时跳过刷新 (首帧除外)，
+ *          避免预渲染帧提交后 LVGL 再渲染一遍相同画面导致重复刷屏。
+ *          有变化时记下变化区域，供局刷只刷这一块。
+ */
+static void _request_refresh(void) {
+    if (refresh_held) {
+        // 事务提交时再比较并刷新，多次请求合并为一次
+        refresh_deferred = true;
+        return;
+    }
+
+    refresh_job_t job = {true, next_mode, 0, 0, EPD_WIDTH, EPD_HEIGHT};
+    if (!first_frame_pending && !_diff_bbox(&job)) {
+        LOG_D("[EPD] Frame unchanged, skip refresh");
+        next_mode = EPD_REFRESH_FULL;
+        gui_wf_reset();
+        gui_inv_on_refresh(false);
+        return;
+    }
+
+    // 按本帧脏区域的刷新类别决定方式 (首帧屏幕内容未知，保持全刷)
+    refresh_job_t split = {};
+    gui_wf_plan_t plan;
+    if (first_frame_pending) {
+        gui_wf_reset();
+    } else if (gui_wf_plan(next_mode, &plan)) {
+        job.mode = plan.mode;
+        job.wf = plan.cls;
+        if (plan.split && !EPD_BWR) {
+            // 逻辑 (x, y) 对应原生第 x 行、第 y 位
+            uint16_t x0 = plan.split_area.y1 & ~7;
+            uint16_t x1 = min((plan.split_area.y2 + 8) & ~7, EPD_WIDTH);
+            split = {true, EPD_REFRESH_PARTIAL, x0, (uint16_t)plan.split_area.x1, (uint16_t)(x1 - x0),
+                     (uint16_t)(plan.split_area.x2 - plan.split_area.x1 + 1), GUI_WF_PARTIAL};
+        }
+    }
+    next_mode = EPD_REFRESH_FULL;
+    if (first_frame_pending) {
+        // 启动到首帧: 从上电到 LVGL 交出第一帧 (不含墨水屏刷新时间)
+#if LV_MEM_CUSTOM == 0
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        LOG_I("[EPD] First frame at %lu ms after boot, lv_mem peak %lu B",
+              millis(), (unsigned long)mon.max_used);
+#else
+        LOG_I("[EPD] First frame at %lu ms after boot", millis());
+#endif
+    }
+    first_frame_pending = false;
+
+    _queue_job(&job, split.valid ? &split : NULL);
+    refresh_req_seq++;
+    gui_inv_on_refresh(true);
+    if (hEPDTask != NULL) xTaskNotifyGive(hEPDTask);
+}
+
+void disp_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p) {
+#if EPD_BWR
+    gui_bwr_convert_area(Paint_Image, Paint_Red, area, color_p);
+#else
+    gui_port_convert_area(Paint_Image, area, color_p);
+#endif
     
     // 如果是最后一块数据，触发物理刷新
     if (lv_disp_flush_is_last(disp_drv)) {
         // 【优化】移除 is_epd_busy 检查，强制刷新
         // 之前如果上一帧正在刷，会直接丢弃当前帧，导致页面切换后屏幕不更新
         // 虽然有撕裂风险，但对于 EPD 来说，显示最新内容更重要
-        // if (!is_epd_busy) {
-            memcpy(Shadow_Image, Paint_Image, PAINT_BUF_SIZE);
-            if (hEPDTask != NULL) xTaskNotifyGive(hEPDTask);
-        // }
+        _request_refresh();
     }
     lv_disp_flush_ready(disp_drv);
 }
 
+/**
+ * @brief 脏区域回调 (LVGL 每登记一块脏区域调用一次)
+ * @details 不修改区域，仅交给 gui_inv 记录失效来源、gui_overlay 判断快照是否作废、
+ *          gui_wf 按刷新类别归类。
+ *          渲染过程中 LVGL 还会用一条探测区域 (0,0)-(0,n) 调用本回调以计算每次渲染的最大行数，
+ *          它不是失效区域，不交给各模块。
+ */
+static void disp_rounder(lv_disp_drv_t *drv, lv_area_t *area) {
+    LV_UNUSED(drv);
+    lv_disp_t *disp = lv_disp_get_default();
+    if (disp != NULL && disp->rendering_in_progress) return;
+    gui_inv_record_area(area);
+    gui_overlay_on_area(area);
+    gui_wf_on_area(area);
+}
+
+/**
+ * @brief 绘制上下文初始化 (LVGL 软件渲染 + 1bit 字形 / 图片快速路径)
+ */
+static void disp_draw_ctx_init(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx) {
+    lv_draw_sw_init_ctx(drv, draw_ctx);
+    gui_font_install(draw_ctx);
+    gui_img_install(draw_ctx);
+}
+
+/**
+ * @brief 渲染统计回调 (每次 LVGL 完成一次刷新后调用)
+ * @details time 包含样式解析、绘制与 disp_flush 的 1bit 转换，用于对比样式池开关前后的渲染耗时。
+ */
+static void disp_monitor(lv_disp_drv_t *drv, uint32_t time, uint32_t px) {
+    LV_UNUSED(drv);
+    render_count++;
+    LOG_D("[GUI] Render %lu ms, %lu px", time, px);
+}
+
+/**
+ * @brief 直接提交整帧 (用于预渲染帧)
+ */
+void gui_port_present(const uint8_t *frame, const uint8_t *red) {
+    if (frame == NULL || Paint_Image == NULL) return;
+    memcpy(Paint_Image, frame, PAINT_BUF_SIZE);
+#if EPD_BWR
+    if (red != NULL) memcpy(Paint_Red, red, PAINT_BUF_SIZE);
+    else memset(Paint_Red, 0, PAINT_BUF_SIZE);
+#else
+    LV_UNUSED(red);
+#endif
+    _request_refresh();
+}
+
+/**
+ * @brief 墨水屏显存
+ */
+uint8_t *gui_port_framebuffer(void) {
+    return Paint_Image;
+}
+
+/**
+ * @brief 提交显存中的一块区域
+ */
+void gui_port_refresh_region(uint16_t x, uint16_t y, uint16_t w, uint16_t h, epd_refresh_mode_t mode) {
+    if (Paint_Image == NULL || w == 0 || h == 0 || x >= EPD_WIDTH || y >= EPD_HEIGHT) return;
+    if (refresh_held) {
+        // 放行时整帧比较会包含这块区域
+        refresh_deferred = true;
+        return;
+    }
+
+    uint16_t x0 = x & ~7;
+    uint16_t x1 = min((x + w + 7) & ~7, EPD_WIDTH);
+    uint16_t y1 = min(y + h, EPD_HEIGHT);
+
+    // 区域同步到 Shadow_Image 与入队在同一把锁内完成
+    refresh_job_t job = {true, mode, x0, y, (uint16_t)(x1 - x0), (uint16_t)(y1 - y)};
+    _queue_job(&job);
+    refresh_req_seq++;
+    if (hEPDTask != NULL) xTaskNotifyGive(hEPDTask);
+}
+
+/**
+ * @brief 开始一次输入到上墨的延迟测量
+ */
+void gui_port_latency_probe(const char *tag) {
+    probe_seq = refresh_req_seq;
+    probe_start_ms = millis();
+    probe_tag = tag;
+}
+
+/**
+ * @brief 扣住 / 放行刷屏请求
+ */
+void gui_port_hold_refresh(bool hold) {
+    refresh_held = hold;
+    if (!hold && refresh_deferred) {
+        refresh_deferred = false;
+        _request_refresh();
+    }
+}
+
+/**
+ * @brief 指定下一次刷屏的方式
+ */
+void gui_port_request_mode(epd_refresh_mode_t mode) {
+    next_mode = mode;
+}
+
+/**
+ * @brief 累计渲染次数
+ */
+uint32_t gui_port_render_count(void) {
+    return render_count;
+}
+
+/**
+ * @brief 累计刷屏请求次数
+ */
+uint32_t gui_port_refresh_count(void) {
+    return refresh_req_seq;
+}
+
 /* ==================================================================
  * 4. 后台刷屏任务
  * 接收刷新信号，执行耗时的 SPI 刷屏操作，避免阻塞 GUI 线程
@@ -150,11 +490,83 @@ void disp_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *colo
 void Task_EPD_Refresh(void *pvParameters) {
     while(1) {
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+#if EPD_BWR
+        // 三色刷新一旦开始不能中断，稍等片刻让紧随其后的几帧合并进来
+        vTaskDelay(pdMS_TO_TICKS(EPD_BWR_SETTLE_MS));
+        ulTaskNotifyTake(pdTRUE, 0);
+#endif
+        uint32_t seq = refresh_req_seq;
+
+        // 取任务在 refresh_mux 内，整帧快照只持有 shadow_lock (GUI 线程此时最多等一次拷贝)
+        xSemaphoreTake(shadow_lock, portMAX_DELAY);
+        portENTER_CRITICAL(&refresh_mux);
+        refresh_job_t job = pending_job;
+        refresh_job_t split = pending_split;
+        pending_job.valid = false;
+        pending_split.valid = false;
+        portEXIT_CRITICAL(&refresh_mux);
+        if (job.valid) {
+            memcpy(Refresh_Image, Shadow_Image, PAINT_BUF_SIZE);
+#if EPD_BWR
+            memcpy(Refresh_Red, Shadow_Red, PAINT_BUF_SIZE);
+#endif
+        }
+        xSemaphoreGive(shadow_lock);
+        if (!job.valid) continue;
+
+#if EPD_BWR
+        // 0x26 为红色平面，没有局刷 / 快刷的旧图基准，只能整屏三色刷新
+        job.mode = EPD_REFRESH_FULL;
+        split.valid = false;
+#else
+        // 旧图 RAM 无效或局刷次数过多 (残影累积) 时升级为全刷
+        if (job.mode != EPD_REFRESH_FULL && (force_full || partial_streak >= EPD_PARTIAL_MAX)) {
+            job.mode = EPD_REFRESH_FULL;
+        }
+#endif
+
         is_epd_busy = true;
+        uint32_t t0 = millis();
+        // 局刷类区域先上墨 (旧图 RAM 无效时局刷不可用，随整屏刷新一起出现)
+        if (split.valid && !force_full && job.mode != EPD_REFRESH_PARTIAL) {
+            bsp_epd_display_window(Refresh_Image, split.x, split.y, split.w, split.h);
+            gui_wf_on_refresh(split.wf, EPD_REFRESH_PARTIAL, millis() - t0);
+            LOG_D("[EPD] Split partial %ux%u @(%u,%u): %lu ms", split.w, split.h, split.x, split.y, millis() - t0);
+            t0 = millis();
+        }
 // 刷屏
-        bsp_epd_display_full(Shadow_Image); 
+        switch (job.mode) {
+            case EPD_REFRESH_PARTIAL:
+                bsp_epd_display_window(Refresh_Image, job.x, job.y, job.w, job.h);
+                partial_streak++;
+                break;
+            case EPD_REFRESH_FAST:
+                bsp_epd_display_fast(Refresh_Image);
+                partial_streak++;
+                break;
+            default:
+#if EPD_BWR
+                bsp_epd_display_bwr(Refresh_Image, Refresh_Red);
+#else
+                bsp_epd_display_full(Refresh_Image);
+#endif
+                partial_streak = 0;
+                force_full = false;
+                break;
+        }
         
         is_epd_busy = false;
+        gui_wf_on_refresh(job.wf, job.mode, millis() - t0);
+        LOG_D("[EPD] %s refresh %ux%u @(%u,%u): %lu ms",
+              job.mode == EPD_REFRESH_PARTIAL ? "Partial" : (job.mode == EPD_REFRESH_FAST ? "Fast" : (EPD_BWR ? "Tri-colour" : "Full")),
+              job.w, job.h, job.x, job.y, millis() - t0);
+
+        // 完成延迟测量: 只统计测量开始之后请求的刷新
+        const char *tag = probe_tag;
+        if (tag != NULL && seq != probe_seq) {
+            LOG_I("[EPD] %s: input -> ink %lu ms", tag, millis() - probe_start_ms);
+            probe_tag = NULL;
+        }
         
         // 刷屏也算活动
         SysController::updateActivity();
@@ -177,17 +589,32 @@ void gui_port_init(void) {
     buf_1 = (lv_color_t *)heap_caps_malloc(LVGL_BUF_SIZE * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
     buf_2 = (lv_color_t *)heap_caps_malloc(LVGL_BUF_SIZE * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
 
-    // 分配墨水屏显存 (约 12KB)
+    // 分配墨水屏显存 (约 18KB)
     Paint_Image = (uint8_t *)heap_caps_malloc(PAINT_BUF_SIZE, MALLOC_CAP_SPIRAM);
     Shadow_Image = (uint8_t *)heap_caps_malloc(PAINT_BUF_SIZE, MALLOC_CAP_SPIRAM);
+    Refresh_Image = (uint8_t *)heap_caps_malloc(PAINT_BUF_SIZE, MALLOC_CAP_SPIRAM);
 
     // 简单的空指针检查 (防止 PSRAM 未启用导致崩溃)
-    if (!buf_1 || !Paint_Image) {
+    if (!buf_1 || !Paint_Image || !Shadow_Image || !Refresh_Image) {
         LOG_E("ERROR: Failed to allocate memory in PSRAM!");
     }
 
+#if EPD_BWR
+    // 三色屏红色平面 (约 18KB)
+    Paint_Red = (uint8_t *)heap_caps_malloc(PAINT_BUF_SIZE, MALLOC_CAP_SPIRAM);
+    Shadow_Red = (uint8_t *)heap_caps_malloc(PAINT_BUF_SIZE, MALLOC_CAP_SPIRAM);
+    Refresh_Red = (uint8_t *)heap_caps_malloc(PAINT_BUF_SIZE, MALLOC_CAP_SPIRAM);
+    if (!Paint_Red || !Shadow_Red || !Refresh_Red) {
+        LOG_E("ERROR: Failed to allocate red plane in PSRAM!");
+    } else {
+        memset(Paint_Red, 0, PAINT_BUF_SIZE);
+        memset(Shadow_Red, 0, PAINT_BUF_SIZE);
+    }
+#endif
+
     Paint_Clear(WHITE); 
     memcpy(Shadow_Image, Paint_Image, PAINT_BUF_SIZE);
+    shadow_lock = xSemaphoreCreateMutex();
     
     // 刷一次白屏 (注释掉以加快启动速度，且避免首帧被忽略的问题)
     // bsp_epd_clear(WHITE); 
@@ -205,6 +632,9 @@ void gui_port_init(void) {
     disp_drv.ver_res = EPD_WIDTH;  
     disp_drv.draw_buf = &draw_buf;
     disp_drv.flush_cb = disp_flush;
+    disp_drv.monitor_cb = disp_monitor;
+    disp_drv.rounder_cb = disp_rounder;
+    disp_drv.draw_ctx_init = disp_draw_ctx_init; // 1bit 字体 / 图片直接写像素
     disp_drv.full_refresh = 0; // 局部刷新
 
     lv_disp_drv_register(&disp_drv);
@@ -257,6 +687,8 @@ void gui_exit_sleep(void) {
     // 如果 bsp_epd_init 会清屏，则需要重绘。如果只是电气唤醒，则不需要。
     // 这里假设需要重新初始化才能再次发送命令
     bsp_epd_init();
+    // 深睡后控制器 RAM 内容丢失，局刷缺少差分基准，下一次先全刷
+    force_full = true;
     
     LOG_I("[GUI] Wake up done.");
 }
@@ -1,6 +1,21 @@
 #ifndef GUI_PORT_H
 #define GUI_PORT_H
 
+#include <lvgl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "bsp/bsp_epd.h"
+
+/// 连续局刷/快刷达到该次数后强制全刷一次，清除残影
+#ifndef EPD_PARTIAL_MAX
+#define EPD_PARTIAL_MAX 10
+#endif
+
+/// 三色屏 (EPD_BWR) 收到刷屏请求后等待合并后续请求的时间 (ms)
+#ifndef EPD_BWR_SETTLE_MS
+#define EPD_BWR_SETTLE_MS 500
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -14,10 +29,73 @@ void gui_enter_sleep(void);
 // 退出休眠后的 GUI 恢复 (恢复触摸任务，重置屏幕)
 void gui_exit_sleep(void);
 
+/**
+ * @brief 将 LVGL 渲染结果转换到 1bit 显存
+ * @param fb      目标显存 (墨水屏原生方向, 1 bit/pixel, 0:黑 1:白)
+ * @param area    LVGL 逻辑坐标下的区域 (横屏)
+ * @param color_p 区域像素数据
+ * @details disp_flush 与预渲染 (gui_spec) 共用同一套映射规则。
+ */
+void gui_port_convert_area(uint8_t *fb, const lv_area_t *area, const lv_color_t *color_p);
+
+/**
+ * @brief 直接提交一整帧 1bit 图像并立即触发墨水屏刷新
+ * @param frame 全屏 1bit 图像 (大小 EPD_WIDTH * EPD_HEIGHT / 8)
+ * @param red   同样布局的红色平面 (仅三色屏使用；NULL 时清空红色平面)
+ * @details 同时更新 Paint_Image，之后 LVGL 渲染出相同内容时不会重复刷屏。
+ */
+void gui_port_present(const uint8_t *frame, const uint8_t *red);
+
+/**
+ * @brief 墨水屏显存 (Paint_Image，墨水屏原生方向，1 bit/pixel，0:黑 1:白)
+ * @details 供 gui_fb 直接绘制；写入后须调用 gui_port_refresh_region 提交。
+ */
+uint8_t *gui_port_framebuffer(void);
+
+/**
+ * @brief 提交显存中一块已修改的区域并请求刷新 (不经过 LVGL、不做整帧比较)
+ * @param x, y, w, h 墨水屏原生坐标下的区域 (x / w 自动按 8 像素对齐)
+ * @param mode 刷新方式
+ * @details 只把该区域同步到刷屏线程使用的副本，与其他待处理请求合并。
+ *          刷屏请求被扣住 (UI 事务中) 时，放行后随整帧比较一起刷新。
+ */
+void gui_port_refresh_region(uint16_t x, uint16_t y, uint16_t w, uint16_t h, epd_refresh_mode_t mode);
+
+/**
+ * @brief 开始一次 "输入到上墨" 延迟测量
+ * @param tag 测量标签 (需为常量字符串)
+ * @details 在此之后请求的第一次刷屏完成时，输出耗时日志。
+ */
+void gui_port_latency_probe(const char *tag);
+
+/**
+ * @brief 扣住 / 放行墨水屏刷新请求 (供 gui_txn 使用)
+ * @param hold true: 之后的刷屏请求只记下，不通知刷屏线程; false: 放行，期间有请求则合并为一次刷新
+ */
+void gui_port_hold_refresh(bool hold);
+
+/**
+ * @brief 指定下一次刷屏的方式 (一次性)
+ * @param mode 刷新方式，默认全刷
+ * @details 只作用于之后第一次真正发生的刷屏，随后恢复为全刷。
+ *          局刷只刷新与上一帧的差异区域；刷屏线程还没开始时到达的多次请求会合并，
+ *          合并后采用其中最强的方式。上电/唤醒后的第一次、以及连续 EPD_PARTIAL_MAX
+ *          次局刷/快刷之后，会自动升级为全刷。
+ */
+void gui_port_request_mode(epd_refresh_mode_t mode);
+
+/**
+ * @brief 累计 LVGL 渲染次数 (每次 monitor_cb +1)
+ */
+uint32_t gui_port_render_count(void);
 
+/**
+ * @brief 累计墨水屏刷新请求次数 (跳过的 "帧未变化" 不计入)
+ */
+uint32_t gui_port_refresh_count(void);
 
 #ifdef __cplusplus
 }
 #endif
 
-#endif // GUI_PORT_H
\ No newline at end of file
+#endif // GUI_PORT_H
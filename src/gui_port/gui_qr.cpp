@@ -0,0 +1,631 @@
+/**
+ * @file gui_qr.cpp
+ * @brief 二维码编码与光栅化实现
+ * @details 流程 (ISO/IEC 18004)：
+ *          1. 选模式与版本，写入 "模式 + 字符计数 + 数据 + 终止符 + 填充字节" 比特流；
+ *          2. 数据码字分块，逐块计算 Reed-Solomon 纠错码字 (GF(256)，本原多项式 0x11D)，交织；
+ *          3. 画功能图形 (定位、分隔、定时、校正、格式 / 版本信息)，同时在 s_func 中标记；
+ *          4. 码字按之字形从右下角填入非功能模块；
+ *          5. 逐个试 8 种掩码计算罚分 (N1 ~ N4)，取最小者并写入格式信息。
+ *          所有缓冲区为静态，只在 GUI 线程 (或主机端单线程) 中调用。
+ */
+#include "gui_qr.h"
+#include <string.h>
+#include <stdlib.h>
+#ifndef GUI_QR_HOST
+#include "gui_fb.h"
+#include "common/Log.h"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#endif
+
+#define RAW_CW_MAX   346     ///< 版本 10 的码字总数
+#define ECC_CW_MAX   (8 * 30)
+
+// 每块纠错码字数 [ecc][version]
+static const uint8_t ECC_PER_BLOCK[4][GUI_QR_VER_MAX + 1] = {
+    {0, 7, 10, 15, 20, 26, 18, 20, 24, 30, 18},
+    {0, 10, 16, 26, 18, 24, 16, 18, 22, 22, 26},
+    {0, 13, 22, 18, 26, 18, 24, 18, 22, 20, 24},
+    {0, 17, 28, 22, 16, 22, 28, 26, 26, 24, 28},
+};
+
+// 纠错块数 [ecc][version]
+static const uint8_t NUM_BLOCKS[4][GUI_QR_VER_MAX + 1] = {
+    {0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 4},
+    {0, 1, 1, 1, 2, 2, 4, 4, 4, 5, 5},
+    {0, 1, 1, 2, 2, 4, 4, 6, 6, 8, 8},
+    {0, 1, 1, 2, 4, 4, 4, 5, 6, 8, 8},
+};
+
+// 格式信息中的纠错等级编码 (L M Q H)
+static const uint8_t ECC_FORMAT_BITS[4] = {1, 0, 3, 2};
+
+static const char ALNUM_CHARSET[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:";
+
+typedef enum { MODE_NUMERIC = 0, MODE_ALNUM, MODE_BYTE } qr_mode_t;
+
+static uint8_t s_func[(GUI_QR_SIZE_MAX * GUI_QR_SIZE_MAX + 7) / 8];  ///< 功能模块标记
+static uint8_t s_cw[RAW_CW_MAX];                                      ///< 数据码字 (比特流)
+static uint8_t s_out[RAW_CW_MAX];                                     ///< 交织后的全部码字
+static uint8_t s_ecc[ECC_CW_MAX];                                     ///< 各块纠错码字
+static uint8_t s_gf_exp[512];
+static uint8_t s_gf_log[256];
+static bool s_gf_ready = false;
+
+/* --- GF(256) 与 Reed-Solomon --- */
+
+static void _gf_init(void) {
+    uint16_t x = 1;
+    for (int i = 0; i < 255; i++) {
+        s_gf_exp[i] = (uint8_t)x;
+        s_gf_log[x] = (uint8_t)i;
+        x <<= 1;
+        if (x & 0x100) x ^= 0x11D;
+    }
+    for (int i = 255; i < 512; i++) s_gf_exp[i] = s_gf_exp[i - 255];
+    s_gf_ready = true;
+}
+
+static inline uint8_t _gf_mul(uint8_t a, uint8_t b) {
+    return (a == 0 || b == 0) ? 0 : s_gf_exp[s_gf_log[a] + s_gf_log[b]];
+}
+
+/**
+ * @brief 生成多项式 (x - a^0)(x - a^1)...(x - a^(d-1)) 的系数 (去掉最高次项的 1)
+ */
+static void _rs_divisor(uint8_t *div, uint8_t d) {
+    memset(div, 0, d);
+    div[d - 1] = 1;
+    uint8_t root = 1;
+    for (uint8_t i = 0; i < d; i++) {
+        for (uint8_t j = 0; j < d; j++) {
+            div[j] = _gf_mul(div[j], root);
+            if (j + 1 < d) div[j] ^= div[j + 1];
+        }
+        root = _gf_mul(root, 0x02);
+    }
+}
+
+/**
+ * @brief 多项式除法求余 (纠错码字)
+ */
+static void _rs_remainder(const uint8_t *data, uint16_t len, const uint8_t *div, uint8_t d, uint8_t *out) {
+    memset(out, 0, d);
+    for (uint16_t i = 0; i < len; i++) {
+        uint8_t factor = data[i] ^ out[0];
+        memmove(out, out + 1, d - 1);
+        out[d - 1] = 0;
+        for (uint8_t j = 0; j < d; j++) out[j] ^= _gf_mul(div[j], factor);
+    }
+}
+
+/* --- 容量 --- */
+
+/**
+ * @brief 版本 ver 中可放置码字的模块数 (扣除全部功能图形)
+ */
+static uint16_t _raw_modules(uint8_t ver) {
+    uint16_t n = (16 * ver + 128) * ver + 64;
+    if (ver >= 2) {
+        uint16_t align = ver / 7 + 2;
+        n -= (25 * align - 10) * align - 55;
+        if (ver >= 7) n -= 36;
+    }
+    return n;
+}
+
+static uint16_t _data_codewords(uint8_t ver, uint8_t ecc) {
+    return _raw_modules(ver) / 8 - ECC_PER_BLOCK[ecc][ver] * NUM_BLOCKS[ecc][ver];
+}
+
+static uint8_t _count_bits(qr_mode_t mode, uint8_t ver) {
+    static const uint8_t bits[3][2] = {{10, 12}, {9, 11}, {8, 16}};
+    return bits[mode][ver >= 10 ? 1 : 0];
+}
+
+static uint32_t _payload_bits(qr_mode_t mode, uint16_t len) {
+    switch (mode) {
+        case MODE_NUMERIC: return (uint32_t)len / 3 * 10 + (len % 3 == 0 ? 0 : (len % 3 == 1 ? 4 : 7));
+        case MODE_ALNUM:   return (uint32_t)len / 2 * 11 + (len % 2) * 6;
+        default:           return (uint32_t)len * 8;
+    }
+}
+
+/**
+ * @brief 字节模式容量
+ */
+uint16_t gui_qr_capacity(uint8_t version, gui_qr_ecc_t ecc) {
+    if (version < 1 || version > GUI_QR_VER_MAX || ecc > GUI_QR_ECC_H) return 0;
+    return (_data_codewords(version, ecc) * 8 - 4 - _count_bits(MODE_BYTE, version)) / 8;
+}
+
+/* --- 比特流 --- */
+
+static uint16_t s_bit_len;
+
+static void _put_bits(uint32_t val, uint8_t n) {
+    for (int i = n - 1; i >= 0; i--, s_bit_len++) {
+        if ((val >> i) & 1) s_cw[s_bit_len >> 3] |= 0x80 >> (s_bit_len & 7);
+    }
+}
+
+static int _alnum_index(uint8_t c) {
+    const char *p = strchr(ALNUM_CHARSET, c);
+    return (c != 0 && p != NULL) ? (int)(p - ALNUM_CHARSET) : -1;
+}
+
+static void _put_payload(qr_mode_t mode, const uint8_t *data, uint16_t len) {
+    uint16_t i = 0;
+    switch (mode) {
+        case MODE_NUMERIC:
+            for (; i + 3 <= len; i += 3) _put_bits((data[i] - '0') * 100 + (data[i + 1] - '0') * 10 + (data[i + 2] - '0'), 10);
+            if (len - i == 2) _put_bits((data[i] - '0') * 10 + (data[i + 1] - '0'), 7);
+            else if (len - i == 1) _put_bits(data[i] - '0', 4);
+            break;
+        case MODE_ALNUM:
+            for (; i + 2 <= len; i += 2) _put_bits(_alnum_index(data[i]) * 45 + _alnum_index(data[i + 1]), 11);
+            if (i < len) _put_bits(_alnum_index(data[i]), 6);
+            break;
+        default:
+            for (; i < len; i++) _put_bits(data[i], 8);
+            break;
+    }
+}
+
+/* --- 模块矩阵 --- */
+
+static uint8_t s_size;
+
+static inline void _bit_set(uint8_t *m, uint8_t x, uint8_t y, bool v) {
+    uint16_t i = (uint16_t)y * s_size + x;
+    if (v) m[i >> 3] |= 0x80 >> (i & 7);
+    else m[i >> 3] &= ~(0x80 >> (i & 7));
+}
+
+static inline bool _bit_get(const uint8_t *m, uint8_t x, uint8_t y) {
+    uint16_t i = (uint16_t)y * s_size + x;
+    return (m[i >> 3] >> (7 - (i & 7))) & 1;
+}
+
+static inline void _set_func(gui_qr_t *qr, int x, int y, bool dark) {
+    _bit_set(qr->mod, x, y, dark);
+    _bit_set(s_func, x, y, true);
+}
+
+static void _draw_finder(gui_qr_t *qr, int cx, int cy) {
+    for (int dy = -4; dy <= 4; dy++) {
+        for (int dx = -4; dx <= 4; dx++) {
+            int x = cx + dx, y = cy + dy;
+            if (x < 0 || x >= s_size || y < 0 || y >= s_size) continue;
+            int dist = abs(dx) > abs(dy) ? abs(dx) : abs(dy);
+            _set_func(qr, x, y, dist != 2 && dist != 4);
+        }
+    }
+}
+
+static void _draw_alignment(gui_qr_t *qr, int cx, int cy) {
+    for (int dy = -2; dy <= 2; dy++) {
+        for (int dx = -2; dx <= 2; dx++) _set_func(qr, cx + dx, cy + dy, abs(dx) == 2 || abs(dy) == 2 || (dx == 0 && dy == 0));
+    }
+}
+
+/**
+ * @brief 格式信息 (纠错等级 + 掩码，BCH(15,5) 后与 0x5412 异或)，两份
+ */
+static void _draw_format(gui_qr_t *qr, uint8_t mask) {
+    uint16_t data = ECC_FORMAT_BITS[qr->ecc] << 3 | mask;
+    uint16_t rem = data;
+    for (int i = 0; i < 10; i++) rem = (rem << 1) ^ ((rem >> 9) * 0x537);
+    uint16_t bits = ((data << 10) | rem) ^ 0x5412;
+    const uint8_t n = s_size;
+
+    for (int i = 0; i <= 5; i++) _set_func(qr, 8, i, (bits >> i) & 1);
+    _set_func(qr, 8, 7, (bits >> 6) & 1);
+    _set_func(qr, 8, 8, (bits >> 7) & 1);
+    _set_func(qr, 7, 8, (bits >> 8) & 1);
+    for (int i = 9; i < 15; i++) _set_func(qr, 14 - i, 8, (bits >> i) & 1);
+
+    for (int i = 0; i < 8; i++) _set_func(qr, n - 1 - i, 8, (bits >> i) & 1);
+    for (int i = 8; i < 15; i++) _set_func(qr, 8, n - 15 + i, (bits >> i) & 1);
+    _set_func(qr, 8, n - 8, true);  // 固定深色模块
+}
+
+/**
+ * @brief 版本信息 (版本 7 起，BCH(18,6))，两份
+ */
+static void _draw_version(gui_qr_t *qr) {
+    if (qr->version < 7) return;
+    uint32_t rem = qr->version;
+    for (int i = 0; i < 12; i++) rem = (rem << 1) ^ ((rem >> 11) * 0x1F25);
+    uint32_t bits = (uint32_t)qr->version << 12 | rem;
+    for (int i = 0; i < 18; i++) {
+        bool bit = (bits >> i) & 1;
+        int a = s_size - 11 + i % 3, b = i / 3;
+        _set_func(qr, a, b, bit);
+        _set_func(qr, b, a, bit);
+    }
+}
+
+static void _draw_function_patterns(gui_qr_t *qr) {
+    const uint8_t n = s_size;
+    for (int i = 0; i < n; i++) {
+        _set_func(qr, 6, i, i % 2 == 0);
+        _set_func(qr, i, 6, i % 2 == 0);
+    }
+    _draw_finder(qr, 3, 3);
+    _draw_finder(qr, n - 4, 3);
+    _draw_finder(qr, 3, n - 4);
+
+    if (qr->version >= 2) {
+        uint8_t pos[7];
+        uint8_t cnt = qr->version / 7 + 2;
+        uint8_t step = (qr->version * 4 + cnt * 2 + 1) / (cnt * 2 - 2) * 2;
+        pos[0] = 6;
+        for (int i = cnt - 1, p = n - 7; i >= 1; i--, p -= step) pos[i] = p;
+        for (int i = 0; i < cnt; i++) {
+            for (int j = 0; j < cnt; j++) {
+                // 与定位图形重叠的三个位置不画
+                if ((i == 0 && j == 0) || (i == 0 && j == cnt - 1) || (i == cnt - 1 && j == 0)) continue;
+                _draw_alignment(qr, pos[i], pos[j]);
+            }
+        }
+    }
+    _draw_format(qr, 0);  // 先占位，选定掩码后重画
+    _draw_version(qr);
+}
+
+/**
+ * @brief 码字按之字形填入 (每次两列，自右向左，上下交替)
+ */
+static void _draw_codewords(gui_qr_t *qr, const uint8_t *cw, uint16_t len) {
+    uint32_t i = 0, total = (uint32_t)len * 8;
+    for (int right = s_size - 1; right >= 1; right -= 2) {
+        if (right == 6) right = 5;  // 跳过垂直定时图形
+        bool upward = ((right + 1) & 2) == 0;
+        for (int vert = 0; vert < s_size; vert++) {
+            int y = upward ? s_size - 1 - vert : vert;
+            for (int j = 0; j < 2; j++) {
+                int x = right - j;
+                if (_bit_get(s_func, x, y)) continue;
+                // 剩余位 (版本 2~6 有 7 位) 保持浅色
+                bool dark = i < total && ((cw[i >> 3] >> (7 - (i & 7))) & 1);
+                _bit_set(qr->mod, x, y, dark);
+                i++;
+            }
+        }
+    }
+}
+
+static bool _mask_bit(uint8_t mask, int x, int y) {
+    switch (mask) {
+        case 0: return (x + y) % 2 == 0;
+        case 1: return y % 2 == 0;
+        case 2: return x % 3 == 0;
+        case 3: return (x + y) % 3 == 0;
+        case 4: return (x / 3 + y / 2) % 2 == 0;
+        case 5: return x * y % 2 + x * y % 3 == 0;
+        case 6: return (x * y % 2 + x * y % 3) % 2 == 0;
+        default: return ((x + y) % 2 + x * y % 3) % 2 == 0;
+    }
+}
+
+/**
+ * @brief 对非功能模块施加掩码 (异或，再调用一次即撤销)
+ */
+static void _apply_mask(gui_qr_t *qr, uint8_t mask) {
+    for (int y = 0; y < s_size; y++) {
+        for (int x = 0; x < s_size; x++) {
+            if (_mask_bit(mask, x, y) && !_bit_get(s_func, x, y)) {
+                uint16_t i = (uint16_t)y * s_size + x;
+                qr->mod[i >> 3] ^= 0x80 >> (i & 7);
+            }
+        }
+    }
+}
+
+/**
+ * @brief 一行 (或一列) 的 N1 (同色连续) 与 N3 (1:1:3:1:1 且一侧有 4 个浅色) 罚分
+ * @details 符号外按浅色 (静区) 处理。
+ */
+static uint32_t _line_penalty(const bool *line, int n) {
+    uint32_t p = 0;
+    int run = 1;
+    for (int i = 1; i <= n; i++) {
+        if (i < n && line[i] == line[i - 1]) {
+            run++;
+            continue;
+        }
+        if (run >= 5) p += 3 + (run - 5);
+        run = 1;
+    }
+    static const bool core[7] = {1, 0, 1, 1, 1, 0, 1};
+    for (int i = 0; i + 7 <= n; i++) {
+        if (memcmp(line + i, core, sizeof(core)) != 0) continue;
+        bool before = true, after = true;
+        for (int k = 1; k <= 4; k++) {
+            if (i - k >= 0 && line[i - k]) before = false;
+            if (i + 6 + k < n && line[i + 6 + k]) after = false;
+        }
+        if (before || after) p += 40;
+    }
+    return p;
+}
+
+static uint32_t _penalty(const gui_qr_t *qr) {
+    const int n = s_size;
+    bool line[GUI_QR_SIZE_MAX];
+    uint32_t p = 0, dark = 0;
+
+    for (int y = 0; y < n; y++) {
+        for (int x = 0; x < n; x++) {
+            line[x] = _bit_get(qr->mod, x, y);
+            dark += line[x];
+        }
+        p += _line_penalty(line, n);
+    }
+    for (int x = 0; x < n; x++) {
+        for (int y = 0; y < n; y++) line[y] = _bit_get(qr->mod, x, y);
+        p += _line_penalty(line, n);
+    }
+    // N2: 2x2 同色块
+    for (int y = 0; y + 1 < n; y++) {
+        for (int x = 0; x + 1 < n; x++) {
+            bool c = _bit_get(qr->mod, x, y);
+            if (c == _bit_get(qr->mod, x + 1, y) && c == _bit_get(qr->mod, x, y + 1) && c == _bit_get(qr->mod, x + 1, y + 1)) p += 3;
+        }
+    }
+    // N4: 深色比例偏离 50% 每 5% 计 10 分
+    uint32_t total = n * n;
+    uint32_t k = ((uint32_t)abs((int)(dark * 20) - (int)(total * 10)) + total - 1) / total - 1;
+    return p + k * 10;
+}
+
+/* --- 编码 --- */
+
+bool gui_qr_encode(gui_qr_t *qr, const uint8_t *data, uint16_t len, gui_qr_ecc_t ecc) {
+    if (qr == NULL || (data == NULL && len > 0) || ecc > GUI_QR_ECC_H) return false;
+    if (!s_gf_ready) _gf_init();
+
+    // 1. 模式
+    qr_mode_t mode = MODE_NUMERIC;
+    for (uint16_t i = 0; i < len; i++) {
+        if (data[i] >= '0' && data[i] <= '9') continue;
+        if (_alnum_index(data[i]) >= 0) {
+            if (mode == MODE_NUMERIC) mode = MODE_ALNUM;
+        } else {
+            mode = MODE_BYTE;
+            break;
+        }
+    }
+
+    // 2. 最小版本，再在同一版本内提高纠错等级
+    uint8_t ver = 0;
+    uint32_t bits = 0;
+    for (uint8_t v = 1; v <= GUI_QR_VER_MAX; v++) {
+        uint8_t cb = _count_bits(mode, v);
+        bits = 4 + cb + _payload_bits(mode, len);
+        if ((len >> cb) == 0 && bits <= (uint32_t)_data_codewords(v, ecc) * 8) {
+            ver = v;
+            break;
+        }
+    }
+    if (ver == 0) return false;
+#if GUI_QR_BOOST_ECC
+    while (ecc < GUI_QR_ECC_H && bits <= (uint32_t)_data_codewords(ver, ecc + 1) * 8) ecc = (gui_qr_ecc_t)(ecc + 1);
+#endif
+
+    // 3. 比特流
+    uint16_t data_cw = _data_codewords(ver, ecc);
+    memset(s_cw, 0, sizeof(s_cw));
+    s_bit_len = 0;
+    _put_bits(1 << mode, 4);
+    _put_bits(len, _count_bits(mode, ver));
+    _put_payload(mode, data, len);
+    uint16_t cap = data_cw * 8;
+    _put_bits(0, cap - s_bit_len < 4 ? cap - s_bit_len : 4);
+    s_bit_len = (s_bit_len + 7) & ~7;
+    for (uint8_t pad = 0xEC; s_bit_len < cap; pad ^= 0xEC ^ 0x11) _put_bits(pad, 8);
+
+    // 4. 分块计算纠错码字并交织 (前 short_blocks 块的数据码字少 1 个)
+    uint8_t nb = NUM_BLOCKS[ecc][ver], ecc_len = ECC_PER_BLOCK[ecc][ver];
+    uint16_t raw_cw = _raw_modules(ver) / 8;
+    uint8_t short_blocks = nb - raw_cw % nb;
+    uint16_t short_len = raw_cw / nb - ecc_len;  ///< 短块的数据码字数
+    uint8_t div[30];
+    _rs_divisor(div, ecc_len);
+    uint16_t off = 0;
+    for (uint8_t b = 0; b < nb; b++) {
+        uint16_t dlen = short_len + (b >= short_blocks);
+        _rs_remainder(s_cw + off, dlen, div, ecc_len, s_ecc + b * ecc_len);
+        off += dlen;
+    }
+    uint16_t o = 0;
+    for (uint16_t i = 0; i <= short_len; i++) {
+        for (uint8_t b = 0; b < nb; b++) {
+            if (i == short_len && b < short_blocks) continue;
+            s_out[o++] = s_cw[b * short_len + (b > short_blocks ? b - short_blocks : 0) + i];
+        }
+    }
+    for (uint8_t i = 0; i < ecc_len; i++) {
+        for (uint8_t b = 0; b < nb; b++) s_out[o++] = s_ecc[b * ecc_len + i];
+    }
+
+    // 5. 矩阵
+    qr->version = ver;
+    qr->size = s_size = ver * 4 + 17;
+    qr->ecc = ecc;
+    memset(qr->mod, 0, sizeof(qr->mod));
+    memset(s_func, 0, sizeof(s_func));
+    _draw_function_patterns(qr);
+    _draw_codewords(qr, s_out, raw_cw);
+
+    // 6. 掩码
+    uint32_t best_p = UINT32_MAX;
+    uint8_t best = 0;
+    for (uint8_t m = 0; m < 8; m++) {
+        _apply_mask(qr, m);
+        _draw_format(qr, m);
+        uint32_t p = _penalty(qr);
+        if (p < best_p) {
+            best_p = p;
+            best = m;
+        }
+        _apply_mask(qr, m);
+    }
+    qr->mask = best;
+    _apply_mask(qr, best);
+    _draw_format(qr, best);
+    return true;
+}
+
+/* --- 光栅化 --- */
+
+void gui_qr_render(const gui_qr_t *qr, uint8_t *buf, uint16_t stride, uint16_t x, uint16_t y,
+                   uint8_t scale, uint8_t ink) {
+    if (qr == NULL || buf == NULL || scale == 0) return;
+    const uint16_t side = gui_qr_px(qr, scale);
+    const uint16_t q = GUI_QR_QUIET * scale;
+    const uint16_t b0 = x / 8, b1 = (x + side - 1) / 8;
+    const uint8_t m0 = 0xFF >> (x % 8), m1 = 0xFF << (7 - (x + side - 1) % 8);
+
+    for (uint16_t py = 0; py < side; py++) {
+        uint8_t *row = buf + (uint32_t)(y + py) * stride;
+        uint16_t sub = py % scale;
+        if (sub != 0) {
+            // 同一模块行的其余像素行：中间字节整体拷贝，首尾字节按掩码合并
+            const uint8_t *prev = row - stride;
+            if (b0 == b1) {
+                uint8_t m = m0 & m1;
+                row[b0] = (row[b0] & ~m) | (prev[b0] & m);
+            } else {
+                row[b0] = (row[b0] & ~m0) | (prev[b0] & m0);
+                memcpy(row + b0 + 1, prev + b0 + 1, b1 - b0 - 1);
+                row[b1] = (row[b1] & ~m1) | (prev[b1] & m1);
+            }
+            continue;
+        }
+
+        bool quiet_row = py < q || py >= side - q;
+        uint8_t my = quiet_row ? 0 : (py - q) / scale;
+        for (uint16_t px = 0; px < side;) {
+            // 一次写一个模块宽度的像素
+            bool dark = !quiet_row && px >= q && px < side - q && gui_qr_get(qr, (px - q) / scale, my);
+            uint16_t end = px + scale;
+            for (; px < end; px++) {
+                uint16_t bx = x + px;
+                uint8_t m = 0x80 >> (bx & 7);
+                if (dark == (ink != 0)) row[bx >> 3] |= m;
+                else row[bx >> 3] &= ~m;
+            }
+        }
+    }
+}
+
+#ifndef GUI_QR_HOST
+
+// 统计
+static uint32_t s_encodes = 0;
+static uint32_t s_fails = 0;
+static uint32_t s_encode_us = 0;
+
+/**
+ * @brief 经 gui_fb 画到显存
+ * @details 显存中逻辑坐标的一列是一行连续的位，按模块列找出深色模块的连续段，每段一次填充。
+ */
+void gui_qr_draw_fb(const gui_qr_t *qr, lv_coord_t x, lv_coord_t y, uint8_t scale) {
+    if (qr == NULL || scale == 0) return;
+    lv_coord_t side = gui_qr_px(qr, scale);
+    lv_coord_t q = GUI_QR_QUIET * scale;
+    gui_fb_fill(x, y, side, side, GUI_FB_PAPER);
+    for (uint8_t mx = 0; mx < qr->size; mx++) {
+        uint8_t my = 0;
+        while (my < qr->size) {
+            if (!gui_qr_get(qr, mx, my)) {
+                my++;
+                continue;
+            }
+            uint8_t start = my;
+            while (my < qr->size && gui_qr_get(qr, mx, my)) my++;
+            gui_fb_fill(x + q + mx * scale, y + q + start * scale, scale, (my - start) * scale, GUI_FB_INK);
+        }
+    }
+}
+
+/**
+ * @brief 编码并生成图片
+ */
+lv_img_dsc_t *gui_qr_img(const char *text, uint8_t scale, gui_qr_ecc_t ecc) {
+    static gui_qr_t qr;
+    if (text == NULL || scale == 0) return NULL;
+    uint32_t t0 = micros();
+    if (!gui_qr_encode(&qr, (const uint8_t *)text, strlen(text), ecc)) {
+        s_fails++;
+        LOG_E("[QR] Text too long for version %d (%u B)", GUI_QR_VER_MAX, (unsigned)strlen(text));
+        return NULL;
+    }
+    uint16_t side = gui_qr_px(&qr, scale);
+    uint16_t stride = (side + 7) / 8;
+    uint32_t bytes = (uint32_t)stride * side;
+    lv_img_dsc_t *img = (lv_img_dsc_t *)heap_caps_calloc(1, sizeof(lv_img_dsc_t) + bytes, MALLOC_CAP_SPIRAM);
+    if (img == NULL) {
+        s_fails++;
+        return NULL;
+    }
+    img->header.w = side;
+    img->header.h = side;
+    img->header.cf = LV_IMG_CF_ALPHA_1BIT;
+    img->data_size = bytes;
+    img->data = (const uint8_t *)(img + 1);
+    gui_qr_render(&qr, (uint8_t *)(img + 1), stride, 0, 0, scale, 1);
+
+    uint32_t us = micros() - t0;
+    s_encodes++;
+    s_encode_us += us;
+    LOG_D("[QR] v%u-%c mask %u, %ux%u px: %lu us", qr.version, "LMQH"[qr.ecc], qr.mask, side, side, us);
+    return img;
+}
+
+/**
+ * @brief 释放图片
+ */
+void gui_qr_img_free(lv_img_dsc_t *img) {
+    heap_caps_free(img);
+}
+
+/**
+ * @brief 版本 1~10 基准测试
+ */
+void gui_qr_bench(void) {
+    static gui_qr_t qr;
+    static uint8_t payload[GUI_QR_SIZE_MAX * 4];
+    const uint8_t scale = 2;
+    const uint16_t side = (GUI_QR_SIZE_MAX + 2 * GUI_QR_QUIET) * scale;
+    const uint16_t stride = (side + 7) / 8;
+    uint8_t *bits = (uint8_t *)heap_caps_malloc((uint32_t)stride * side, MALLOC_CAP_SPIRAM);
+    if (bits == NULL) return;
+
+    // 字节模式 (含非字母数字字符)，填满 M 级容量
+    for (uint16_t i = 0; i < sizeof(payload); i++) payload[i] = "https://x.y/?k="[i % 15];
+    for (uint8_t v = 1; v <= GUI_QR_VER_MAX; v++) {
+        uint16_t len = gui_qr_capacity(v, GUI_QR_ECC_M);
+        const int rounds = 10;
+        uint32_t t0 = micros();
+        for (int r = 0; r < rounds; r++) gui_qr_encode(&qr, payload, len, GUI_QR_ECC_M);
+        uint32_t t1 = micros();
+        for (int r = 0; r < rounds; r++) gui_qr_render(&qr, bits, stride, 0, 0, scale, 0);
+        uint32_t t2 = micros();
+        LOG_I("[QR] v%u-%c %2ux%-2u %3u B: encode %lu us, render x%u %lu us", qr.version, "LMQH"[qr.ecc],
+              qr.size, qr.size, len, (t1 - t0) / rounds, scale, (t2 - t1) / rounds);
+    }
+    heap_caps_free(bits);
+}
+
+/**
+ * @brief 输出统计
+ */
+void gui_qr_report(void) {
+    LOG_I("[QR] encodes=%lu fails=%lu avg %lu us", s_encodes, s_fails, s_encodes ? s_encode_us / s_encodes : 0);
+}
+
+#endif // GUI_QR_HOST
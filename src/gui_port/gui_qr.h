@@ -0,0 +1,138 @@
+/**
+ * @file gui_qr.h
+ * @brief 二维码编码 (版本 1~10) 并直接光栅化到 1bit 区域
+ * @details 配网、配对链接等动态内容不能用预先生成的图片。本模块在设备上编码：
+ *          - 数字 / 字母数字 / 字节三种模式自动选择 (单段)，自动选最小版本，
+ *            版本不变时把纠错等级升到能容纳的最高级，8 种掩码按罚分选最优；
+ *          - 模块矩阵按位保存在 gui_qr_t 中 (版本 10 为 57x57，约 410 字节)，编码过程只用静态缓冲区；
+ *          - 光栅化时按整数倍放大直接写入目标 1bit 区域 (行主序位图、墨水屏显存或 ALPHA_1BIT 图片)，
+ *            不生成中间图片。
+ *          编码部分不依赖 Arduino / LVGL，定义 GUI_QR_HOST 可在主机上编译：
+ *          tools/qr_bench.py 用它测量各版本的编码与光栅化耗时，并用独立实现的解码器做往返校验。
+ */
+#ifndef GUI_QR_H
+#define GUI_QR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#ifndef GUI_QR_HOST
+#include <lvgl.h>
+#endif
+
+// 支持的最高版本 (每升一级边长 +4 模块)
+#define GUI_QR_VER_MAX   10
+#define GUI_QR_SIZE_MAX  (GUI_QR_VER_MAX * 4 + 17)
+
+// 静区宽度 (模块数，标准为 4)
+#ifndef GUI_QR_QUIET
+#define GUI_QR_QUIET 4
+#endif
+
+// 版本不变的前提下自动提高纠错等级
+#ifndef GUI_QR_BOOST_ECC
+#define GUI_QR_BOOST_ECC 1
+#endif
+
+// 启动时测量版本 1~10 的编码与光栅化耗时
+#ifndef GUI_QR_BENCH
+#define GUI_QR_BENCH 0
+#endif
+
+/**
+ * @brief 纠错等级
+ */
+typedef enum {
+    GUI_QR_ECC_L = 0,      ///< 约 7%
+    GUI_QR_ECC_M,          ///< 约 15%
+    GUI_QR_ECC_Q,          ///< 约 25%
+    GUI_QR_ECC_H,          ///< 约 30%
+} gui_qr_ecc_t;
+
+/**
+ * @brief 编码结果
+ */
+typedef struct {
+    uint8_t version;       ///< 1 ~ GUI_QR_VER_MAX
+    uint8_t size;          ///< 边长 (模块数，不含静区)
+    uint8_t ecc;           ///< 实际使用的纠错等级 (gui_qr_ecc_t)
+    uint8_t mask;          ///< 掩码 0 ~ 7
+    uint8_t mod[(GUI_QR_SIZE_MAX * GUI_QR_SIZE_MAX + 7) / 8];  ///< 模块矩阵 (行主序，MSB 在前，1 = 深色)
+} gui_qr_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 编码
+ * @param qr   输出
+ * @param data 内容 (全为数字或字母数字字符集时自动使用更紧凑的模式)
+ * @param len  字节数
+ * @param ecc  最低纠错等级
+ * @return false 内容超出版本 GUI_QR_VER_MAX 的容量
+ */
+bool gui_qr_encode(gui_qr_t *qr, const uint8_t *data, uint16_t len, gui_qr_ecc_t ecc);
+
+/**
+ * @brief 指定版本与纠错等级下字节模式的最大容量 (字节)
+ */
+uint16_t gui_qr_capacity(uint8_t version, gui_qr_ecc_t ecc);
+
+/**
+ * @brief 读取模块 (x 为列，y 为行)
+ */
+static inline bool gui_qr_get(const gui_qr_t *qr, uint8_t x, uint8_t y) {
+    uint16_t i = (uint16_t)y * qr->size + x;
+    return (qr->mod[i >> 3] >> (7 - (i & 7))) & 1;
+}
+
+/**
+ * @brief 放大 scale 倍后的边长 (像素，含静区)
+ */
+static inline uint16_t gui_qr_px(const gui_qr_t *qr, uint8_t scale) {
+    return (uint16_t)(qr->size + 2 * GUI_QR_QUIET) * scale;
+}
+
+/**
+ * @brief 光栅化到行主序 1bit 位图 (MSB 在前)
+ * @details 写入 (x, y) 起 gui_qr_px 见方的区域 (含静区)，其余位不变。
+ * @param stride 每行字节数
+ * @param ink    深色模块的位值 (LV_IMG_CF_ALPHA_1BIT 为 1，墨水屏显存为 0)
+ */
+void gui_qr_render(const gui_qr_t *qr, uint8_t *buf, uint16_t stride, uint16_t x, uint16_t y,
+                   uint8_t scale, uint8_t ink);
+
+#ifndef GUI_QR_HOST
+/**
+ * @brief 直接画到墨水屏显存 (经 gui_fb，逻辑坐标)
+ * @details 区域计入 gui_fb 的脏区域，由调用方 gui_fb_commit 提交。
+ */
+void gui_qr_draw_fb(const gui_qr_t *qr, lv_coord_t x, lv_coord_t y, uint8_t scale);
+
+/**
+ * @brief 编码并生成 LV_IMG_CF_ALPHA_1BIT 图片 (含静区，可直接用于 lv_img)
+ * @return 图片 (描述符与位图同一块 PSRAM)，失败返回 NULL；用 gui_qr_img_free 释放
+ */
+lv_img_dsc_t *gui_qr_img(const char *text, uint8_t scale, gui_qr_ecc_t ecc);
+
+/**
+ * @brief 释放 gui_qr_img 返回的图片
+ */
+void gui_qr_img_free(lv_img_dsc_t *img);
+
+/**
+ * @brief 基准测试：版本 1~10 (纠错等级 M，填满容量) 的编码与光栅化耗时
+ */
+void gui_qr_bench(void);
+
+/**
+ * @brief 输出统计 (编码次数、失败数、平均耗时)
+ */
+void gui_qr_report(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_QR_H
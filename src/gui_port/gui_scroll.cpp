@@ -0,0 +1,156 @@
+/**
+ * @file gui_scroll.cpp
+ * @brief 墨水屏分页滚动实现
+ * @details
+ * 跳转用 lv_obj_scroll_to_y(LV_ANIM_OFF) 完成：它不检查 LV_OBJ_FLAG_SCROLLABLE，
+ * 所以容器可以保持 "不可拖动" 而仍能被程序滚动，并且会自动限制在内容范围内。
+ * 刷屏统计以手势为单位：下一次手势开始 (或输出统计) 时，
+ * 结算上一次手势以来的刷屏请求数 (gui_port_refresh_count 差值)。
+ */
+#include "gui_scroll.h"
+#include "gui_port.h"
+#include "gui_txn.h"
+#include "common/Log.h"
+
+// 统计
+static uint32_t s_gestures = 0;     ///< 上下滑动手势数
+static uint32_t s_jumps = 0;        ///< 实际发生的跳转 (到顶/到底时手势不跳转)
+static uint32_t s_refreshes = 0;    ///< 已结算的手势期间刷屏次数
+static uint32_t s_refresh_base = 0; ///< 最近一次手势开始时的刷屏计数
+static bool s_open = false;         ///< 最近一次手势尚未结算
+
+/**
+ * @brief 结算最近一次手势的刷屏次数
+ */
+static void _settle(void) {
+    if (!s_open) return;
+    s_refreshes += gui_port_refresh_count() - s_refresh_base;
+    s_open = false;
+}
+
+/**
+ * @brief 计算一次跳转的距离
+ */
+static lv_coord_t _step(lv_obj_t *cont, gui_snap_unit_t unit) {
+    lv_coord_t page = lv_obj_get_content_height(cont);
+    if (unit == GUI_SNAP_ROW) {
+        lv_obj_t *first = lv_obj_get_child(cont, 0);
+        if (first != NULL) {
+            lv_coord_t row = lv_obj_get_height(first) + lv_obj_get_style_pad_row(cont, LV_PART_MAIN);
+            if (row > 0 && row < page) return row;
+        }
+    }
+    return page > 0 ? page : 1;
+}
+
+/**
+ * @brief 手势事件：换算为一次跳转
+ */
+static void _snap_event_cb(lv_event_t *e) {
+    lv_obj_t *cont = lv_event_get_current_target(e);
+    lv_indev_t *indev = lv_indev_get_act();
+    if (indev == NULL) return;
+
+    lv_dir_t dir = lv_indev_get_gesture_dir(indev);
+    if (dir != LV_DIR_TOP && dir != LV_DIR_BOTTOM) return;
+
+    _settle();
+    s_gestures++;
+    s_refresh_base = gui_port_refresh_count();
+    s_open = true;
+
+    // 手指上滑 -> 看下面的内容
+    gui_snap_unit_t unit = (gui_snap_unit_t)(uintptr_t)lv_event_get_user_data(e);
+    lv_coord_t step = _step(cont, unit);
+    lv_coord_t from = lv_obj_get_scroll_y(cont);
+    lv_coord_t to = from + (dir == LV_DIR_TOP ? step : -step);
+
+    {
+        GuiTxn txn("Scroll");
+        lv_obj_scroll_to_y(cont, to, LV_ANIM_OFF);
+        if (lv_obj_get_scroll_y(cont) != from) {
+            s_jumps++;
+            gui_port_request_mode(GUI_SCROLL_FAST_WAVEFORM ? EPD_REFRESH_FAST : EPD_REFRESH_PARTIAL);
+        }
+    }
+
+    // 手势结束后的抬起不再触发子控件 (开关等) 的点击
+    lv_indev_wait_release(indev);
+    LOG_D("[Scroll] %s: y %d -> %d", dir == LV_DIR_TOP ? "down" : "up", from, lv_obj_get_scroll_y(cont));
+}
+
+/**
+ * @brief 把子控件的百分比位置/高度换算为像素 (容器收缩后布局不变)
+ */
+static void _freeze_children(lv_obj_t *cont) {
+    uint32_t cnt = lv_obj_get_child_cnt(cont);
+    for (uint32_t i = 0; i < cnt; i++) {
+        lv_obj_t *child = lv_obj_get_child(cont, i);
+        if (LV_COORD_IS_PCT(lv_obj_get_style_y(child, LV_PART_MAIN))) {
+            lv_obj_set_y(child, lv_obj_get_y_aligned(child));
+        }
+        if (LV_COORD_IS_PCT(lv_obj_get_style_height(child, LV_PART_MAIN))) {
+            lv_obj_set_height(child, lv_obj_get_height(child));
+        }
+    }
+}
+
+/**
+ * @brief 容器超出父控件时收缩到父控件的可视范围
+ */
+static void _fit_viewport(lv_obj_t *cont) {
+    lv_obj_t *parent = lv_obj_get_parent(cont);
+    if (parent == NULL) return;
+
+    lv_obj_update_layout(cont);
+    lv_area_t pa, ca;
+    lv_obj_get_content_coords(parent, &pa);
+    lv_obj_get_coords(cont, &ca);
+    if (ca.y2 <= pa.y2 || ca.y1 >= pa.y2) return;
+
+    _freeze_children(cont);
+    lv_obj_set_height(cont, pa.y2 - ca.y1 + 1);
+    lv_obj_update_layout(cont);
+    LOG_D("[Scroll] Viewport %d px, content %d px", lv_obj_get_height(cont),
+          lv_obj_get_height(cont) + lv_obj_get_scroll_bottom(cont));
+}
+
+/**
+ * @brief 手势从任意子控件冒泡到容器，且子控件不会自行拖动滚动
+ */
+static void _prepare_tree(lv_obj_t *obj) {
+    uint32_t cnt = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < cnt; i++) {
+        lv_obj_t *child = lv_obj_get_child(obj, i);
+        lv_obj_add_flag(child, LV_OBJ_FLAG_GESTURE_BUBBLE);
+        lv_obj_clear_flag(child, LV_OBJ_FLAG_SCROLLABLE);
+        _prepare_tree(child);
+    }
+}
+
+/**
+ * @brief 启用分页滚动
+ */
+void gui_scroll_snap(lv_obj_t *cont, gui_snap_unit_t unit) {
+    if (cont == NULL) return;
+
+    lv_obj_clear_flag(cont, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_clear_flag(cont, LV_OBJ_FLAG_GESTURE_BUBBLE);
+    _prepare_tree(cont);
+    _fit_viewport(cont);
+
+    // 重复调用时不重复注册
+    lv_obj_remove_event_cb(cont, _snap_event_cb);
+    lv_obj_add_event_cb(cont, _snap_event_cb, LV_EVENT_GESTURE, (void *)(uintptr_t)unit);
+}
+
+/**
+ * @brief 输出分页滚动统计
+ */
+void gui_scroll_report(void) {
+    _settle();
+    LOG_I("[Scroll] gestures=%lu jumps=%lu refreshes=%lu (%lu.%02lu per gesture)",
+          s_gestures, s_jumps, s_refreshes,
+          s_gestures ? s_refreshes / s_gestures : 0,
+          s_gestures ? (s_refreshes * 100 / s_gestures) % 100 : 0);
+}
@@ -0,0 +1,53 @@
+/**
+ * @file gui_scroll.h
+ * @brief 墨水屏分页滚动
+ * @details LVGL 的拖动滚动逐像素移动内容，在墨水屏上意味着连续刷屏和拖影。
+ *          分页滚动关闭像素级滚动，把一次上下滑动手势换算成一次 "翻一页 / 一行" 的跳转，
+ *          每次跳转只产生一次对滚动区域的局部刷新。
+ */
+#ifndef GUI_SCROLL_H
+#define GUI_SCROLL_H
+
+#include <lvgl.h>
+#include <stdbool.h>
+
+// 翻页使用快刷 (整屏，对比度更好) 代替局刷 (只刷滚动区域，更快)
+#ifndef GUI_SCROLL_FAST_WAVEFORM
+#define GUI_SCROLL_FAST_WAVEFORM 0
+#endif
+
+/**
+ * @brief 每次跳转的距离
+ */
+typedef enum {
+    GUI_SNAP_PAGE = 0,  ///< 一页 (容器可视高度)
+    GUI_SNAP_ROW,       ///< 一行 (第一个子控件高度 + 行间距)
+} gui_snap_unit_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 为容器启用分页滚动 (可重复调用)
+ * @param cont 滚动容器
+ * @param unit 每次跳转的距离
+ * @details
+ * - SquareLine 中超出父控件的容器 (如高 140% 的 ui_SettingContainer) 会被收缩到父控件可视范围内，
+ *   子控件的百分比位置先换算为像素，保持原有布局。
+ * - 容器及子控件保持不可拖动滚动，上下滑动手势 (LV_EVENT_GESTURE) 冒泡到容器后换算为跳转。
+ * - 每次跳转在一个 UI 事务中完成，并请求局部刷新 (或 GUI_SCROLL_FAST_WAVEFORM 时的快刷)。
+ * @note 只能在 GUI 线程中调用，页面被缓存淘汰重建后需重新调用。
+ */
+void gui_scroll_snap(lv_obj_t *cont, gui_snap_unit_t unit);
+
+/**
+ * @brief 输出分页滚动统计 (手势数、跳转数、平均每次手势的刷屏次数)
+ */
+void gui_scroll_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_SCROLL_H
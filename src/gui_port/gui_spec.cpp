@@ -0,0 +1,178 @@
+/**
+ * @file gui_spec.cpp
+ * @brief 导航按钮推测式预渲染实现
+ * @details
+ * 流程：
+ * 1. PRESSED: 经页面缓存取得目标页面 (不存在则构建)，并用 lv_snapshot 离屏渲染成 16bit 图像，
+ *    再转换为 1bit 整帧 (与 disp_flush 同一映射；三色屏上同时写出红色平面)。
+ * 2. CLICKED: 整帧直接交给 gui_port_present，刷屏线程立刻开始上墨；
+ *    随后 LVGL 切页渲染出相同内容，gui_port 会识别为 "帧未变化" 而跳过重复刷新。
+ * 3. PRESS_LOST: 丢弃预渲染帧；提前构建的页面留在页面缓存中，由内存预算决定去留。
+ */
+#include "gui_spec.h"
+#include "gui_port.h"
+#include "gui_bwr.h"
+#include "bsp/bsp_epd.h"
+#include "common/Log.h"
+#include "common/types.h"
+#include "system/PageBridge.h"
+#include <Arduino.h>
+
+#define SPEC_FRAME_SIZE (EPD_WIDTH * EPD_HEIGHT / 8)
+#define SPEC_SNAP_SIZE  (EPD_WIDTH * EPD_HEIGHT * sizeof(lv_color_t))
+
+/**
+ * @brief 预渲染状态
+ */
+typedef enum {
+    SPEC_IDLE = 0,  ///< 无预渲染
+    SPEC_READY,     ///< 帧已就绪，等待点击
+} spec_state_t;
+
+static spec_state_t s_state = SPEC_IDLE;
+static lv_obj_t **s_target = NULL;     ///< 预渲染的目标页面
+
+// PSRAM 缓冲区 (首次使用时分配)
+static lv_color_t *s_snap_buf = NULL;  ///< 16bit 离屏渲染结果 (约 90KB)
+static uint8_t *s_frame = NULL;        ///< 1bit 整帧 (约 6KB)
+static uint8_t *s_red = NULL;          ///< 红色平面 (仅三色屏分配)
+
+// 统计
+static uint32_t s_hits = 0;
+static uint32_t s_misses = 0;
+static uint32_t s_cancels = 0;
+
+/**
+ * @brief 分配预渲染缓冲区
+ * @return true 分配成功
+ */
+static bool _spec_alloc(void) {
+    if (s_snap_buf == NULL) {
+        s_snap_buf = (lv_color_t *)heap_caps_malloc(SPEC_SNAP_SIZE, MALLOC_CAP_SPIRAM);
+    }
+    if (s_frame == NULL) {
+        s_frame = (uint8_t *)heap_caps_malloc(SPEC_FRAME_SIZE, MALLOC_CAP_SPIRAM);
+    }
+#if EPD_BWR
+    if (s_red == NULL) {
+        s_red = (uint8_t *)heap_caps_malloc(SPEC_FRAME_SIZE, MALLOC_CAP_SPIRAM);
+    }
+#endif
+    if (s_snap_buf == NULL || s_frame == NULL || (EPD_BWR && s_red == NULL)) {
+        LOG_E("[Spec] PSRAM alloc failed");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief 将目标页面离屏渲染为 1bit 整帧
+ * @return true 渲染成功
+ */
+static bool _spec_render(lv_obj_t *scr) {
+#if LV_USE_SNAPSHOT
+    if (!_spec_alloc()) return false;
+
+    lv_img_dsc_t dsc;
+    if (lv_snapshot_take_to_buf(scr, LV_IMG_CF_TRUE_COLOR, &dsc, s_snap_buf, SPEC_SNAP_SIZE) != LV_RES_OK) {
+        LOG_E("[Spec] Snapshot failed");
+        return false;
+    }
+
+    // 页面必须恰好覆盖整屏，否则拼不出完整的一帧
+    lv_area_t area;
+    lv_obj_get_coords(scr, &area);
+    if ((lv_coord_t)dsc.header.w != lv_area_get_width(&area) || (lv_coord_t)dsc.header.h != lv_area_get_height(&area)) {
+        return false;
+    }
+
+    memset(s_frame, 0xFF, SPEC_FRAME_SIZE);
+#if EPD_BWR
+    // 与 disp_flush 相同，两个平面一起写出，否则命中时提交的帧没有红色
+    memset(s_red, 0, SPEC_FRAME_SIZE);
+    gui_bwr_convert_area(s_frame, s_red, &area, (const lv_color_t *)dsc.data);
+#else
+    gui_port_convert_area(s_frame, &area, (const lv_color_t *)dsc.data);
+#endif
+    return true;
+#else
+    // 未启用 LV_USE_SNAPSHOT 时只做 "预构建"，依然能省下 screen_init 的时间
+    UNUSED(scr);
+    return false;
+#endif
+}
+
+/**
+ * @brief 开始预渲染
+ */
+void gui_spec_begin(lv_obj_t **target, void (*target_init)(void)) {
+#if GUI_SPEC_ENABLE
+    if (target == NULL) return;
+
+    // 上一次未完成的预渲染 (理论上不会出现) 先丢弃
+    if (s_state != SPEC_IDLE && s_target != target) gui_spec_cancel();
+
+    uint32_t t0 = millis();
+
+    page_acquire_screen(target, target_init);
+    if (*target == NULL) return;
+
+    s_target = target;
+    s_state = _spec_render(*target) ? SPEC_READY : SPEC_IDLE;
+
+    LOG_D("[Spec] Pre-render %s in %lu ms", s_state == SPEC_READY ? "ready" : "skipped", millis() - t0);
+#else
+    UNUSED(target);
+    UNUSED(target_init);
+#endif
+}
+
+/**
+ * @brief 提交预渲染帧
+ */
+bool gui_spec_commit(lv_obj_t **target) {
+    bool hit = (s_state == SPEC_READY && s_target == target && target != NULL && *target != NULL);
+
+    if (hit) {
+        gui_port_latency_probe("Click (spec hit)");
+        gui_port_present(s_frame, s_red);
+        s_hits++;
+    } else {
+        gui_port_latency_probe(GUI_SPEC_ENABLE ? "Click (spec miss)" : "Click (no spec)");
+        s_misses++;
+    }
+
+    s_state = SPEC_IDLE;
+    s_target = NULL;
+
+    LOG_D("[Spec] hits=%lu misses=%lu cancels=%lu", s_hits, s_misses, s_cancels);
+    return hit;
+}
+
+/**
+ * @brief 丢弃预渲染结果
+ */
+void gui_spec_cancel(void) {
+    if (s_target != NULL) s_cancels++;
+    s_state = SPEC_IDLE;
+    s_target = NULL;
+}
+
+/**
+ * @brief 导航按钮事件分发
+ */
+void gui_spec_handle(lv_event_t *e, lv_obj_t **target, void (*target_init)(void)) {
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_PRESSED:
+            gui_spec_begin(target, target_init);
+            break;
+        case LV_EVENT_PRESS_LOST:
+            gui_spec_cancel();
+            break;
+        case LV_EVENT_CLICKED:
+            gui_spec_commit(target);
+            break;
+        default:
+            break;
+    }
+}
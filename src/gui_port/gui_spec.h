@@ -0,0 +1,55 @@
+/**
+ * @file gui_spec.h
+ * @brief 导航按钮的推测式预渲染
+ * @details 手指按在导航按钮上到抬起通常有 100~200 ms。
+ *          在 LV_EVENT_PRESSED 时就提前构建并离屏渲染目标页面，
+ *          LV_EVENT_CLICKED 时直接把准备好的帧送去刷屏，
+ *          LV_EVENT_PRESS_LOST (滑走/取消) 时丢弃。
+ */
+#ifndef GUI_SPEC_H
+#define GUI_SPEC_H
+
+#include <lvgl.h>
+#include <stdbool.h>
+
+// 预渲染总开关 (0: 关闭，仅用于对比测量 "无预渲染" 的点击到上墨延迟)
+#ifndef GUI_SPEC_ENABLE
+#define GUI_SPEC_ENABLE 1
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 开始预渲染目标页面 (按下时调用)
+ * @param target      目标页面的全局指针地址 (如 &ui_CalendarPage)
+ * @param target_init 页面为空时用于创建的 screen_init 函数 (经页面缓存调用)
+ */
+void gui_spec_begin(lv_obj_t **target, void (*target_init)(void));
+
+/**
+ * @brief 提交预渲染帧 (点击时调用，须在切换页面之前)
+ * @param target 目标页面的全局指针地址
+ * @return true 命中，预渲染帧已送去刷屏；false 未命中
+ */
+bool gui_spec_commit(lv_obj_t **target);
+
+/**
+ * @brief 丢弃预渲染结果 (按压取消时调用)
+ * @details 提前构建的页面保留在页面缓存中，由内存预算决定是否淘汰。
+ */
+void gui_spec_cancel(void);
+
+/**
+ * @brief 导航按钮事件的一站式处理
+ * @details 供 SquareLine 生成的 ui_event_btn* 回调在处理 CLICKED 之前调用：
+ *          PRESSED -> begin, PRESS_LOST -> cancel, CLICKED -> commit。
+ */
+void gui_spec_handle(lv_event_t *e, lv_obj_t **target, void (*target_init)(void));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_SPEC_H
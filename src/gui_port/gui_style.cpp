@@ -0,0 +1,279 @@
+/**
+ * @file gui_style.cpp
+ * @brief 共享样式池实现
+ * @details
+ * LVGL 8 中每个控件的样式存放在 obj->styles[] 中，is_local 标记的样式由 lv_mem 单独分配
+ * (lv_style_t + 属性数组)，控件删除时一起释放。共享样式只保存指针，不会被释放。
+ * 本模块把本地样式中可共享的部分换成 s_pool 中的静态样式：
+ * - 样式池中的 lv_style_t 位于 .bss，属性数组在首次加入时由 lv_mem 分配一次，此后所有页面复用，
+ *   页面被 ScreenCache 淘汰后重建也直接命中。
+ * - 之后 App 再对控件调用 lv_obj_set_style_* 时，LVGL 会新建本地样式，不会改动共享样式。
+ */
+#include "gui_style.h"
+#include "common/Log.h"
+#include <Arduino.h>
+#include <string.h>
+
+#ifdef LV_STYLE_PROP_ID_MASK
+#define _PROP_ID(p) LV_STYLE_PROP_ID_MASK(p)
+#else
+#define _PROP_ID(p) (p)
+#endif
+
+// 单个样式最多处理的属性个数 (SquareLine 单个 selector 一般不超过 20 个)
+#define STYLE_PROPS_MAX 32
+
+/**
+ * @brief 样式属性 (展开后的 prop/value 对)
+ */
+typedef struct {
+    lv_style_prop_t prop;
+    lv_style_value_t value;
+} style_prop_t;
+
+/**
+ * @brief 单个页面的去重统计
+ */
+typedef struct {
+    uint16_t objs;      ///< 控件数
+    uint16_t locals;    ///< 本地样式数
+    uint16_t swapped;   ///< 整体替换为共享样式
+    uint16_t split;     ///< 拆分出共享样式 (坐标留在本地)
+} style_stats_t;
+
+static lv_style_t s_pool[GUI_STYLE_POOL_MAX];
+static uint8_t s_pool_cnt = 0;
+
+/**
+ * @brief 是否为控件专属属性 (坐标/尺寸，几乎不可能与其他控件相同)
+ */
+static bool _is_geometry(lv_style_prop_t prop) {
+    switch (_PROP_ID(prop)) {
+        case LV_STYLE_X:
+        case LV_STYLE_Y:
+        case LV_STYLE_WIDTH:
+        case LV_STYLE_MIN_WIDTH:
+        case LV_STYLE_MAX_WIDTH:
+        case LV_STYLE_HEIGHT:
+        case LV_STYLE_MIN_HEIGHT:
+        case LV_STYLE_MAX_HEIGHT:
+        case LV_STYLE_ALIGN:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief 比较两个属性值
+ * @details lv_style_value_t 是联合体，颜色只占低 16 位，其余字节未定义，需按属性类型比较。
+ */
+static bool _value_eq(lv_style_prop_t prop, lv_style_value_t a, lv_style_value_t b) {
+    switch (_PROP_ID(prop)) {
+        case LV_STYLE_BG_COLOR:
+        case LV_STYLE_BG_GRAD_COLOR:
+        case LV_STYLE_BG_IMG_RECOLOR:
+        case LV_STYLE_BORDER_COLOR:
+        case LV_STYLE_OUTLINE_COLOR:
+        case LV_STYLE_SHADOW_COLOR:
+        case LV_STYLE_IMG_RECOLOR:
+        case LV_STYLE_LINE_COLOR:
+        case LV_STYLE_ARC_COLOR:
+        case LV_STYLE_TEXT_COLOR:
+            return a.color.full == b.color.full;
+        case LV_STYLE_TEXT_FONT:
+        case LV_STYLE_BG_IMG_SRC:
+        case LV_STYLE_ARC_IMG_SRC:
+        case LV_STYLE_BG_GRAD:
+        case LV_STYLE_TRANSITION:
+        case LV_STYLE_COLOR_FILTER_DSC:
+        case LV_STYLE_ANIM:
+            return a.ptr == b.ptr;
+        default:
+            return a.num == b.num;
+    }
+}
+
+/**
+ * @brief 展开样式中的全部属性
+ * @return 属性个数 (常量样式返回 0)
+ */
+static uint8_t _style_unpack(const lv_style_t *style, style_prop_t *out) {
+    if (style->prop1 == LV_STYLE_PROP_ANY) return 0; // 常量样式
+    if (style->prop_cnt == 0 || style->prop_cnt > STYLE_PROPS_MAX) return 0;
+
+    if (style->prop_cnt == 1) {
+        out[0].prop = style->prop1;
+        out[0].value = style->v_p.value1;
+        return 1;
+    }
+
+    // 属性数组布局: [value0..valueN-1][prop0..propN-1]
+    const lv_style_value_t *values = (const lv_style_value_t *)style->v_p.values_and_props;
+    const uint16_t *props = (const uint16_t *)(style->v_p.values_and_props + style->prop_cnt * sizeof(lv_style_value_t));
+    for (uint8_t i = 0; i < style->prop_cnt; i++) {
+        out[i].prop = props[i];
+        out[i].value = values[i];
+    }
+    return style->prop_cnt;
+}
+
+/**
+ * @brief 在样式池中查找内容相同的样式，没有则加入
+ * @return 共享样式，池满时返回 NULL
+ */
+static lv_style_t *_pool_get(const style_prop_t *props, uint8_t cnt) {
+    for (uint8_t i = 0; i < s_pool_cnt; i++) {
+        lv_style_t *s = &s_pool[i];
+        if (s->prop_cnt != cnt) continue;
+
+        bool same = true;
+        for (uint8_t j = 0; j < cnt && same; j++) {
+            lv_style_value_t v;
+            same = lv_style_get_prop(s, props[j].prop, &v) == LV_STYLE_RES_FOUND &&
+                   _value_eq(props[j].prop, v, props[j].value);
+        }
+        if (same) return s;
+    }
+
+    if (s_pool_cnt >= GUI_STYLE_POOL_MAX) return NULL;
+
+    lv_style_t *s = &s_pool[s_pool_cnt++];
+    lv_style_init(s);
+    for (uint8_t j = 0; j < cnt; j++) lv_style_set_prop(s, props[j].prop, props[j].value);
+    return s;
+}
+
+/**
+ * @brief 在本地样式之后插入共享样式
+ * @details 与 lv_obj_add_style 的插入位置相同 (过渡样式、本地样式之后，其余共享样式之前)，
+ *          但解析结果不变，所以省去 lv_obj_refresh_style 带来的重绘与重新布局。
+ */
+static bool _insert_shared(lv_obj_t *obj, lv_style_t *style, lv_style_selector_t selector) {
+    if (obj->style_cnt >= 63) return false; // style_cnt 为 6 bit 位域
+
+    lv_obj_style_t *styles = (lv_obj_style_t *)lv_mem_realloc(obj->styles, (obj->style_cnt + 1) * sizeof(lv_obj_style_t));
+    if (styles == NULL) return false;
+    obj->styles = styles;
+
+    uint32_t pos = 0;
+    while (pos < obj->style_cnt && (styles[pos].is_trans || styles[pos].is_local)) pos++;
+
+    memmove(&styles[pos + 1], &styles[pos], (obj->style_cnt - pos) * sizeof(lv_obj_style_t));
+    obj->style_cnt++;
+
+    memset(&styles[pos], 0, sizeof(lv_obj_style_t));
+    styles[pos].style = style;
+    styles[pos].selector = selector;
+    return true;
+}
+
+/**
+ * @brief 对单个控件去重
+ */
+static void _dedup_obj(lv_obj_t *obj, style_stats_t *st) {
+    style_prop_t all[STYLE_PROPS_MAX];
+    style_prop_t shared[STYLE_PROPS_MAX];
+
+    st->objs++;
+
+    for (uint32_t i = 0; i < obj->style_cnt; i++) {
+        if (!obj->styles[i].is_local) continue;
+        st->locals++;
+
+        lv_style_t *local = obj->styles[i].style;
+        uint8_t cnt = _style_unpack(local, all);
+        uint8_t n = 0;
+        for (uint8_t j = 0; j < cnt; j++) {
+            if (!_is_geometry(all[j].prop)) shared[n++] = all[j];
+        }
+        if (n == 0) continue;
+
+        if (n == cnt) {
+            // 全部可共享：直接替换指针，释放本地样式
+            lv_style_t *pooled = _pool_get(shared, n);
+            if (pooled == NULL) continue;
+
+            obj->styles[i].style = pooled;
+            obj->styles[i].is_local = 0;
+            lv_style_reset(local);
+            lv_mem_free(local);
+            st->swapped++;
+        } else if (n >= 2) {
+            // 混合：多挂一个样式条目 (8 B)，只有拆出至少 2 个属性时才划算
+            lv_style_t *pooled = _pool_get(shared, n);
+            if (pooled == NULL) continue;
+
+            lv_style_selector_t selector = obj->styles[i].selector;
+            if (!_insert_shared(obj, pooled, selector)) continue;
+            for (uint8_t j = 0; j < n; j++) lv_style_remove_prop(local, shared[j].prop);
+            st->split++;
+        }
+    }
+
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < child_cnt; i++) {
+        _dedup_obj(lv_obj_get_child(obj, i), st);
+    }
+}
+
+/**
+ * @brief 样式查找耗时测量：对每个控件解析一组常用属性
+ * @return 耗时 (us)
+ */
+static uint32_t _resolve_sweep(lv_obj_t *obj) {
+    static const lv_style_prop_t props[] = {
+        LV_STYLE_BG_COLOR, LV_STYLE_BG_OPA, LV_STYLE_TEXT_COLOR, LV_STYLE_TEXT_FONT,
+        LV_STYLE_BORDER_WIDTH, LV_STYLE_PAD_TOP, LV_STYLE_RADIUS, LV_STYLE_WIDTH,
+    };
+    static volatile int32_t sink;
+
+    uint32_t t0 = micros();
+    for (uint32_t i = 0; i < sizeof(props) / sizeof(props[0]); i++) {
+        sink = lv_obj_get_style_prop(obj, LV_PART_MAIN, props[i]).num;
+    }
+    uint32_t cost = micros() - t0;
+
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < child_cnt; i++) {
+        cost += _resolve_sweep(lv_obj_get_child(obj, i));
+    }
+    return cost;
+}
+
+/**
+ * @brief 对页面执行样式去重
+ */
+void gui_style_dedup(lv_obj_t *scr, const char *tag) {
+#if GUI_STYLE_POOL_ENABLE
+    if (scr == NULL) return;
+
+    uint32_t before_us = _resolve_sweep(scr);
+#if LV_MEM_CUSTOM == 0
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    uint32_t free_before = mon.free_size;
+#endif
+
+    style_stats_t st = {};
+    uint32_t t0 = micros();
+    _dedup_obj(scr, &st);
+    uint32_t cost = micros() - t0;
+
+    uint32_t after_us = _resolve_sweep(scr);
+
+#if LV_MEM_CUSTOM == 0
+    lv_mem_monitor(&mon);
+    LOG_I("[Style] %s: %u obj, %u local -> %u shared + %u split, pool %u/%u, lv_mem free %+ld B, %lu us",
+          tag ? tag : "screen", st.objs, st.locals, st.swapped, st.split, s_pool_cnt, GUI_STYLE_POOL_MAX,
+          (long)mon.free_size - (long)free_before, cost);
+#else
+    LOG_I("[Style] %s: %u obj, %u local -> %u shared + %u split, pool %u/%u, %lu us",
+          tag ? tag : "screen", st.objs, st.locals, st.swapped, st.split, s_pool_cnt, GUI_STYLE_POOL_MAX, cost);
+#endif
+    LOG_D("[Style] %s: style lookup %lu us -> %lu us", tag ? tag : "screen", before_us, after_us);
+#else
+    LV_UNUSED(scr);
+    LV_UNUSED(tag);
+#endif
+}
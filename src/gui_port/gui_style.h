@@ -0,0 +1,44 @@
+/**
+ * @file gui_style.h
+ * @brief 共享样式池
+ * @details SquareLine 生成的页面对每个控件逐一调用 lv_obj_set_style_*，
+ *          相同的白底、黑字、不透明度等属性在每个控件上都各自分配一份本地样式。
+ *          本模块在页面构建后遍历控件树，把内容相同的本地样式替换为静态样式池中的同一份样式。
+ */
+#ifndef GUI_STYLE_H
+#define GUI_STYLE_H
+
+#include <lvgl.h>
+
+// 样式池开关 (0: 关闭，仅用于对比内存与查找耗时)
+#ifndef GUI_STYLE_POOL_ENABLE
+#define GUI_STYLE_POOL_ENABLE 1
+#endif
+
+// 样式池容量 (不同内容的共享样式个数)
+#ifndef GUI_STYLE_POOL_MAX
+#define GUI_STYLE_POOL_MAX 64
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 对页面执行样式去重
+ * @param scr 刚由 screen_init 构建完成的页面
+ * @param tag 日志标签 (页面名称，可为 NULL)
+ * @details
+ * - 本地样式只含可共享属性时：直接替换为样式池中的样式，释放本地样式。
+ * - 同时含有坐标/尺寸 (x, y, width, height, align) 时：坐标留在本地样式，
+ *   其余属性拆出为共享样式，以相同 selector 紧跟在本地样式之后挂载，优先级不变。
+ * - 解析结果与去重前完全一致，因此不触发重绘与重新布局。
+ * 完成后输出节省的 LVGL 内存与样式查找耗时 (去重前 / 后)。
+ */
+void gui_style_dedup(lv_obj_t *scr, const char *tag);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_STYLE_H
@@ -0,0 +1,116 @@
+/**
+ * @file gui_txn.cpp
+ * @brief UI 更新事务实现
+ * @details
+ * - LVGL 侧：暂停显示器的刷新定时器 (_lv_disp_get_refr_timer)，脏区域照常累积，提交时合并渲染。
+ * - 墨水屏侧：gui_port_hold_refresh 扣住刷屏请求 (如预渲染帧)，提交时放行，多次请求合并为一次。
+ * - 统计：提交后 GUI_TXN_SETTLE_MS 内发生的渲染与刷屏次数，即 "一次数据事件刷了几次屏"。
+ */
+#include "gui_txn.h"
+#include "gui_port.h"
+#include "common/Log.h"
+#include <lvgl.h>
+#include <Arduino.h>
+
+static uint8_t s_depth = 0;                 ///< 嵌套深度
+static const char *s_tag = NULL;            ///< 最外层事务名称
+static uint32_t s_begin_ms = 0;
+static lv_timer_t *s_timeout_timer = NULL;  ///< 超时强制提交
+
+// 刷屏次数统计 (以提交前的计数为基准)
+static lv_timer_t *s_settle_timer = NULL;
+static const char *s_settle_tag = NULL;
+static uint32_t s_settle_refreshes = 0;
+static uint32_t s_settle_renders = 0;
+
+static void _commit_outer(void);
+
+/**
+ * @brief 输出上一次事务的刷屏统计
+ */
+static void _settle_report(void) {
+    if (s_settle_tag == NULL) return;
+    LOG_I("[Txn] %s: %lu EPD refresh(es), %lu render(s)", s_settle_tag,
+          gui_port_refresh_count() - s_settle_refreshes, gui_port_render_count() - s_settle_renders);
+    s_settle_tag = NULL;
+}
+
+static void _settle_timer_cb(lv_timer_t *timer) {
+    _settle_report();
+    lv_timer_pause(timer);
+}
+
+static void _timeout_timer_cb(lv_timer_t *timer) {
+    LV_UNUSED(timer);
+    if (s_depth == 0) return;
+    LOG_E("[Txn] %s not committed after %d ms, forcing commit", s_tag ? s_tag : "txn", GUI_TXN_TIMEOUT_MS);
+    s_depth = 0;
+    _commit_outer();
+}
+
+/**
+ * @brief 开始事务
+ */
+void gui_txn_begin(const char *tag) {
+    if (s_depth++ > 0) return;
+
+    // 新事务开始前先结算上一次的统计，避免两次事务的刷屏混在一起
+    _settle_report();
+
+    s_tag = tag;
+    s_begin_ms = millis();
+    s_settle_refreshes = gui_port_refresh_count();
+    s_settle_renders = gui_port_render_count();
+
+    lv_timer_t *refr = _lv_disp_get_refr_timer(NULL);
+    if (refr) lv_timer_pause(refr);
+    gui_port_hold_refresh(true);
+
+    if (s_timeout_timer == NULL) {
+        s_timeout_timer = lv_timer_create(_timeout_timer_cb, GUI_TXN_TIMEOUT_MS, NULL);
+    }
+    lv_timer_reset(s_timeout_timer);
+    lv_timer_resume(s_timeout_timer);
+}
+
+/**
+ * @brief 最外层提交：恢复渲染与刷屏
+ */
+static void _commit_outer(void) {
+    lv_timer_pause(s_timeout_timer);
+
+    lv_timer_t *refr = _lv_disp_get_refr_timer(NULL);
+    if (refr) {
+        lv_timer_resume(refr);
+        lv_timer_ready(refr); // 下一次 lv_timer_handler 立即渲染
+    }
+    gui_port_hold_refresh(false);
+
+    LOG_D("[Txn] %s committed after %lu ms", s_tag ? s_tag : "txn", millis() - s_begin_ms);
+
+    // 观察窗口结束后输出本次事务引起的刷屏次数
+    s_settle_tag = s_tag ? s_tag : "txn";
+    if (s_settle_timer == NULL) {
+        s_settle_timer = lv_timer_create(_settle_timer_cb, GUI_TXN_SETTLE_MS, NULL);
+    }
+    lv_timer_reset(s_settle_timer);
+    lv_timer_resume(s_settle_timer);
+
+    s_tag = NULL;
+}
+
+/**
+ * @brief 提交事务
+ */
+void gui_txn_commit(void) {
+    if (s_depth == 0) return; // 已被超时强制提交
+    if (--s_depth > 0) return;
+    _commit_outer();
+}
+
+/**
+ * @brief 当前是否处于事务中
+ */
+bool gui_txn_active(void) {
+    return s_depth > 0;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file gui_txn.h
+ * @brief UI 更新事务
+ * @details 一次逻辑上的数据更新 (如天气到达) 往往要改多个标签和图表。
+ *          LVGL 刷新定时器可能在两次修改之间触发，导致一次更新刷两三次屏。
+ *          事务期间暂停 LVGL 刷新定时器并扣住墨水屏刷新请求，提交时一次性渲染、一次刷屏。
+ */
+#ifndef GUI_TXN_H
+#define GUI_TXN_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// 事务超时 (ms)：忘记提交时由定时器强制提交，避免界面冻结
+#ifndef GUI_TXN_TIMEOUT_MS
+#define GUI_TXN_TIMEOUT_MS 500
+#endif
+
+// 提交后统计刷屏次数的观察窗口 (ms)
+#ifndef GUI_TXN_SETTLE_MS
+#define GUI_TXN_SETTLE_MS 1000
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 开始事务 (可嵌套，只在最外层生效)
+ * @param tag 事务名称 (常量字符串，用于日志)
+ * @note 只能在 GUI 线程中调用
+ */
+void gui_txn_begin(const char *tag);
+
+/**
+ * @brief 提交事务
+ * @details 最外层提交时恢复 LVGL 刷新定时器并立即触发一次渲染，放行扣住的刷屏请求。
+ */
+void gui_txn_commit(void);
+
+/**
+ * @brief 当前是否处于事务中
+ */
+bool gui_txn_active(void);
+
+#ifdef __cplusplus
+}
+
+/**
+ * @class GuiTxn
+ * @brief 作用域事务 (构造时 begin，析构时 commit)
+ * @details 用法: `{ GuiTxn txn("Weather"); lv_label_set_text(...); lv_chart_set_next_value(...); }`
+ */
+class GuiTxn {
+public:
+    explicit GuiTxn(const char *tag) { gui_txn_begin(tag); }
+    ~GuiTxn() { gui_txn_commit(); }
+    GuiTxn(const GuiTxn &) = delete;
+    GuiTxn &operator=(const GuiTxn &) = delete;
+};
+#endif
+
+#endif // GUI_TXN_H
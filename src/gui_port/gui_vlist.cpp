@@ -0,0 +1,317 @@
+/**
+ * @file gui_vlist.cpp
+ * @brief 虚拟列表实现
+ * @details
+ * - 行池：rows[] 为环形数组，rows[head] 显示在第 0 行。池大小 = ceil(可视高度 / 行高) + GUI_VLIST_MARGIN，
+ *   只在列表变高时增加，不随条目数变化。
+ * - 跳转：偏移小于池大小时旋转环形数组，只重新绑定新露出的行；否则全部重新绑定。
+ * - 列表本身不可拖动滚动 (没有 LVGL 滚动偏移)，行的 y 坐标直接按槽位设置，超出部分由列表裁剪。
+ * - 状态结构体放在 lv_mem 中，挂在列表对象的 user_data 上，LV_EVENT_DELETE 时释放。
+ */
+#include "gui_vlist.h"
+#include "gui_port.h"
+#include "gui_txn.h"
+#include "common/Log.h"
+#include <Arduino.h>
+#include <algorithm>
+
+/**
+ * @brief 列表状态
+ */
+typedef struct {
+    gui_vlist_create_cb_t create_cb;
+    gui_vlist_bind_cb_t bind_cb;
+    void *user_data;
+    lv_coord_t row_h;
+    gui_snap_unit_t unit;   ///< 手势跳转距离
+    uint32_t count;         ///< 条目数
+    uint32_t top;           ///< 第 0 行显示的条目
+    uint16_t pool_cnt;      ///< 已创建的行数
+    uint16_t head;          ///< 第 0 行在 rows[] 中的位置
+    lv_obj_t **rows;
+} vlist_t;
+
+// 统计
+static uint32_t s_rows_created = 0;
+static uint32_t s_binds = 0;
+static uint32_t s_jumps = 0;
+
+#if GUI_VLIST_BENCH
+#define BENCH_ROW_H 24
+static const uint32_t s_bench_counts[] = {10, 1000, 100000};
+#endif
+
+static inline vlist_t *_get(const lv_obj_t *list) {
+    return list ? (vlist_t *)lv_obj_get_user_data((lv_obj_t *)list) : NULL;
+}
+
+/**
+ * @brief 完整可见的行数 (至少 1)
+ */
+static uint32_t _visible_rows(lv_obj_t *list, const vlist_t *vl) {
+    lv_coord_t h = lv_obj_get_content_height(list);
+    uint32_t n = h > 0 ? (uint32_t)(h / vl->row_h) : 0;
+    return n > 0 ? n : 1;
+}
+
+/**
+ * @brief 第 0 行允许的最大条目序号
+ */
+static uint32_t _max_top(lv_obj_t *list, const vlist_t *vl) {
+    uint32_t vis = _visible_rows(list, vl);
+    return vl->count > vis ? vl->count - vis : 0;
+}
+
+/**
+ * @brief 手势从行内任意控件冒泡到列表
+ */
+static void _bubble_tree(lv_obj_t *obj) {
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_GESTURE_BUBBLE);
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+    uint32_t cnt = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < cnt; i++) _bubble_tree(lv_obj_get_child(obj, i));
+}
+
+/**
+ * @brief 槽位 slot 上的行重新绑定数据 (超出条目数的行隐藏)
+ */
+static void _bind_slot(vlist_t *vl, uint16_t slot) {
+    lv_obj_t *row = vl->rows[(vl->head + slot) % vl->pool_cnt];
+    uint32_t index = vl->top + slot;
+    if (index >= vl->count) {
+        lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+        return;
+    }
+    lv_obj_clear_flag(row, LV_OBJ_FLAG_HIDDEN);
+    vl->bind_cb(row, index, vl->user_data);
+    s_binds++;
+}
+
+/**
+ * @brief 按槽位设置每一行的位置
+ */
+static void _layout(vlist_t *vl) {
+    for (uint16_t slot = 0; slot < vl->pool_cnt; slot++) {
+        lv_obj_set_y(vl->rows[(vl->head + slot) % vl->pool_cnt], slot * vl->row_h);
+    }
+}
+
+/**
+ * @brief 按列表当前高度补足行池
+ * @return true 新建了行
+ */
+static bool _ensure_pool(lv_obj_t *list, vlist_t *vl) {
+    lv_obj_update_layout(list);
+    lv_coord_t h = lv_obj_get_content_height(list);
+    uint32_t need = (h > 0 ? (h + vl->row_h - 1) / vl->row_h : 1) + GUI_VLIST_MARGIN;
+    if (need <= vl->pool_cnt) return false;
+
+    lv_obj_t **rows = (lv_obj_t **)lv_mem_realloc(vl->rows, need * sizeof(lv_obj_t *));
+    if (rows == NULL) {
+        LOG_E("[VList] Row pool alloc failed (%lu rows)", need);
+        return false;
+    }
+
+    // 先把环形数组展开成从 0 开始的顺序，新行追加在末尾
+    std::rotate(rows, rows + vl->head, rows + vl->pool_cnt);
+    vl->head = 0;
+    vl->rows = rows;
+
+    uint32_t t0 = millis();
+    for (uint32_t i = vl->pool_cnt; i < need; i++) {
+        lv_obj_t *row = vl->create_cb(list, vl->user_data);
+        lv_obj_set_size(row, lv_pct(100), vl->row_h);
+        lv_obj_set_x(row, 0);
+        _bubble_tree(row);
+        rows[i] = row;
+        s_rows_created++;
+    }
+    LOG_D("[VList] Pool %u -> %lu rows in %lu ms", vl->pool_cnt, need, millis() - t0);
+    vl->pool_cnt = need;
+    return true;
+}
+
+/**
+ * @brief 把第 0 行移动到条目 top
+ */
+static void _move_to(lv_obj_t *list, vlist_t *vl, uint32_t top) {
+    uint32_t max_top = _max_top(list, vl);
+    if (top > max_top) top = max_top;
+    if (top == vl->top || vl->pool_cnt == 0) return;
+
+    int32_t delta = (int32_t)top - (int32_t)vl->top;
+    uint32_t dist = delta > 0 ? delta : -delta;
+    vl->top = top;
+
+    if (dist >= vl->pool_cnt) {
+        for (uint16_t slot = 0; slot < vl->pool_cnt; slot++) _bind_slot(vl, slot);
+    } else if (delta > 0) {
+        // 向下：移出顶部的行接到底部，只绑定底部新露出的 dist 行
+        vl->head = (vl->head + dist) % vl->pool_cnt;
+        for (uint16_t slot = vl->pool_cnt - dist; slot < vl->pool_cnt; slot++) _bind_slot(vl, slot);
+    } else {
+        vl->head = (vl->head + vl->pool_cnt - dist) % vl->pool_cnt;
+        for (uint16_t slot = 0; slot < dist; slot++) _bind_slot(vl, slot);
+    }
+    _layout(vl);
+    s_jumps++;
+}
+
+/**
+ * @brief 手势事件：换算为一次跳转
+ */
+static void _gesture_cb(lv_event_t *e) {
+    lv_obj_t *list = lv_event_get_current_target(e);
+    vlist_t *vl = _get(list);
+    lv_indev_t *indev = lv_indev_get_act();
+    if (vl == NULL || indev == NULL) return;
+
+    lv_dir_t dir = lv_indev_get_gesture_dir(indev);
+    if (dir != LV_DIR_TOP && dir != LV_DIR_BOTTOM) return;
+
+    uint32_t step = vl->unit == GUI_SNAP_ROW ? 1 : _visible_rows(list, vl);
+    uint32_t from = vl->top;
+    uint32_t to = dir == LV_DIR_TOP ? from + step : (from > step ? from - step : 0);
+
+    {
+        GuiTxn txn("VList");
+        _move_to(list, vl, to);
+        if (vl->top != from) {
+            gui_port_request_mode(GUI_SCROLL_FAST_WAVEFORM ? EPD_REFRESH_FAST : EPD_REFRESH_PARTIAL);
+        }
+    }
+    lv_indev_wait_release(indev);
+}
+
+/**
+ * @brief 列表删除时释放状态 (行控件作为子控件由 LVGL 一并删除)
+ */
+static void _delete_cb(lv_event_t *e) {
+    lv_obj_t *list = lv_event_get_target(e);
+    vlist_t *vl = _get(list);
+    if (vl == NULL) return;
+    lv_mem_free(vl->rows);
+    lv_mem_free(vl);
+    lv_obj_set_user_data(list, NULL);
+}
+
+/**
+ * @brief 创建虚拟列表
+ */
+lv_obj_t *gui_vlist_create(lv_obj_t *parent, lv_coord_t row_h,
+                           gui_vlist_create_cb_t create_cb, gui_vlist_bind_cb_t bind_cb, void *user_data) {
+    if (create_cb == NULL || bind_cb == NULL || row_h <= 0) return NULL;
+
+    vlist_t *vl = (vlist_t *)lv_mem_alloc(sizeof(vlist_t));
+    if (vl == NULL) return NULL;
+    lv_memset_00(vl, sizeof(vlist_t));
+    vl->create_cb = create_cb;
+    vl->bind_cb = bind_cb;
+    vl->user_data = user_data;
+    vl->row_h = row_h;
+    vl->unit = GUI_SNAP_PAGE;
+
+    lv_obj_t *list = lv_obj_create(parent);
+    lv_obj_remove_style_all(list);
+    lv_obj_clear_flag(list, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_clear_flag(list, LV_OBJ_FLAG_GESTURE_BUBBLE);
+    lv_obj_set_user_data(list, vl);
+    lv_obj_add_event_cb(list, _gesture_cb, LV_EVENT_GESTURE, NULL);
+    lv_obj_add_event_cb(list, _delete_cb, LV_EVENT_DELETE, NULL);
+    return list;
+}
+
+/**
+ * @brief 设置条目数并重新绑定
+ */
+void gui_vlist_set_count(lv_obj_t *list, uint32_t count) {
+    vlist_t *vl = _get(list);
+    if (vl == NULL) return;
+
+    vl->count = count;
+    bool grown = _ensure_pool(list, vl);
+    uint32_t max_top = _max_top(list, vl);
+    if (vl->top > max_top) vl->top = max_top;
+
+    for (uint16_t slot = 0; slot < vl->pool_cnt; slot++) _bind_slot(vl, slot);
+    if (grown) _layout(vl);
+}
+
+/**
+ * @brief 跳转到指定条目
+ */
+void gui_vlist_scroll_to(lv_obj_t *list, uint32_t index) {
+    vlist_t *vl = _get(list);
+    if (vl == NULL) return;
+    _move_to(list, vl, index);
+}
+
+/**
+ * @brief 设置手势跳转距离
+ */
+void gui_vlist_set_snap(lv_obj_t *list, gui_snap_unit_t unit) {
+    vlist_t *vl = _get(list);
+    if (vl) vl->unit = unit;
+}
+
+/**
+ * @brief 当前第一行的条目序号
+ */
+uint32_t gui_vlist_get_top(const lv_obj_t *list) {
+    const vlist_t *vl = _get(list);
+    return vl ? vl->top : 0;
+}
+
+#if GUI_VLIST_BENCH
+static lv_obj_t *_bench_row(lv_obj_t *parent, void *user_data) {
+    LV_UNUSED(user_data);
+    return lv_label_create(parent);
+}
+
+static void _bench_bind(lv_obj_t *row, uint32_t index, void *user_data) {
+    LV_UNUSED(user_data);
+    lv_label_set_text_fmt(row, "Item %lu", index);
+}
+
+/**
+ * @brief 构建基准测试
+ */
+void gui_vlist_bench(void) {
+    gui_port_hold_refresh(true);
+    for (uint32_t n : s_bench_counts) {
+        uint32_t rows0 = s_rows_created;
+        uint32_t heap0 = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+#if LV_MEM_CUSTOM == 0
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        uint32_t lv0 = mon.free_size;
+#endif
+        uint32_t t0 = micros();
+        lv_obj_t *list = gui_vlist_create(lv_scr_act(), BENCH_ROW_H, _bench_row, _bench_bind, NULL);
+        if (list == NULL) break;
+        lv_obj_set_size(list, LV_HOR_RES, LV_VER_RES);
+        gui_vlist_set_count(list, n);
+        uint32_t us = micros() - t0;
+
+        uint32_t heap_used = heap0 - heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+#if LV_MEM_CUSTOM == 0
+        lv_mem_monitor(&mon);
+        LOG_I("[VList] Bench %lu items: pool %lu rows, lv_mem %lu B, heap %lu B, build %lu us",
+              n, s_rows_created - rows0, lv0 - mon.free_size, heap_used, us);
+#else
+        LOG_I("[VList] Bench %lu items: pool %lu rows, heap %lu B, build %lu us",
+              n, s_rows_created - rows0, heap_used, us);
+#endif
+        lv_obj_del(list);
+    }
+    lv_refr_now(NULL);
+    gui_port_hold_refresh(false);
+}
+#endif
+
+/**
+ * @brief 输出虚拟列表统计
+ */
+void gui_vlist_report(void) {
+    LOG_I("[VList] rows created=%lu binds=%lu jumps=%lu", s_rows_created, s_binds, s_jumps);
+}
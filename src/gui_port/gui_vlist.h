@@ -0,0 +1,99 @@
+/**
+ * @file gui_vlist.h
+ * @brief 虚拟列表 (行对象池)
+ * @details 单词本、备忘录、长设置列表等页面的条目可能成百上千，逐条创建 LVGL 控件会耗尽内存，
+ *          构建时间也随条目数线性增长。虚拟列表只创建 "可见行 + 少量余量" 个行控件，
+ *          翻页时复用这些行并重新绑定数据，内存与构建时间与列表长度无关。
+ *          翻页方式与 gui_scroll 一致：上下滑动手势换算为整页 / 单行跳转，每次跳转只局刷列表区域。
+ */
+#ifndef GUI_VLIST_H
+#define GUI_VLIST_H
+
+#include <lvgl.h>
+#include <stdint.h>
+#include "gui_scroll.h"
+
+// 可见行之外额外创建的行数 (放在可视区下方，预先绑定好，单行跳转时直接露出)
+#ifndef GUI_VLIST_MARGIN
+#define GUI_VLIST_MARGIN 1
+#endif
+
+// 启动时分别以 10 / 1000 / 100000 个条目构建列表，输出行池大小、内存占用与构建耗时
+#ifndef GUI_VLIST_BENCH
+#define GUI_VLIST_BENCH 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 行控件创建回调 (每个池中的行调用一次)
+ * @param parent    列表对象，行控件须创建在它下面
+ * @param user_data gui_vlist_create 传入的用户数据
+ * @return 行控件 (宽度、高度、位置由列表设置)
+ */
+typedef lv_obj_t *(*gui_vlist_create_cb_t)(lv_obj_t *parent, void *user_data);
+
+/**
+ * @brief 行数据绑定回调 (行显示新条目时调用)
+ * @param row       行控件 (create_cb 的返回值)
+ * @param index     条目序号
+ * @param user_data gui_vlist_create 传入的用户数据
+ * @details 回调中只修改行内控件的文本/状态，不要创建或删除控件。
+ */
+typedef void (*gui_vlist_bind_cb_t)(lv_obj_t *row, uint32_t index, void *user_data);
+
+/**
+ * @brief 创建虚拟列表
+ * @param parent    父控件
+ * @param row_h     行高 (像素，所有行等高)
+ * @param create_cb 行控件创建回调
+ * @param bind_cb   行数据绑定回调
+ * @param user_data 传给两个回调的用户数据
+ * @return 列表对象 (普通 lv_obj，可按常规方式设置大小、位置和样式)
+ * @details 行控件在第一次 gui_vlist_set_count 时按列表当前高度创建。
+ */
+lv_obj_t *gui_vlist_create(lv_obj_t *parent, lv_coord_t row_h,
+                           gui_vlist_create_cb_t create_cb, gui_vlist_bind_cb_t bind_cb, void *user_data);
+
+/**
+ * @brief 设置条目数并重新绑定全部可见行
+ * @param list  列表对象
+ * @param count 条目数
+ * @details 数据内容变化 (条目数不变) 时也可调用，用于强制刷新可见行。
+ */
+void gui_vlist_set_count(lv_obj_t *list, uint32_t count);
+
+/**
+ * @brief 跳转到指定条目 (置于第一行，自动限制在有效范围内)
+ */
+void gui_vlist_scroll_to(lv_obj_t *list, uint32_t index);
+
+/**
+ * @brief 设置手势跳转的距离 (默认整页)
+ */
+void gui_vlist_set_snap(lv_obj_t *list, gui_snap_unit_t unit);
+
+/**
+ * @brief 当前第一行显示的条目序号
+ */
+uint32_t gui_vlist_get_top(const lv_obj_t *list);
+
+/**
+ * @brief 构建基准测试：在当前页面上临时创建整屏列表，依次设置 10 / 1000 / 100000 个条目
+ * @details 每种条目数输出行池大小、lv_mem 与系统堆的增量、创建 + 绑定耗时，随后删除列表。
+ *          期间扣住刷屏，画面不变。主机端的同一测试见 tools/vlist_bench.py。
+ */
+void gui_vlist_bench(void);
+
+/**
+ * @brief 输出虚拟列表统计 (行控件总数、绑定次数)
+ */
+void gui_vlist_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_VLIST_H
@@ -0,0 +1,239 @@
+/**
+ * @file gui_wf.cpp
+ * @brief 按区域选择刷新波形实现
+ * @details 注册表与累积区域只在 GUI 线程中访问；刷新统计由刷屏线程写入、GUI 线程读取，
+ *          都是独立的 32 位计数，不加锁 (报告允许偏差一次刷新)。
+ */
+#include "gui_wf.h"
+#include "gui_inv.h"
+#include "gui_port.h"
+#include "common/Log.h"
+#include <Arduino.h>
+
+#define WF_FLAG LV_OBJ_FLAG_USER_1   ///< 已标注标记 (祖先查找时跳过未标注的控件)
+
+typedef struct {
+    lv_obj_t *obj;
+    uint8_t cls;
+} wf_entry_t;
+
+typedef struct {
+    bool valid;
+    lv_area_t area;    ///< 本帧该类别脏区域的外接矩形
+} wf_acc_t;
+
+typedef struct {
+    uint32_t frames;   ///< 由该类别决定刷新方式的帧数
+    uint32_t refreshes;
+    uint32_t total_ms;
+    uint32_t max_ms;
+} wf_stat_t;
+
+static wf_entry_t s_reg[GUI_WF_MAX];
+static uint8_t s_reg_cnt = 0;
+static wf_acc_t s_acc[GUI_WF_CLASS_CNT];
+static wf_stat_t s_stat[GUI_WF_CLASS_CNT];
+static uint32_t s_splits = 0;
+static int8_t s_check = -1;     ///< 自检结果 (-1 未运行)
+
+static const char *const s_names[GUI_WF_CLASS_CNT] = {"none", "partial", "fast", "quality"};
+
+// 类别对应的刷新方式 (GUI_WF_NONE 由调用方替换为请求的方式)
+static const epd_refresh_mode_t s_mode[GUI_WF_CLASS_CNT] = {
+    EPD_REFRESH_FULL, EPD_REFRESH_PARTIAL, EPD_REFRESH_FAST, EPD_REFRESH_FULL,
+};
+
+static int _find(const lv_obj_t *obj) {
+    for (int i = 0; i < s_reg_cnt; i++) {
+        if (s_reg[i].obj == obj) return i;
+    }
+    return -1;
+}
+
+static void _remove(int i) {
+    lv_obj_clear_flag(s_reg[i].obj, WF_FLAG);
+    s_reg[i] = s_reg[--s_reg_cnt];
+}
+
+static void _delete_cb(lv_event_t *e) {
+    int i = _find(lv_event_get_target(e));
+    if (i >= 0) s_reg[i] = s_reg[--s_reg_cnt];
+}
+
+/**
+ * @brief 标注控件
+ */
+void gui_wf_set(lv_obj_t *obj, gui_wf_class_t cls) {
+    if (obj == NULL || cls >= GUI_WF_CLASS_CNT) return;
+    int i = _find(obj);
+    if (cls == GUI_WF_NONE) {
+        if (i >= 0) {
+            lv_obj_remove_event_cb(obj, _delete_cb);
+            _remove(i);
+        }
+        return;
+    }
+    if (i < 0) {
+        if (s_reg_cnt >= GUI_WF_MAX) {
+            LOG_E("[WF] Registry full, %p not tagged", (void *)obj);
+            return;
+        }
+        i = s_reg_cnt++;
+        s_reg[i].obj = obj;
+        lv_obj_add_flag(obj, WF_FLAG);
+        lv_obj_add_event_cb(obj, _delete_cb, LV_EVENT_DELETE, NULL);
+    }
+    s_reg[i].cls = cls;
+}
+
+/**
+ * @brief 查询类别 (含祖先继承)
+ */
+gui_wf_class_t gui_wf_get(const lv_obj_t *obj) {
+    for (; obj != NULL; obj = lv_obj_get_parent(obj)) {
+        if (!lv_obj_has_flag(obj, WF_FLAG)) continue;
+        int i = _find(obj);
+        if (i >= 0) return (gui_wf_class_t)s_reg[i].cls;
+    }
+    return GUI_WF_NONE;
+}
+
+/**
+ * @brief 记录脏区域
+ * @details 来源未知 (LVGL 内部的失效) 时，区域完全落在某个已标注控件 (含扩展绘制区域) 内则归入其类别。
+ */
+void gui_wf_on_area(const lv_area_t *area) {
+    const lv_obj_t *ctx = gui_inv_current_obj();
+    gui_wf_class_t cls = GUI_WF_NONE;
+    if (ctx != NULL) {
+        cls = gui_wf_get(ctx);
+    } else {
+        for (int i = 0; i < s_reg_cnt; i++) {
+            lv_area_t c;
+            lv_obj_get_coords(s_reg[i].obj, &c);
+            lv_coord_t ext = _lv_obj_get_ext_draw_size(s_reg[i].obj);
+            lv_area_increase(&c, ext, ext);
+            if (_lv_area_is_in(area, &c, 0)) {
+                cls = (gui_wf_class_t)s_reg[i].cls;
+                break;
+            }
+        }
+    }
+
+    wf_acc_t *a = &s_acc[cls];
+    if (a->valid) _lv_area_join(&a->area, &a->area, area);
+    else a->area = *area;
+    a->valid = true;
+}
+
+/**
+ * @brief 决定本帧的刷新方式
+ */
+bool gui_wf_plan(epd_refresh_mode_t req, gui_wf_plan_t *plan) {
+    plan->mode = req;
+    plan->cls = GUI_WF_NONE;
+    plan->split = false;
+
+    bool any = false;
+    for (uint8_t c = 0; c < GUI_WF_CLASS_CNT; c++) {
+        if (!s_acc[c].valid) continue;
+        epd_refresh_mode_t m = c == GUI_WF_NONE ? req : s_mode[c];
+        // 枚举值越小越 "强" (FULL < FAST < PARTIAL)
+        if (!any || m < plan->mode) {
+            plan->mode = m;
+            plan->cls = c;
+        }
+        any = true;
+    }
+    if (!any) return false;
+
+#if GUI_WF_SPLIT
+    // 局刷类区域与所有需要整屏刷新的区域都不相交时，先单独局刷
+    if (plan->mode != EPD_REFRESH_PARTIAL && s_acc[GUI_WF_PARTIAL].valid) {
+        bool disjoint = true;
+        for (uint8_t c = 0; c < GUI_WF_CLASS_CNT; c++) {
+            if (c == GUI_WF_PARTIAL || !s_acc[c].valid) continue;
+            if ((c == GUI_WF_NONE ? req : s_mode[c]) == EPD_REFRESH_PARTIAL) continue;
+            if (_lv_area_is_on(&s_acc[c].area, &s_acc[GUI_WF_PARTIAL].area)) disjoint = false;
+        }
+        if (disjoint) {
+            plan->split = true;
+            plan->split_area = s_acc[GUI_WF_PARTIAL].area;
+            s_splits++;
+        }
+    }
+#endif
+
+    s_stat[plan->cls].frames++;
+    LOG_D("[WF] Frame: %s by %s%s", plan->mode == EPD_REFRESH_PARTIAL ? "partial" : (plan->mode == EPD_REFRESH_FAST ? "fast" : "full"),
+          s_names[plan->cls], plan->split ? " (+partial first)" : "");
+    gui_wf_reset();
+    return true;
+}
+
+/**
+ * @brief 丢弃累积
+ */
+void gui_wf_reset(void) {
+    for (uint8_t c = 0; c < GUI_WF_CLASS_CNT; c++) s_acc[c].valid = false;
+}
+
+/**
+ * @brief 记录一次刷新 (刷屏线程)
+ */
+void gui_wf_on_refresh(uint8_t cls, epd_refresh_mode_t mode, uint32_t ms) {
+    if (cls >= GUI_WF_CLASS_CNT) return;
+    LV_UNUSED(mode);
+    wf_stat_t *s = &s_stat[cls];
+    s->refreshes++;
+    s->total_ms += ms;
+    if (ms > s->max_ms) s->max_ms = ms;
+}
+
+#if GUI_WF_CHECK
+/**
+ * @brief 自检
+ */
+bool gui_wf_check(void) {
+    gui_port_hold_refresh(true);
+    lv_refr_now(NULL);
+
+    lv_obj_t *sw = lv_switch_create(lv_scr_act());
+    lv_obj_align(sw, LV_ALIGN_CENTER, 0, 0);
+    gui_wf_set(sw, GUI_WF_PARTIAL);
+    lv_refr_now(NULL);
+    gui_wf_reset();
+
+    // 只切换开关：渲染这一帧后本帧应只有局刷类区域
+    lv_obj_add_state(sw, LV_STATE_CHECKED);
+    lv_refr_now(NULL);
+    gui_wf_plan_t plan;
+    bool any = gui_wf_plan(EPD_REFRESH_FULL, &plan);
+    bool ok = any && plan.mode == EPD_REFRESH_PARTIAL && plan.cls == GUI_WF_PARTIAL;
+    // 自检帧不计入统计
+    if (any) s_stat[plan.cls].frames--;
+
+    lv_obj_del(sw);
+    lv_refr_now(NULL);
+    gui_wf_reset();
+    gui_port_hold_refresh(false);
+
+    s_check = ok ? 1 : 0;
+    if (ok) LOG_I("[WF] Check: switch-only frame -> partial");
+    else    LOG_E("[WF] Check failed: switch-only frame -> %s by %s", plan.mode == EPD_REFRESH_FAST ? "fast" : "full", s_names[plan.cls]);
+    return ok;
+}
+#endif
+
+/**
+ * @brief 输出统计
+ */
+void gui_wf_report(void) {
+    LOG_I("[WF] Refresh classes (%u tagged objects, %lu split frames, check %s):", s_reg_cnt, s_splits,
+          s_check < 0 ? "not run" : (s_check ? "ok" : "FAILED"));
+    for (uint8_t c = 0; c < GUI_WF_CLASS_CNT; c++) {
+        const wf_stat_t *s = &s_stat[c];
+        LOG_RAW("  %-8s frames=%lu refreshes=%lu avg=%lu ms max=%lu ms\n", s_names[c], s->frames, s->refreshes,
+                s->refreshes ? s->total_ms / s->refreshes : 0, s->max_ms);
+    }
+}
@@ -0,0 +1,119 @@
+/**
+ * @file gui_wf.h
+ * @brief 按区域选择刷新波形 (控件刷新类别标注)
+ * @details 屏幕上不同区域对刷新的要求不同：时钟数字、开关只要快 (局刷，不闪烁)，
+ *          照片、日历网格要对比度和无残影 (全刷)。LVGL 渲染时只知道 "哪里脏了"，
+ *          本模块让控件带上刷新类别：
+ *          - gui_wf_set 把控件登记到注册表并打上 LV_OBJ_FLAG_USER_1 (子控件继承最近的带标记祖先)；
+ *          - rounder_cb 中按失效来源 (gui_inv 的 --wrap 挂钩) 把每块脏区域归入一个类别，
+ *            来源未知时按区域落在哪个已登记控件内判断；
+ *          - gui_port 结算一帧时由 gui_wf_plan 决定刷新方式：取各类别中最强的一种，
+ *            未标注的区域沿用本次请求的方式 (gui_port_request_mode，默认全刷)；
+ *          - 局刷类区域与需要整屏刷新的区域互不相交时拆成两次：先局刷这块区域 (约 0.3 s 上墨)，
+ *            再做整屏刷新，局刷类内容不必等待 1.5 ~ 3 s 的整屏波形。
+ *          刷屏线程按类别统计次数与耗时，由 gui_wf_report 输出。
+ */
+#ifndef GUI_WF_H
+#define GUI_WF_H
+
+#include <lvgl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "bsp/bsp_epd.h"
+
+// 注册表容量 (已标注的控件个数)
+#ifndef GUI_WF_MAX
+#define GUI_WF_MAX 16
+#endif
+
+// 局刷类区域与整屏刷新区域不相交时拆成先局刷、后整屏两次
+#ifndef GUI_WF_SPLIT
+#define GUI_WF_SPLIT 1
+#endif
+
+// 启动时在设备上自检：只有一个局刷类开关变化的帧须得到局刷 (扣住刷屏，不产生实际刷新)
+// 规划逻辑本身由主机端测试 tools/wf_test.py 覆盖
+#ifndef GUI_WF_CHECK
+#define GUI_WF_CHECK 0
+#endif
+
+/**
+ * @brief 刷新类别
+ */
+typedef enum {
+    GUI_WF_NONE = 0,       ///< 未标注：沿用本次请求的刷新方式
+    GUI_WF_PARTIAL,        ///< 局刷 (时钟数字、开关、计数器)
+    GUI_WF_FAST,           ///< 整屏快刷
+    GUI_WF_QUALITY,        ///< 全刷 (照片、日历网格、图表)
+    GUI_WF_CLASS_CNT
+} gui_wf_class_t;
+
+/**
+ * @brief 一帧的刷新计划
+ */
+typedef struct {
+    epd_refresh_mode_t mode;   ///< 整帧的刷新方式
+    uint8_t cls;               ///< 决定该方式的类别 (gui_wf_class_t)
+    bool split;                ///< 先单独局刷 split_area
+    lv_area_t split_area;      ///< 局刷类区域 (逻辑坐标)
+} gui_wf_plan_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 标注控件的刷新类别 (GUI_WF_NONE 取消标注)
+ * @details 控件删除时自动移出注册表；页面被缓存淘汰重建后须重新标注 (重复调用无副作用)。
+ */
+void gui_wf_set(lv_obj_t *obj, gui_wf_class_t cls);
+
+/**
+ * @brief 查询控件的刷新类别 (自身未标注时取最近的已标注祖先)
+ */
+gui_wf_class_t gui_wf_get(const lv_obj_t *obj);
+
+/**
+ * @brief 记录一块脏区域 (在 rounder_cb 中调用)
+ */
+void gui_wf_on_area(const lv_area_t *area);
+
+/**
+ * @brief 根据本帧累积的脏区域决定刷新方式，并清空累积
+ * @param req 本次请求的方式 (未标注区域使用)
+ * @return false 本帧没有记录到脏区域 (plan 为 req 本身)
+ */
+bool gui_wf_plan(epd_refresh_mode_t req, gui_wf_plan_t *plan);
+
+/**
+ * @brief 丢弃本帧累积的脏区域 (帧未变化或首帧时调用)
+ */
+void gui_wf_reset(void);
+
+/**
+ * @brief 记录一次实际刷新 (刷屏线程调用)
+ * @param cls  类别
+ * @param mode 实际执行的方式 (可能被升级为全刷)
+ * @param ms   耗时
+ */
+void gui_wf_on_refresh(uint8_t cls, epd_refresh_mode_t mode, uint32_t ms);
+
+#if GUI_WF_CHECK
+/**
+ * @brief 自检：在当前页面上临时创建一个标注为局刷的开关，只切换它并渲染一帧，确认计划为局刷
+ * @details 期间扣住刷屏，结束后删除开关并恢复，画面不变时不产生刷新。须在首页显示之后调用。
+ * @return true 计划为局刷
+ */
+bool gui_wf_check(void);
+#endif
+
+/**
+ * @brief 输出各类别的帧数、刷新次数与平均 / 最长耗时，以及拆分次数
+ */
+void gui_wf_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_WF_H
@@ -14,18 +14,39 @@
 
 #include "common/Log.h" // 引入日志系统
 #include "gui_port/gui_port.h"
+#include "gui_port/gui_asset.h"
+#include "gui_port/gui_audit.h"
+#include "gui_port/gui_bwr.h"
+#include "gui_port/gui_decode.h"
+#include "gui_port/gui_fb.h"
+#include "gui_port/gui_font.h"
+#include "gui_port/gui_font_stream.h"
+#include "gui_port/gui_overlay.h"
+#include "gui_port/gui_pack.h"
+#include "gui_port/gui_qr.h"
+#include "gui_port/gui_vlist.h"
+#include "gui_port/gui_wf.h"
 #include "system/SysEvent.h"
 #include "system/PageManager.h"
 #include "system/SysController.h" // SysController
-
-// 引入首发 App
-#include "app/app_home.h"
+#include "ui/ui.h"
 
 // === 全局变量 ===
 QueueHandle_t g_gui_queue = NULL;     ///< GUI 线程消息队列 (接收来自 Worker 的消息)
 QueueHandle_t g_worker_queue = NULL;  ///< Worker 线程消息队列 (接收来自 GUI 的消息)
 TaskHandle_t hGuiTask = NULL;         ///< GUI 任务句柄 (用于触摸中断唤醒)
 
+/**
+ * @brief 固件内置图片 (名称与 tools/asset_pack.py 一致，资源包中的同名图片优先)
+ */
+static const struct {
+    const char *name;
+    const lv_img_dsc_t *img;
+} s_builtin_imgs[] = {
+    { "back", &ui_img_back_png },
+};
+#define BUILTIN_IMG_CNT (sizeof(s_builtin_imgs) / sizeof(s_builtin_imgs[0]))
+
 /* ==================================================================
  * Task 1: GUI 线程 (运行在 Core 1)
  * 职责：
@@ -36,8 +57,52 @@ TaskHandle_t hGuiTask = NULL;         ///< GUI 任务句柄 (用于触摸中断
 void Task_GUI(void *pvParameters) {
     sys_event_t event;
 
-    // 启动第一个 App
-    PageManager::loadApp(new App_Home());
+    // 映射 assets 分区上的资源包 (图片、字体直接引用 flash，须在字体挂载与构建页面之前)
+    gui_pack_init();
+    for (uint16_t i = 0; i < BUILTIN_IMG_CNT; i++) gui_pack_register_img(s_builtin_imgs[i].name, s_builtin_imgs[i].img);
+#if GUI_DECODE_BENCH
+    gui_decode_bench();
+#endif
+#if GUI_QR_BENCH
+    gui_qr_bench();
+#endif
+#if GUI_BWR_BENCH
+    gui_bwr_bench();
+#endif
+
+    // 挂载全字库 (资源包中的字体优先，其次 font 分区) (须在构建页面之前，页面构建时会替换内置字体)
+    if (gui_font_stream_init(&ui_font_ChineseSong16) != NULL && GUI_FONT_BENCH) {
+        gui_font_stream_bench(NULL);
+    }
+
+    // 压缩图片 (ui_img_*) 的解码器，须在构建页面之前注册
+    gui_asset_init();
+#if GUI_ASSET_BENCH
+    const lv_img_dsc_t *bench_imgs[BUILTIN_IMG_CNT];
+    for (uint16_t i = 0; i < BUILTIN_IMG_CNT; i++) bench_imgs[i] = s_builtin_imgs[i].img;
+    gui_asset_bench(bench_imgs, BUILTIN_IMG_CNT);
+#endif
+
+    // 初始化主题与页面注册表 (只登记，首页由下方 startRoot 构建并显示，其余页面按需或空闲时构建)
+    ui_init();
+
+    // 空闲刷新统计 (每分钟输出一次渲染 / 刷屏次数)
+    gui_audit_start();
+
+    // 启动根 App (实例由 AppRegistry 在预分配槽位中构造，不占用堆)
+    PageManager::startRoot(APP_ID_HOME);
+#if GUI_FB_BENCH
+    gui_fb_bench();
+#endif
+#if GUI_OVERLAY_BENCH
+    gui_overlay_bench();
+#endif
+#if GUI_VLIST_BENCH
+    gui_vlist_bench();
+#endif
+#if GUI_WF_CHECK
+    gui_wf_check();
+#endif
     
     // 初始化活动计时
     SysController::updateActivity();
@@ -16,10 +16,12 @@
  * @brief 应用基类 (抽象类)
  * 
  * @details
- * 所有的页面应用 (如 App_Home, App_Setting) 都必须继承此类。
+ * 所有的页面应用 (如 App_Home, App_Setting) 都必须继承此类，并在 AppRegistry 中登记。
+ * App 实例由 AppRegistry 在预分配槽位中构造，App 的页面由 PageManager 在 onStart / onResume 之前显示。
  * 它定义了 App 的标准生命周期：
- * - `onStart()`: 启动时调用 (创建 UI，申请资源)
- * - `onStop()`: 停止时调用 (销毁 UI，释放资源)
+ * - `onStart()`: 启动时调用 (加载数据，申请资源)
+ * - `onPause()` / `onResume()`: 进入其他 App / 从其他 App 返回时调用 (实例留在返回栈中，页面对象保留在 ScreenCache 中)
+ * - `onStop()`: 停止时调用 (释放资源)
  * - `onEvent()`: 处理系统事件
  * - `onRunningLoop()`: 后台轮询
  */
@@ -27,36 +29,58 @@ class AppBase {
 public:
     /**
      * @brief 虚析构函数
-     * @details 确保通过基类指针删除派生类对象时，派生类的析构函数能被正确调用。
+     * @details 确保通过基类指针析构派生类对象时 (AppRegistry::destroy)，派生类的析构函数能被正确调用。
      */
     virtual ~AppBase() {}
 
     /**
      * @brief [生命周期] App 启动
      * @details 
-     * 在 App 被 PageManager 加载时调用。
+     * 在 App 被 PageManager 加载时调用，此时 App 的页面已显示。
      * 通常在此处进行：
-     * 1. 调用 LVGL 的 screen_init 函数初始化 UI。
-     * 2. 加载初始数据。
-     * 3. 发送初始网络请求。
+     * 1. 加载初始数据。
+     * 2. 发送初始网络请求。
      */
     virtual void onStart() = 0;
 
     /**
      * @brief [生命周期] App 停止
      * @details 
-     * 在 App 被切换（销毁）前调用。
+     * 在 App 出栈（析构）前调用。
      * 必须在此处进行：
-     * 1. 销毁 LVGL 对象 (`lv_obj_del`)，释放 RAM。
-     * 2. 停止未完成的定时器或任务。
+     * 1. 停止未完成的定时器或任务。
+     * 2. 释放 App 自己申请的资源。
+     * @note 页面对象由 ScreenCache 统一管理 (按内存预算 LRU 淘汰)，
+     *       App 不应再自行 `lv_obj_del` 页面，否则每次进入都要重建。
      */
     virtual void onStop() = 0;
 
+    /**
+     * @brief [生命周期] App 暂停
+     * @details 
+     * 启动其他 App 时调用 (本 App 留在返回栈中)，例如从主页进入日历页。
+     * 页面对象仍保留在缓存中，可在此暂停定时器等周期性刷新。
+     * 默认实现为空。
+     */
+    virtual void onPause() {}
+
+    /**
+     * @brief [生命周期] App 恢复
+     * @details 
+     * 上层 App 返回后调用 (此时页面已重新显示)，替代 "销毁后重建" 的流程。
+     * 若页面在暂停期间被缓存淘汰，回到页面时会由 ScreenCache 自动重建，
+     * App 可在此重新填充数据。
+     * 默认实现为空。
+     */
+    virtual void onResume() {}
+
     /**
      * @brief [事件] 处理系统事件
      * @param event 接收到的事件
      * @details 
      * 处理从 Worker 线程发来的数据 (如天气更新) 或其他系统通知。
+     * PageManager 已将本函数包在 UI 事务中，函数内的多处控件修改只刷一次屏；
+     * 在其他地方批量更新控件时可自行使用 `GuiTxn` (gui_port/gui_txn.h)。
      * 默认实现为空。
      */
     virtual void onEvent(sys_event_t* event) {}
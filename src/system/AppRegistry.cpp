@@ -0,0 +1,56 @@
+#include "AppRegistry.h"
+#include "common/Log.h"
+#include "ui/ui.h"
+
+#include "app/app_home.h"
+#include "app/app_calendar.h"
+#include "app/app_weather.h"
+#include "app/app_setting.h"
+#include "app/app_launcher.h"
+
+/**
+ * @file AppRegistry.cpp
+ * @brief App 注册表实现文件
+ */
+
+/**
+ * @brief App 注册表
+ * @note 必须按 app_id_t 的顺序排列，新增 App 时同步修改 PageBridge.h 中的枚举。
+ */
+const AppDesc AppRegistry::table[APP_ID_COUNT] = {
+    { APP_ID_HOME,     "Home",     &AppRegistry::factory<App_Home>,     &ui_HomePage,     App_Home::screenInit },
+    { APP_ID_CALENDAR, "Calendar", &AppRegistry::factory<App_Calendar>, &ui_CalendarPage, ui_CalendarPage_screen_init },
+    { APP_ID_WEATHER,  "Weather",  &AppRegistry::factory<App_Weather>,  &ui_WeatherPage,  ui_WeatherPage_screen_init },
+    { APP_ID_SETTING,  "Setting",  &AppRegistry::factory<App_Setting>,  &ui_SettingPage,  ui_SettingPage_screen_init },
+    { APP_ID_LAUNCHER, "Launcher", &AppRegistry::factory<App_Launcher>, &ui_AppPage,      App_Launcher::screenInit },
+};
+
+// App 实例槽位 (每层返回栈一个)
+alignas(max_align_t) uint8_t AppRegistry::storage[APP_STACK_DEPTH][APP_STORAGE_SIZE];
+
+/**
+ * @brief 查找 App 描述
+ */
+const AppDesc* AppRegistry::get(app_id_t id) {
+    if ((unsigned)id >= APP_ID_COUNT) return nullptr;
+    return &table[id];
+}
+
+/**
+ * @brief 在指定槽位构造 App 实例
+ */
+AppBase* AppRegistry::create(app_id_t id, uint8_t slot) {
+    const AppDesc* desc = get(id);
+    if (desc == nullptr || slot >= APP_STACK_DEPTH) {
+        LOG_E("[App] Create failed: id=%d slot=%u", (int)id, slot);
+        return nullptr;
+    }
+    return desc->create(storage[slot]);
+}
+
+/**
+ * @brief 析构 App 实例
+ */
+void AppRegistry::destroy(AppBase* app) {
+    if (app) app->~AppBase();
+}
@@ -0,0 +1,92 @@
+#ifndef APP_REGISTRY_H
+#define APP_REGISTRY_H
+
+#include "AppBase.h"
+#include "PageBridge.h"
+#include <new>
+#include <stddef.h>
+
+/**
+ * @file AppRegistry.h
+ * @brief App 注册表头文件
+ * @details 定义了 AppRegistry 类，负责按 app_id_t 查找 App 描述并在预分配内存中构造 App 实例。
+ */
+
+// ==========================================
+// 配置区域
+// ==========================================
+
+/// 单个 App 实例可用的最大字节数 (超出会在编译期报错)
+#ifndef APP_STORAGE_SIZE
+#define APP_STORAGE_SIZE 64
+#endif
+
+/// 返回栈最大深度 (同时也是可同时存活的 App 实例数)
+#ifndef APP_STACK_DEPTH
+#define APP_STACK_DEPTH 4
+#endif
+
+/**
+ * @struct AppDesc
+ * @brief App 描述 (注册表中的一项)
+ */
+struct AppDesc {
+    app_id_t id;                          ///< App ID
+    const char* name;                     ///< App 名称 (用于日志)
+    AppBase* (*create)(void* mem);        ///< 工厂函数：在 mem 处构造实例
+    lv_obj_t** screen;                    ///< App 页面的全局指针地址 (如 &ui_HomePage)
+    void (*screenInit)(void);             ///< 页面构建函数 (经 ScreenCache 调用)
+};
+
+/**
+ * @class AppRegistry
+ * @brief App 注册表 (静态工具类)
+ *
+ * @details
+ * 1. 注册表：全部 App 在 AppRegistry.cpp 中以常量表登记，按 app_id_t 直接索引。
+ * 2. 工厂：实例用 placement-new 构造在静态预分配的槽位中，切换 App 不经过堆，
+ *    也就不会产生堆碎片。每一层返回栈固定对应一个槽位。
+ * 3. 尺寸检查：`factory<T>` 在编译期检查 `sizeof(T) <= APP_STORAGE_SIZE`。
+ */
+class AppRegistry {
+public:
+    /**
+     * @brief 查找 App 描述
+     * @param id App ID
+     * @return 描述指针，ID 无效时返回 nullptr
+     */
+    static const AppDesc* get(app_id_t id);
+
+    /**
+     * @brief 在指定槽位构造 App 实例
+     * @param id   App ID
+     * @param slot 槽位编号 (0 ~ APP_STACK_DEPTH-1，即返回栈层数)
+     * @return App 实例指针，失败返回 nullptr
+     * @note 调用者需保证该槽位当前为空 (已 destroy)
+     */
+    static AppBase* create(app_id_t id, uint8_t slot);
+
+    /**
+     * @brief 析构 App 实例 (不释放内存，槽位可立即复用)
+     * @param app App 实例指针
+     */
+    static void destroy(AppBase* app);
+
+    /**
+     * @brief 工厂函数模板
+     * @tparam T App 类型
+     * @param mem 预分配的槽位内存
+     */
+    template <typename T>
+    static AppBase* factory(void* mem) {
+        static_assert(sizeof(T) <= APP_STORAGE_SIZE, "App too large, increase APP_STORAGE_SIZE");
+        static_assert(alignof(T) <= alignof(max_align_t), "App alignment not supported");
+        return new (mem) T();
+    }
+
+private:
+    static const AppDesc table[APP_ID_COUNT];
+    alignas(max_align_t) static uint8_t storage[APP_STACK_DEPTH][APP_STORAGE_SIZE];
+};
+
+#endif
@@ -0,0 +1,89 @@
+/**
+ * @file PageBridge.h
+ * @brief PageManager 的 C 语言接口
+ * @details SquareLine 生成的 UI 代码是 C 语言，无法直接调用 PageManager / ScreenCache，
+ *          通过本头文件中的 C 函数转接。
+ */
+#ifndef PAGE_BRIDGE_H
+#define PAGE_BRIDGE_H
+
+#include <lvgl.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief App ID (AppRegistry 注册表下标)
+ * @note 新增 App 时需同步修改 AppRegistry.cpp 中的注册表。
+ */
+typedef enum {
+    APP_ID_HOME = 0,   ///< 主页
+    APP_ID_CALENDAR,   ///< 日历
+    APP_ID_WEATHER,    ///< 天气
+    APP_ID_SETTING,    ///< 设置
+    APP_ID_LAUNCHER,   ///< 应用启动器
+    APP_ID_COUNT
+} app_id_t;
+
+/**
+ * @brief 经页面缓存切换页面 (替代直接 lv_scr_load_anim)
+ * @param target      页面全局指针地址
+ * @param anim        切换动画
+ * @param time        动画时长
+ * @param delay       动画延时
+ * @param target_init 页面为空时的构建函数
+ */
+void page_show_screen(lv_obj_t **target, lv_scr_load_anim_t anim, uint32_t time, uint32_t delay,
+                      void (*target_init)(void));
+
+/**
+ * @brief 经页面缓存获取页面 (必要时构建)，不切换
+ * @return true 本次调用触发了页面构建
+ */
+bool page_acquire_screen(lv_obj_t **target, void (*target_init)(void));
+
+/**
+ * @brief 登记页面到页面注册表 (不构建)
+ * @param name        页面名称 (常量字符串)
+ * @param target      页面全局指针地址
+ * @param target_init 页面构建函数
+ * @param prebuild    是否允许在 GUI 空闲时后台预构建
+ */
+void page_register_screen(const char *name, lv_obj_t **target, void (*target_init)(void), bool prebuild);
+
+/**
+ * @brief 启动页面后台预构建 (GUI 空闲时逐个构建)
+ */
+void page_start_prebuild(void);
+
+/**
+ * @brief 查询页面名称 (页面注册表中的名称)
+ * @param scr 页面对象
+ * @return 名称，未登记时返回 NULL
+ */
+const char *page_screen_name(const lv_obj_t *scr);
+
+/**
+ * @brief 导航按钮事件处理：进入指定 App
+ * @param e  LVGL 事件
+ * @param id 目标 App
+ * @details PRESSED 时预渲染目标页面，PRESS_LOST 时丢弃，
+ *          CLICKED 时提交预渲染帧并经 PageManager 启动 App (压入返回栈)。
+ */
+void page_nav_event(lv_event_t *e, app_id_t id);
+
+/**
+ * @brief 返回按钮事件处理：回到返回栈中的上一个 App
+ * @param e LVGL 事件
+ * @details 预渲染的目标为返回栈中的上一层页面，其余同 page_nav_event。
+ */
+void page_nav_back_event(lv_event_t *e);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PAGE_BRIDGE_H
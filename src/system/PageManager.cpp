@@ -1,4 +1,27 @@
 #include "PageManager.h"
+#include "PageBridge.h"
+#include "ScreenCache.h"
+#include "common/Log.h"
+#include "gui_port/gui_anim.h"
+#include "gui_port/gui_asset.h"
+#include "gui_port/gui_atlas.h"
+#include "gui_port/gui_bind.h"
+#include "gui_port/gui_bwr.h"
+#include "gui_port/gui_decode.h"
+#include "gui_port/gui_fb.h"
+#include "gui_port/gui_font.h"
+#include "gui_port/gui_font_stream.h"
+#include "gui_port/gui_img.h"
+#include "gui_port/gui_launcher.h"
+#include "gui_port/gui_overlay.h"
+#include "gui_port/gui_pack.h"
+#include "gui_port/gui_qr.h"
+#include "gui_port/gui_scroll.h"
+#include "gui_port/gui_spec.h"
+#include "gui_port/gui_txn.h"
+#include "gui_port/gui_vlist.h"
+#include "gui_port/gui_wf.h"
+#include <Arduino.h>
 
 /**
  * @file PageManager.cpp
@@ -7,41 +30,189 @@
 
 // 初始化静态成员变量
 AppBase* PageManager::currentApp = nullptr;
+PageManager::StackEntry PageManager::stack[APP_STACK_DEPTH] = {};
+uint8_t PageManager::depth = 0;
+uint32_t PageManager::switchCount = 0;
+uint32_t PageManager::switchUsMax = 0;
+int32_t PageManager::heapChurnTotal = 0;
 
 /**
- * @brief 加载新应用
- * @param newApp 新应用的实例指针
+ * @brief 记录切换起点 (时间、系统堆、LVGL 内存池)
  */
-void PageManager::loadApp(AppBase* newApp) {
-    // 安全检查
-    if (newApp == nullptr) return;
-    
-    // 防止重复加载同一个实例
-    if (currentApp == newApp) return;
+PageManager::SwitchProbe PageManager::beginSwitch() {
+    SwitchProbe p;
+    p.t0 = micros();
+    p.heapFree = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+#if LV_MEM_CUSTOM == 0
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    p.lvFree = mon.free_size;
+#else
+    p.lvFree = 0;
+#endif
+    return p;
+}
+
+/**
+ * @brief 输出本次切换的耗时与内存变化
+ * @details App 实例本身位于预分配槽位中，正常情况下 heap 变化应为 0；
+ *          lv_mem 的变化来自页面构建 (缓存未命中) 或淘汰。
+ */
+void PageManager::endSwitch(const SwitchProbe& p, app_id_t from, app_id_t to) {
+    uint32_t cost = micros() - p.t0;
+    int32_t heapDelta = (int32_t)heap_caps_get_free_size(MALLOC_CAP_DEFAULT) - (int32_t)p.heapFree;
+#if LV_MEM_CUSTOM == 0
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    int32_t lvDelta = (int32_t)mon.free_size - (int32_t)p.lvFree;
+#else
+    int32_t lvDelta = 0;
+#endif
+
+    switchCount++;
+    if (cost > switchUsMax) switchUsMax = cost;
+    heapChurnTotal += heapDelta;
 
-    // 1. 销毁旧 App (如果存在)
-    if (currentApp != nullptr) {
-        // 调用生命周期方法：停止
-        currentApp->onStop();
-        
-        // 释放内存
-        delete currentApp; 
-        currentApp = nullptr;
+    const AppDesc* f = AppRegistry::get(from);
+    const AppDesc* t = AppRegistry::get(to);
+    LOG_I("[Page] %s -> %s: %lu us, heap %+ld B, lv_mem %+ld B, depth %u",
+          f ? f->name : "-", t ? t->name : "-", cost, (long)heapDelta, (long)lvDelta, depth);
+}
+
+/**
+ * @brief 显示栈顶 App 的页面 (经页面缓存，缺失时构建)
+ */
+void PageManager::showTop() {
+    if (depth == 0) return;
+    const AppDesc* desc = AppRegistry::get(stack[depth - 1].id);
+    if (desc && desc->screen) {
+        // 墨水屏不适合切换动画，会导致大量中间帧刷新
+        ScreenCache::show(desc->screen, desc->screenInit, LV_SCR_LOAD_ANIM_NONE);
     }
+}
+
+/**
+ * @brief 构造新 App 并压入栈顶
+ * @details 调用前需确保栈未满，且原栈顶 App 已暂停。
+ */
+void PageManager::pushApp(app_id_t id) {
+    AppBase* app = AppRegistry::create(id, depth);
+    if (app == nullptr) return;
+
+    stack[depth].id = id;
+    stack[depth].app = app;
+    depth++;
 
-    // 2. 启动新 App
-    currentApp = newApp;
-    
+    showTop();
+    currentApp = app;
     // 调用生命周期方法：启动
     currentApp->onStart();
 }
 
+/**
+ * @brief 停止并析构栈顶 App
+ * @details 只析构，不释放内存；槽位留给下一次 pushApp 复用。
+ */
+void PageManager::popApp() {
+    if (depth == 0) return;
+
+    depth--;
+    AppBase* app = stack[depth].app;
+    stack[depth].app = nullptr;
+    currentApp = (depth > 0) ? stack[depth - 1].app : nullptr;
+
+    // 调用生命周期方法：停止
+    app->onStop();
+    AppRegistry::destroy(app);
+}
+
+/**
+ * @brief 启动 App 并压入返回栈
+ * @param id 目标 App
+ */
+void PageManager::startApp(app_id_t id) {
+    if (AppRegistry::get(id) == nullptr) return;
+    if (depth == 0) {
+        startRoot(id);
+        return;
+    }
+
+    app_id_t from = stack[depth - 1].id;
+    if (from == id) return;
+
+    SwitchProbe p = beginSwitch();
+
+    // 1. 目标已在栈中：直接返回到该层
+    for (uint8_t i = 0; i + 1 < depth; i++) {
+        if (stack[i].id != id) continue;
+        while (depth > i + 1) popApp();
+        showTop();
+        currentApp->onResume();
+        endSwitch(p, from, id);
+        return;
+    }
+
+    // 2. 栈满：回到根 App (根 App 保持暂停状态)
+    if (depth >= APP_STACK_DEPTH) {
+        LOG_I("[Page] Back stack full, unwinding to root");
+        while (depth > 1) popApp();
+    } else {
+        // 3. 当前 App 留在栈中，页面保留在缓存里
+        currentApp->onPause();
+    }
+
+    pushApp(id);
+    endSwitch(p, from, id);
+}
+
+/**
+ * @brief 清空返回栈并启动根 App
+ * @param id 根 App
+ */
+void PageManager::startRoot(app_id_t id) {
+    if (AppRegistry::get(id) == nullptr) return;
+
+    SwitchProbe p = beginSwitch();
+    app_id_t from = (depth > 0) ? stack[depth - 1].id : APP_ID_COUNT;
+
+    while (depth > 0) popApp();
+    pushApp(id);
+    endSwitch(p, from, id);
+}
+
+/**
+ * @brief 返回上一个 App
+ * @return false 已在根 App
+ */
+bool PageManager::back() {
+    if (depth <= 1) return false;
+
+    SwitchProbe p = beginSwitch();
+    app_id_t from = stack[depth - 1].id;
+
+    popApp();
+    showTop();
+    currentApp->onResume();
+
+    endSwitch(p, from, stack[depth - 1].id);
+    return true;
+}
+
+/**
+ * @brief 返回栈中上一个 App 的 ID
+ */
+app_id_t PageManager::previousApp() {
+    return (depth > 1) ? stack[depth - 2].id : APP_ID_COUNT;
+}
+
 /**
  * @brief 将系统事件分发给当前应用
  * @param event 系统事件
  */
 void PageManager::handleEvent(sys_event_t* event) {
     if (currentApp) {
+        // App 在 onEvent 中可能连续修改多个控件，整体作为一次事务只渲染、刷屏一次
+        GuiTxn txn("SysEvent");
         currentApp->onEvent(event);
     }
 }
@@ -54,3 +225,75 @@ void PageManager::loop() {
         currentApp->onRunningLoop();
     }
 }
+
+/**
+ * @brief 输出页面缓存统计
+ */
+void PageManager::dumpCacheStats() {
+    ScreenCache::dumpStats();
+    BindCell::dumpStats();
+    gui_anim_report();
+    gui_font_report();
+    gui_font_stream_report();
+    gui_img_report();
+    gui_asset_report();
+    gui_pack_report();
+    gui_decode_report();
+    gui_fb_report();
+    gui_bwr_report();
+    gui_overlay_report();
+    gui_qr_report();
+    gui_atlas_report();
+    gui_launcher_report();
+    gui_scroll_report();
+    gui_vlist_report();
+    gui_wf_report();
+    LOG_RAW("  app switches=%lu max=%lu us heap churn=%ld B\n",
+            switchCount, switchUsMax, (long)heapChurnTotal);
+}
+
+/* ==================================================================
+ * C 接口 (供 SquareLine 生成的 C 代码调用)
+ * ================================================================== */
+
+void page_show_screen(lv_obj_t **target, lv_scr_load_anim_t anim, uint32_t time, uint32_t delay,
+                      void (*target_init)(void)) {
+    ScreenCache::show(target, target_init, anim, time, delay);
+}
+
+bool page_acquire_screen(lv_obj_t **target, void (*target_init)(void)) {
+    return ScreenCache::acquire(target, target_init);
+}
+
+void page_register_screen(const char *name, lv_obj_t **target, void (*target_init)(void), bool prebuild) {
+    ScreenCache::registerScreen(name, target, target_init, prebuild);
+}
+
+void page_start_prebuild(void) {
+    ScreenCache::startPrebuild();
+}
+
+const char *page_screen_name(const lv_obj_t *scr) {
+    return ScreenCache::nameOf(scr);
+}
+
+void page_nav_event(lv_event_t *e, app_id_t id) {
+    const AppDesc *desc = AppRegistry::get(id);
+    if (desc == nullptr) return;
+
+    gui_spec_handle(e, desc->screen, desc->screenInit);
+    if (lv_event_get_code(e) == LV_EVENT_CLICKED) {
+        PageManager::startApp(id);
+    }
+}
+
+void page_nav_back_event(lv_event_t *e) {
+    // 已在根 App (如页面未经 PageManager 打开) 时回到主页
+    app_id_t prev = PageManager::previousApp();
+    const AppDesc *desc = AppRegistry::get(prev != APP_ID_COUNT ? prev : APP_ID_HOME);
+
+    gui_spec_handle(e, desc->screen, desc->screenInit);
+    if (lv_event_get_code(e) == LV_EVENT_CLICKED) {
+        if (!PageManager::back()) PageManager::startApp(APP_ID_HOME);
+    }
+}
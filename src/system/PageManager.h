@@ -2,11 +2,12 @@
 #define PAGE_MANAGER_H
 
 #include "AppBase.h"
+#include "AppRegistry.h"
 
 /**
  * @file PageManager.h
  * @brief 页面管理器头文件
- * @details 定义了 PageManager 类，负责管理 App 的生命周期（加载、运行、销毁）。
+ * @details 定义了 PageManager 类，负责管理 App 的生命周期（启动、暂停、恢复、销毁）和返回栈。
  */
 
 /**
@@ -15,28 +16,53 @@
  * 
  * @details
  * 类似于 Android 的 ActivityManager 或 iOS 的 UINavigationController。
- * 它维护一个当前正在运行的 App 实例指针 (`currentApp`)。
+ * 它维护一个固定深度的返回栈，栈顶即当前正在运行的 App (`currentApp`)。
  * 
  * 主要功能：
- * 1. 切换 App (`loadApp`)：自动处理旧 App 的 `onStop` 和析构，新 App 的 `onStart`。
- * 2. 事件分发 (`handleEvent`)：将系统事件路由给当前 App。
- * 3. 后台循环 (`loop`)：维持当前 App 的后台任务。
+ * 1. 启动 App (`startApp`)：当前 App `onPause` 后留在栈中，新 App 由 AppRegistry 在预分配槽位中构造并 `onStart`。
+ * 2. 返回 (`back`)：栈顶 App `onStop` 并析构，下层 App 的页面重新显示并 `onResume`。
+ * 3. 事件分发 (`handleEvent`)：将系统事件路由给当前 App。
+ * 4. 后台循环 (`loop`)：维持当前 App 的后台任务。
+ * 5. 页面缓存：App 的页面由 ScreenCache 复用和淘汰，App 自身不再创建/删除页面。
+ * 6. 统计：每次切换的耗时，以及系统堆 / LVGL 内存池的变化量 (堆抖动)。
+ *
+ * @note 全部切换操作都在 GUI 线程中执行。
  */
 class PageManager {
 public:
     /**
-     * @brief 加载并切换到新的 App
-     * @param newApp 新 App 的实例指针 (必须是 new 分配的堆内存)
-     * @note 
-     * - 此函数会自动 `delete` 当前正在运行的 App 实例，防止内存泄漏。
-     * - 调用示例: `PageManager::loadApp(new App_Home());`
+     * @brief 启动 App 并压入返回栈
+     * @param id 目标 App
+     * @details
+     * - 目标就是当前 App 时忽略。
+     * - 目标已在返回栈中时，直接返回到该层 (避免 主页->日历->主页->... 无限叠加)。
+     * - 返回栈已满时，清空到根 App 后再压入。
      */
-    static void loadApp(AppBase* newApp);
+    static void startApp(app_id_t id);
+
+    /**
+     * @brief 清空返回栈并以指定 App 作为根 App 启动
+     * @param id 根 App (通常为 APP_ID_HOME)
+     */
+    static void startRoot(app_id_t id);
+
+    /**
+     * @brief 返回上一个 App
+     * @return false 已在根 App，无法返回
+     */
+    static bool back();
+
+    /**
+     * @brief 返回栈中上一个 App 的 ID
+     * @return 上一个 App，已在根 App 时返回 APP_ID_COUNT
+     */
+    static app_id_t previousApp();
     
     /**
      * @brief 将系统事件分发给当前 App
      * @param event 指向事件结构体的指针
      * @details 如果当前有 App 在运行，调用其 `onEvent` 方法。
+     *          整个 `onEvent` 包在一个 UI 事务 (gui_txn) 中，App 对多个控件的修改只触发一次刷屏。
      */
     static void handleEvent(sys_event_t* event);
     
@@ -52,11 +78,46 @@ public:
      */
     static AppBase* getCurrentApp() { return currentApp; }
 
+    /**
+     * @brief 输出页面缓存统计 (构建/重建次数、切换耗时)
+     */
+    static void dumpCacheStats();
+
 private:
     /**
-     * @brief 当前运行的 App 实例指针
+     * @brief 返回栈中的一层
+     */
+    struct StackEntry {
+        app_id_t id;     ///< App ID
+        AppBase* app;    ///< App 实例 (位于 AppRegistry 的第 n 个槽位)
+    };
+
+    /**
+     * @brief 切换统计的起点 (由 beginSwitch 记录)
+     */
+    struct SwitchProbe {
+        uint32_t t0;        ///< 开始时间 (micros)
+        uint32_t heapFree;  ///< 系统堆空闲字节数
+        uint32_t lvFree;    ///< LVGL 内存池空闲字节数
+    };
+
+    static void pushApp(app_id_t id);
+    static void popApp();
+    static void showTop();
+    static SwitchProbe beginSwitch();
+    static void endSwitch(const SwitchProbe& p, app_id_t from, app_id_t to);
+
+    /**
+     * @brief 当前运行的 App 实例指针 (返回栈栈顶)
      */
     static AppBase* currentApp;
+
+    static StackEntry stack[APP_STACK_DEPTH];  ///< 返回栈
+    static uint8_t depth;                      ///< 返回栈当前深度
+
+    static uint32_t switchCount;    ///< 累计切换次数
+    static uint32_t switchUsMax;    ///< 最长一次切换耗时 (us)
+    static int32_t heapChurnTotal;  ///< 累计系统堆变化量 (字节，负数表示占用增加)
 };
 
 #endif
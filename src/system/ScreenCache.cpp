@@ -0,0 +1,264 @@
+#include "ScreenCache.h"
+#include "common/Log.h"
+#include "gui_port/gui_audit.h"
+#include "gui_port/gui_bind.h"
+#include "gui_port/gui_font.h"
+#include "gui_port/gui_font_stream.h"
+#include "gui_port/gui_pack.h"
+#include "gui_port/gui_style.h"
+#include <Arduino.h>
+
+/**
+ * @file ScreenCache.cpp
+ * @brief 页面缓存实现文件
+ */
+
+// 初始化静态成员变量
+ScreenCache::Entry ScreenCache::entries[SCREEN_CACHE_MAX] = {};
+uint8_t ScreenCache::budgetLvMemPct = SCREEN_CACHE_LV_MEM_PCT;
+uint32_t ScreenCache::budgetHeapMinFree = SCREEN_CACHE_HEAP_MIN_FREE;
+
+/**
+ * @brief 查找页面对应的缓存条目，不存在则登记一个新条目
+ * @return Entry* 条目指针，表满时返回 nullptr
+ */
+ScreenCache::Entry* ScreenCache::find(lv_obj_t** slot, void (*init)(void)) {
+    Entry* freeEntry = nullptr;
+    for (int i = 0; i < SCREEN_CACHE_MAX; i++) {
+        if (entries[i].slot == slot) return &entries[i];
+        if (entries[i].slot == nullptr && freeEntry == nullptr) freeEntry = &entries[i];
+    }
+
+    if (freeEntry != nullptr) {
+        *freeEntry = {};
+        freeEntry->slot = slot;
+        freeEntry->init = init;
+    }
+    return freeEntry;
+}
+
+/**
+ * @brief 构建页面并记录耗时与 LVGL 内存占用
+ * @return true 构建成功
+ */
+bool ScreenCache::build(Entry* e, lv_obj_t** slot, void (*init)(void)) {
+    if (init == nullptr) return false;
+
+    uint32_t t0 = millis();
+    init();
+    if (*slot != nullptr) {
+        const char* name = (e && e->name) ? e->name : nullptr;
+        // 内置字体换成 font 分区上的全字库流式字体 (未挂载时不变)
+        gui_font_stream_apply(*slot);
+        // 内置图片换成资源包中的同名图片 (未挂载时不变)
+        gui_pack_apply(*slot);
+        // 关闭光标闪烁、动画等会引起周期性刷屏的效果 (须在样式去重之前，新加的本地样式一并去重)
+        gui_audit_screen(*slot, name);
+        // SquareLine 逐控件设置的本地样式合并到共享样式池
+        gui_style_dedup(*slot, name);
+        // 新控件是 SquareLine 初始内容，重新写入绑定的数据
+        BindCell::onScreenBuilt(slot);
+#if GUI_FONT_BENCH
+        gui_font_bench_screen(*slot, name);
+#endif
+    }
+    uint32_t cost = millis() - t0;
+
+    if (e) {
+        e->builds++;
+        if (e->builds > 1) LOG_D("[Cache] Rebuild %s (builds=%u)", e->name ? e->name : "screen", e->builds);
+    }
+
+#if LV_MEM_CUSTOM == 0
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    LOG_D("[Cache] Build %s: %lu ms, lv_mem used %u%% (peak %lu B)",
+          (e && e->name) ? e->name : "screen", cost, mon.used_pct, (unsigned long)mon.max_used);
+#else
+    LOG_D("[Cache] Build %s: %lu ms", (e && e->name) ? e->name : "screen", cost);
+#endif
+    return *slot != nullptr;
+}
+
+/**
+ * @brief 获取页面对象 (必要时构建)
+ */
+bool ScreenCache::acquire(lv_obj_t** slot, void (*init)(void)) {
+    if (slot == nullptr) return false;
+
+    Entry* e = find(slot, init);
+    bool built = false;
+
+    if (*slot == nullptr) {
+        if (!build(e, slot, init)) return false;
+        built = true;
+    }
+
+    if (e) e->lastUsed = millis();
+    return built;
+}
+
+/**
+ * @brief 登记页面 (不构建)
+ */
+void ScreenCache::registerScreen(const char* name, lv_obj_t** slot, void (*init)(void), bool prebuild) {
+    Entry* e = find(slot, init);
+    if (e == nullptr) {
+        LOG_E("[Cache] Registry full, %s not registered", name);
+        return;
+    }
+    e->name = name;
+    e->init = init;
+    e->prebuild = prebuild;
+}
+
+/**
+ * @brief 启动后台预构建
+ */
+void ScreenCache::startPrebuild() {
+    lv_timer_create(prebuildTimerCb, SCREEN_PREBUILD_PERIOD_MS, nullptr);
+}
+
+/**
+ * @brief 后台预构建定时器回调
+ * @details 运行在 GUI 线程 (lv_timer_handler) 中，每次最多构建一个页面，
+ *          避免一次性构建全部页面造成长时间卡顿。
+ */
+void ScreenCache::prebuildTimerCb(lv_timer_t* timer) {
+    // 用户正在操作时不打扰
+    if (lv_disp_get_inactive_time(NULL) < SCREEN_PREBUILD_IDLE_MS) return;
+
+    if (overBudget()) {
+        LOG_I("[Cache] Prebuild stopped: over memory budget");
+        lv_timer_del(timer);
+        return;
+    }
+
+    // 只预构建从未构建过的页面，被淘汰的页面留到真正使用时再重建
+    for (int i = 0; i < SCREEN_CACHE_MAX; i++) {
+        Entry& e = entries[i];
+        if (e.slot == nullptr || !e.prebuild || e.builds > 0 || *e.slot != nullptr) continue;
+
+        LOG_D("[Cache] Prebuild %s", e.name ? e.name : "screen");
+        build(&e, e.slot, e.init);
+        return;
+    }
+
+    LOG_I("[Cache] Prebuild done");
+    lv_timer_del(timer);
+}
+
+/**
+ * @brief 切换到指定页面
+ */
+bool ScreenCache::show(lv_obj_t** slot, void (*init)(void), lv_scr_load_anim_t anim, uint32_t time, uint32_t delay) {
+    if (slot == nullptr) return false;
+
+    uint32_t t0 = millis();
+    lv_obj_t* oldScr = lv_scr_act();
+
+    bool built = acquire(slot, init);
+    if (*slot == nullptr) return built;
+
+    // 页面由缓存管理，旧页面不自动删除
+    if (*slot != oldScr) {
+        lv_scr_load_anim(*slot, anim, time, delay, false);
+    }
+
+    uint32_t cost = millis() - t0;
+    Entry* e = find(slot, init);
+    if (e) {
+        e->switches++;
+        e->switchMsTotal += cost;
+        if (cost > e->switchMsMax) e->switchMsMax = cost;
+    }
+    LOG_D("[Cache] Show %s: %s, %lu ms", (e && e->name) ? e->name : "screen", built ? "built" : "cached", cost);
+
+    // 切换完成后按预算清理 (当前页面受保护)
+    trim();
+    return built;
+}
+
+/**
+ * @brief 修改内存预算
+ */
+void ScreenCache::setBudget(uint8_t lv_mem_pct, uint32_t heap_min_free) {
+    budgetLvMemPct = lv_mem_pct;
+    budgetHeapMinFree = heap_min_free;
+    trim();
+}
+
+/**
+ * @brief 判断当前内存是否超出预算
+ */
+bool ScreenCache::overBudget() {
+#if LV_MEM_CUSTOM == 0
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    if (mon.used_pct > budgetLvMemPct) return true;
+#endif
+    return heap_caps_get_free_size(MALLOC_CAP_DEFAULT) < budgetHeapMinFree;
+}
+
+/**
+ * @brief 按 LRU 淘汰页面
+ */
+void ScreenCache::trim() {
+    lv_obj_t* active = lv_scr_act();
+    bool evicted = false;
+
+    while (overBudget()) {
+        // 找到最久未使用、且不在显示中的页面
+        Entry* victim = nullptr;
+        for (int i = 0; i < SCREEN_CACHE_MAX; i++) {
+            Entry& e = entries[i];
+            if (e.slot == nullptr || *e.slot == nullptr || *e.slot == active) continue;
+            if (victim == nullptr || (int32_t)(e.lastUsed - victim->lastUsed) < 0) victim = &e;
+        }
+        if (victim == nullptr) {
+            LOG_D("[Cache] Over budget but nothing to evict");
+            break;
+        }
+
+        LOG_I("[Cache] Evict %s (idle %lu ms)", victim->name ? victim->name : "screen", millis() - victim->lastUsed);
+        lv_obj_del(*victim->slot);
+        *victim->slot = nullptr;
+        evicted = true;
+    }
+
+    // 发生淘汰时输出一次统计，便于观察重建次数
+    if (evicted) dumpStats();
+}
+
+/**
+ * @brief 查询页面名称
+ */
+const char* ScreenCache::nameOf(const lv_obj_t* scr) {
+    if (scr == nullptr) return nullptr;
+    for (int i = 0; i < SCREEN_CACHE_MAX; i++) {
+        if (entries[i].slot != nullptr && *entries[i].slot == scr) return entries[i].name;
+    }
+    return nullptr;
+}
+
+/**
+ * @brief 输出缓存统计
+ */
+void ScreenCache::dumpStats() {
+    LOG_I("[Cache] Screen cache stats:");
+    for (int i = 0; i < SCREEN_CACHE_MAX; i++) {
+        const Entry& e = entries[i];
+        if (e.slot == nullptr) continue;
+        LOG_RAW("  %-16s %-6s builds=%u rebuilds=%u switches=%u avg=%lu ms max=%lu ms\n",
+                e.name ? e.name : "(unnamed)", *e.slot ? "alive" : "freed", e.builds,
+                e.builds > 0 ? e.builds - 1 : 0, e.switches,
+                e.switches ? e.switchMsTotal / e.switches : 0, e.switchMsMax);
+    }
+
+#if LV_MEM_CUSTOM == 0
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    LOG_RAW("  lv_mem: used %u%%, peak %lu B of %lu B\n", mon.used_pct,
+            (unsigned long)mon.max_used, (unsigned long)mon.total_size);
+#endif
+}
@@ -0,0 +1,150 @@
+#ifndef SCREEN_CACHE_H
+#define SCREEN_CACHE_H
+
+#include <lvgl.h>
+#include <stdint.h>
+
+/**
+ * @file ScreenCache.h
+ * @brief 页面 (LVGL screen) 缓存头文件
+ * @details 定义了 ScreenCache 类，由 PageManager 使用，
+ *          负责页面对象的复用与按内存预算的 LRU 淘汰。
+ */
+
+// ==========================================
+// 配置区域
+// ==========================================
+
+/// 最多缓存的页面数量
+#ifndef SCREEN_CACHE_MAX
+#define SCREEN_CACHE_MAX 8
+#endif
+
+/// LVGL 内存池使用率上限 (%)，超过后开始淘汰 (仅 LV_MEM_CUSTOM == 0 时有效)
+#ifndef SCREEN_CACHE_LV_MEM_PCT
+#define SCREEN_CACHE_LV_MEM_PCT 70
+#endif
+
+/// 系统堆最少保留的空闲字节数，低于此值开始淘汰
+#ifndef SCREEN_CACHE_HEAP_MIN_FREE
+#define SCREEN_CACHE_HEAP_MIN_FREE (48 * 1024)
+#endif
+
+/// 用户无操作超过该时间 (ms) 后才开始后台预构建页面
+#ifndef SCREEN_PREBUILD_IDLE_MS
+#define SCREEN_PREBUILD_IDLE_MS 2000
+#endif
+
+/// 后台预构建的检查周期 (ms)，每个周期最多构建一个页面
+#ifndef SCREEN_PREBUILD_PERIOD_MS
+#define SCREEN_PREBUILD_PERIOD_MS 200
+#endif
+
+/**
+ * @class ScreenCache
+ * @brief 页面缓存 (静态工具类)
+ *
+ * @details
+ * SquareLine 的 `_ui_screen_change` 以 `auto_del=false` 加载页面且从不删除旧页面，
+ * 页面会越积越多；而 App 在 onStop 中整页销毁又会导致每次进入都重建。
+ * ScreenCache 统一接管页面对象：
+ * 1. 页面切换 (`show`)：页面不存在时调用 screen_init 构建，否则直接复用。
+ * 2. 内存预算：切换后检查 LVGL 内存池和系统堆，超出预算则按最近最少使用 (LRU) 删除页面。
+ *    当前显示的页面永远不会被淘汰。
+ * 3. 统计：每个页面的构建次数 (首次 + 重建) 与切换耗时。
+ * 4. 页面注册表：`registerScreen` 登记全部页面但不构建，页面在首次使用时才构建；
+ *    标记为预构建的页面会在 GUI 空闲时由 LVGL 定时器逐个构建 (每个周期一个页面)。
+ *
+ * @note 被淘汰页面的全局指针 (如 ui_CalendarPage) 会被置空，
+ *       其子控件指针随之失效，下次进入时由 screen_init 重新赋值。
+ */
+class ScreenCache {
+public:
+    /**
+     * @brief 切换到指定页面
+     * @param slot 页面全局指针的地址 (如 &ui_HomePage)
+     * @param init 页面为空时调用的 screen_init 函数
+     * @param anim 切换动画 (墨水屏建议 LV_SCR_LOAD_ANIM_NONE)
+     * @param time 动画时长
+     * @param delay 动画延时
+     * @return true 本次切换触发了页面构建
+     */
+    static bool show(lv_obj_t** slot, void (*init)(void),
+                     lv_scr_load_anim_t anim = LV_SCR_LOAD_ANIM_NONE, uint32_t time = 0, uint32_t delay = 0);
+
+    /**
+     * @brief 获取页面对象 (必要时构建)，但不切换
+     * @param slot 页面全局指针的地址
+     * @param init 页面为空时调用的 screen_init 函数
+     * @return true 本次调用触发了页面构建
+     * @details 用于预渲染等需要提前拿到页面的场景，同样会刷新 LRU 时间戳。
+     */
+    static bool acquire(lv_obj_t** slot, void (*init)(void));
+
+    /**
+     * @brief 登记页面 (不构建)
+     * @param name 页面名称 (用于日志，需为常量字符串)
+     * @param slot 页面全局指针地址
+     * @param init 页面构建函数
+     * @param prebuild 是否允许在 GUI 空闲时后台预构建
+     */
+    static void registerScreen(const char* name, lv_obj_t** slot, void (*init)(void), bool prebuild);
+
+    /**
+     * @brief 启动后台预构建
+     * @details 创建一个 LVGL 定时器：用户无操作超过 SCREEN_PREBUILD_IDLE_MS 后，
+     *          每个周期构建一个尚未构建过的预构建页面；超出内存预算或全部完成后自动停止。
+     */
+    static void startPrebuild();
+
+    /**
+     * @brief 修改内存预算
+     * @param lv_mem_pct LVGL 内存池使用率上限 (%)
+     * @param heap_min_free 系统堆最少空闲字节数
+     */
+    static void setBudget(uint8_t lv_mem_pct, uint32_t heap_min_free);
+
+    /**
+     * @brief 按预算淘汰页面，直到满足预算或无可淘汰页面
+     */
+    static void trim();
+
+    /**
+     * @brief 通过串口输出缓存统计 (构建次数、切换耗时)
+     */
+    static void dumpStats();
+
+    /**
+     * @brief 查询页面名称
+     * @param scr 页面对象
+     * @return 登记时的名称，未登记时返回 nullptr
+     */
+    static const char* nameOf(const lv_obj_t* scr);
+
+private:
+    /**
+     * @brief 缓存条目
+     */
+    struct Entry {
+        const char* name;       ///< 页面名称 (未登记时为 nullptr)
+        lv_obj_t** slot;        ///< 页面全局指针地址 (nullptr 表示空闲条目)
+        void (*init)(void);     ///< 页面构建函数
+        bool prebuild;          ///< 是否参与后台预构建
+        uint32_t lastUsed;      ///< 最近使用时间 (millis)
+        uint16_t builds;        ///< 构建次数 (>1 表示发生过重建)
+        uint16_t switches;      ///< 切换次数
+        uint32_t switchMsTotal; ///< 切换总耗时 (ms)
+        uint32_t switchMsMax;   ///< 最长一次切换耗时 (ms)
+    };
+
+    static Entry* find(lv_obj_t** slot, void (*init)(void));
+    static bool overBudget();
+    static bool build(Entry* e, lv_obj_t** slot, void (*init)(void));
+    static void prebuildTimerCb(lv_timer_t* timer);
+
+    static Entry entries[SCREEN_CACHE_MAX];
+    static uint8_t budgetLvMemPct;
+    static uint32_t budgetHeapMinFree;
+};
+
+#endif
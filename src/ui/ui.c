@@ -5,6 +5,7 @@
 
 #include "ui.h"
 #include "ui_helpers.h"
+#include "system/PageBridge.h"
 
 ///////////////////// VARIABLES ////////////////////
 
@@ -20,6 +21,7 @@ void ui_event_btnTime(lv_event_t * e);
 lv_obj_t * ui_btnTime;
 void ui_event_btnSetting(lv_event_t * e);
 lv_obj_t * ui_btnSetting;
+void ui_event_btnApp(lv_event_t * e);
 lv_obj_t * ui_btnApp;
 lv_obj_t * ui_btnSecondary;
 lv_obj_t * ui_SecondaryArea;
@@ -109,80 +111,74 @@ lv_obj_t * ui____initial_actions0;
 ///////////////////// FUNCTIONS ////////////////////
 void ui_event_btnMain(lv_event_t * e)
 {
-    lv_event_code_t event_code = lv_event_get_code(e);
-
-    if(event_code == LV_EVENT_CLICKED) {
-        _ui_screen_change(&ui_CalendarPage, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_CalendarPage_screen_init);
-    }
+    page_nav_event(e, APP_ID_CALENDAR);
 }
 
 void ui_event_btnWeather(lv_event_t * e)
 {
-    lv_event_code_t event_code = lv_event_get_code(e);
-
-    if(event_code == LV_EVENT_CLICKED) {
-        _ui_screen_change(&ui_WeatherPage, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_WeatherPage_screen_init);
-    }
+    page_nav_event(e, APP_ID_WEATHER);
 }
 
 void ui_event_btnTime(lv_event_t * e)
 {
-    lv_event_code_t event_code = lv_event_get_code(e);
-
-    if(event_code == LV_EVENT_CLICKED) {
-        _ui_screen_change(&ui_CalendarPage, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_CalendarPage_screen_init);
-    }
+    page_nav_event(e, APP_ID_CALENDAR);
 }
 
 void ui_event_btnSetting(lv_event_t * e)
 {
-    lv_event_code_t event_code = lv_event_get_code(e);
+    page_nav_event(e, APP_ID_SETTING);
+}
 
-    if(event_code == LV_EVENT_CLICKED) {
-        _ui_screen_change(&ui_SettingPage, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_SettingPage_screen_init);
-    }
+void ui_event_btnApp(lv_event_t * e)
+{
+    page_nav_event(e, APP_ID_LAUNCHER);
 }
 
 void ui_event_btnHome(lv_event_t * e)
 {
-    lv_event_code_t event_code = lv_event_get_code(e);
-
-    if(event_code == LV_EVENT_CLICKED) {
-        _ui_screen_change(&ui_HomePage, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_HomePage_screen_init);
-    }
+    page_nav_back_event(e);
 }
 
 void ui_event_btnHome1(lv_event_t * e)
 {
-    lv_event_code_t event_code = lv_event_get_code(e);
-
-    if(event_code == LV_EVENT_CLICKED) {
-        _ui_screen_change(&ui_HomePage, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_HomePage_screen_init);
-    }
+    page_nav_back_event(e);
 }
 
 void ui_event_btnHome3(lv_event_t * e)
 {
-    lv_event_code_t event_code = lv_event_get_code(e);
-
-    if(event_code == LV_EVENT_CLICKED) {
-        _ui_screen_change(&ui_HomePage, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_HomePage_screen_init);
-    }
+    page_nav_back_event(e);
 }
 
 ///////////////////// SCREENS ////////////////////
 
+// 1: 按 SquareLine 原始方式在启动时构建全部页面 (仅用于对比启动耗时和内存峰值)
+#ifndef UI_EAGER_INIT
+#define UI_EAGER_INIT 0
+#endif
+
 void ui_init(void)
 {
     lv_disp_t * dispp = lv_disp_get_default();
     lv_theme_t * theme = lv_theme_default_init(dispp, lv_palette_main(LV_PALETTE_BLUE), lv_palette_main(LV_PALETTE_RED),
                                                false, LV_FONT_DEFAULT);
     lv_disp_set_theme(dispp, theme);
-    ui_HomePage_screen_init();
-    ui_CalendarPage_screen_init();
-    ui_WeatherPage_screen_init();
-    ui_SettingPage_screen_init();
-    ui_AppPage_screen_init();
+
+    // 页面注册表: 只登记，首次使用时才构建；空闲时后台逐个预构建
+    // 首页由 PageManager::startRoot 经 App 注册表的 screenInit 构建并显示 (含图标集与刷新类别标注)
+    page_register_screen("HomePage", &ui_HomePage, &ui_HomePage_screen_init, false);
+    page_register_screen("CalendarPage", &ui_CalendarPage, &ui_CalendarPage_screen_init, true);
+    page_register_screen("WeatherPage", &ui_WeatherPage, &ui_WeatherPage_screen_init, true);
+    page_register_screen("SettingPage", &ui_SettingPage, &ui_SettingPage_screen_init, true);
+    page_register_screen("AppPage", &ui_AppPage, &ui_AppPage_screen_init, false);
+
+#if UI_EAGER_INIT
+    page_acquire_screen(&ui_CalendarPage, &ui_CalendarPage_screen_init);
+    page_acquire_screen(&ui_WeatherPage, &ui_WeatherPage_screen_init);
+    page_acquire_screen(&ui_SettingPage, &ui_SettingPage_screen_init);
+    page_acquire_screen(&ui_AppPage, &ui_AppPage_screen_init);
+#else
+    page_start_prebuild();
+#endif
+
     ui____initial_actions0 = lv_obj_create(NULL);
-    lv_disp_load_scr(ui_HomePage);
 }
@@ -37,6 +37,7 @@ void ui_event_btnTime(lv_event_t * e);
 extern lv_obj_t * ui_btnTime;
 void ui_event_btnSetting(lv_event_t * e);
 extern lv_obj_t * ui_btnSetting;
+void ui_event_btnApp(lv_event_t * e);
 extern lv_obj_t * ui_btnApp;
 extern lv_obj_t * ui_btnSecondary;
 extern lv_obj_t * ui_SecondaryArea;
@@ -45,7 +45,6 @@ void ui_HomePage_screen_init(void)
     lv_obj_set_style_radius(ui_btnWeather, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_bg_color(ui_btnWeather, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_bg_opa(ui_btnWeather, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_img_src(ui_btnWeather, &ui_img_weather_png, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     ui_btnTime = lv_btn_create(ui_HomePage);
     lv_obj_set_width(ui_btnTime, lv_pct(25));
@@ -57,7 +56,6 @@ void ui_HomePage_screen_init(void)
     lv_obj_set_style_radius(ui_btnTime, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_bg_color(ui_btnTime, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_bg_opa(ui_btnTime, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_img_src(ui_btnTime, &ui_img_time_png, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_bg_color(ui_btnTime, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
     lv_obj_set_style_bg_opa(ui_btnTime, 255, LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
 
@@ -71,7 +69,6 @@ void ui_HomePage_screen_init(void)
     lv_obj_set_style_radius(ui_btnSetting, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_bg_color(ui_btnSetting, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_bg_opa(ui_btnSetting, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_img_src(ui_btnSetting, &ui_img_setting_png, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     ui_btnApp = lv_btn_create(ui_HomePage);
     lv_obj_set_width(ui_btnApp, lv_pct(25));
@@ -83,7 +80,6 @@ void ui_HomePage_screen_init(void)
     lv_obj_set_style_radius(ui_btnApp, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_bg_color(ui_btnApp, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_bg_opa(ui_btnApp, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_img_src(ui_btnApp, &ui_img_qr_png, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     ui_btnSecondary = lv_btn_create(ui_HomePage);
     lv_obj_set_width(ui_btnSecondary, lv_pct(100));
@@ -117,6 +113,8 @@ void ui_HomePage_screen_init(void)
     lv_obj_add_event_cb(ui_btnWeather, ui_event_btnWeather, LV_EVENT_ALL, NULL);
     lv_obj_add_event_cb(ui_btnTime, ui_event_btnTime, LV_EVENT_ALL, NULL);
     lv_obj_add_event_cb(ui_btnSetting, ui_event_btnSetting, LV_EVENT_ALL, NULL);
+    lv_obj_add_event_cb(ui_btnApp, ui_event_btnApp, LV_EVENT_ALL, NULL);
+    // 导航按钮的图标由 ui_icon_atlas 绘制 (App_Home::screenInit)，不再引用单独的图片
     uic_HomePage = ui_HomePage;
     uic_btnWordbook = ui_btnMain;
     uic_MainArea = ui_MainArea;
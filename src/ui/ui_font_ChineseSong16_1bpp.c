@@ -0,0 +1,1660 @@
+/*******************************************************************************
+ * Size: 16 px
+ * Bpp: 1 (converted by tools/font_1bpp.py, threshold 8/15, stem-min 4/15)
+ * Opts: --bpp 4 --size 16 --font C:/Users/15250/SquareLine/assets/文鼎PL简报宋.ttf -o C:/Users/15250/SquareLine/assets\ui_font_ChineseSong16.c --format lvgl -r 0x20-0x7f --symbols 今天是星期一二三四五六七八九十天气晴阴多云福州放置（）…，；放弃遗能力才够有的在船飞机公共汽车火等上关于大约面超过国外℃中建到缺席不场绝对完全吸收引抽象摘要荒缪唐丰富充裕滥用虐待学术院研究加速促进口音腔调接受承认通道入近事故意外住处膳宿陪伴同成实现一致符合账户描述积累聚准确性精指控责使习惯 --no-compress --no-prefilter
+ ******************************************************************************/
+
+#include "ui.h"
+
+#ifndef UI_FONT_CHINESESONG16_1BPP
+#define UI_FONT_CHINESESONG16_1BPP 0
+#endif
+
+#if UI_FONT_CHINESESONG16_1BPP
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0x59, 0x24, 0x90, 0x8,
+
+    /* U+0022 "\"" */
+    0xd5, 0x50,
+
+    /* U+0023 "#" */
+    0x11, 0x0, 0x2, 0x22, 0xff, 0x22, 0x0, 0x4,
+    0xff, 0x44, 0x44, 0x0, 0x8,
+
+    /* U+0024 "$" */
+    0x0, 0x3c, 0x42, 0xc2, 0x40, 0x30, 0xc, 0x2,
+    0xc1, 0x82, 0x3c, 0x0,
+
+    /* U+0025 "%" */
+    0x72, 0x88, 0x54, 0x60, 0x0, 0x4, 0xa, 0x31,
+    0x4a, 0xe,
+
+    /* U+0026 "&" */
+    0x18, 0x12, 0xa, 0x6, 0x2, 0x72, 0x92, 0x49,
+    0x10, 0x4c, 0x39, 0x80,
+
+    /* U+0027 "'" */
+    0x35, 0x0,
+
+    /* U+0028 "(" */
+    0x0, 0x88, 0x84, 0x42, 0x10, 0x84, 0x10, 0x82,
+    0x10, 0x40,
+
+    /* U+0029 ")" */
+    0x2, 0x8, 0x21, 0x4, 0x21, 0x8, 0x44, 0x22,
+    0x11, 0x0,
+
+    /* U+002A "*" */
+    0x23, 0x33, 0x33, 0x20,
+
+    /* U+002B "+" */
+    0x0, 0x10, 0x10, 0xff, 0x10, 0x10, 0x10, 0x0,
+
+    /* U+002C "," */
+    0x27, 0x24,
+
+    /* U+002D "-" */
+    0xff,
+
+    /* U+002E "." */
+    0x3c,
+
+    /* U+002F "/" */
+    0x1, 0x2, 0x2, 0x4, 0x4, 0x8, 0x8, 0x10,
+    0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80,
+
+    /* U+0030 "0" */
+    0x18, 0x24, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x24, 0x18,
+
+    /* U+0031 "1" */
+    0x70, 0x41, 0x4, 0x10, 0x41, 0x4, 0x11, 0xe0,
+
+    /* U+0032 "2" */
+    0x3c, 0x42, 0x42, 0x2, 0x4, 0x8, 0x10, 0x20,
+    0x42, 0x7e,
+
+    /* U+0033 "3" */
+    0x3c, 0x42, 0x42, 0x4, 0x1c, 0x2, 0x2, 0x42,
+    0x42, 0x3c,
+
+    /* U+0034 "4" */
+    0x4, 0xc, 0x14, 0x14, 0x24, 0x44, 0x44, 0xff,
+    0x4, 0xe,
+
+    /* U+0035 "5" */
+    0x7e, 0x0, 0x0, 0x0, 0x7c, 0x2, 0x2, 0x2,
+    0x42, 0x3c,
+
+    /* U+0036 "6" */
+    0x1c, 0x22, 0x40, 0x5c, 0x62, 0x42, 0x42, 0x42,
+    0x42, 0x3c,
+
+    /* U+0037 "7" */
+    0x3e, 0x42, 0x44, 0x4, 0x8, 0x8, 0x10, 0x10,
+    0x10, 0x10,
+
+    /* U+0038 "8" */
+    0x3c, 0x42, 0x42, 0x44, 0x38, 0x2c, 0x42, 0xc3,
+    0x42, 0x3c,
+
+    /* U+0039 "9" */
+    0x3c, 0x42, 0x42, 0xc2, 0x42, 0x46, 0x3a, 0x2,
+    0x44, 0x38,
+
+    /* U+003A ":" */
+    0x1b, 0x1, 0xb0,
+
+    /* U+003B ";" */
+    0x26, 0x0, 0x27, 0x24,
+
+    /* U+003C "<" */
+    0x0, 0x7, 0x38, 0xc0, 0x20, 0x1c, 0x3, 0x0,
+
+    /* U+003D "=" */
+    0xff, 0x0, 0x0, 0xff,
+
+    /* U+003E ">" */
+    0x0, 0x60, 0x1c, 0x3, 0xc, 0x30, 0xc0, 0x0,
+
+    /* U+003F "?" */
+    0x7a, 0x1c, 0x42, 0x8, 0x40, 0x0, 0x20, 0xc0,
+
+    /* U+0040 "@" */
+    0x3c, 0x42, 0x9d, 0xa5, 0xa5, 0xa5, 0xa6, 0x5c,
+    0x30,
+
+    /* U+0041 "A" */
+    0x8, 0x18, 0x8, 0x28, 0x24, 0x24, 0x1c, 0x42,
+    0x42, 0xc3,
+
+    /* U+0042 "B" */
+    0x7c, 0x42, 0x42, 0x44, 0x78, 0x42, 0x41, 0x41,
+    0x42, 0x7c,
+
+    /* U+0043 "C" */
+    0x1e, 0x23, 0x40, 0x40, 0xc0, 0x40, 0x40, 0x40,
+    0x22, 0x1c,
+
+    /* U+0044 "D" */
+    0x7c, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x42,
+    0x42, 0x7c,
+
+    /* U+0045 "E" */
+    0x7e, 0x41, 0x40, 0x44, 0x3c, 0x44, 0x40, 0x40,
+    0x42, 0x7e,
+
+    /* U+0046 "F" */
+    0x7e, 0x21, 0x20, 0x22, 0x3c, 0x22, 0x20, 0x20,
+    0x20, 0x60,
+
+    /* U+0047 "G" */
+    0x1c, 0x22, 0x42, 0x80, 0x80, 0x86, 0x82, 0x42,
+    0x62, 0x1c,
+
+    /* U+0048 "H" */
+    0x66, 0x42, 0x42, 0x42, 0x7e, 0x42, 0x42, 0x42,
+    0x42, 0x66,
+
+    /* U+0049 "I" */
+    0x78, 0x82, 0x8, 0x20, 0x82, 0x8, 0x21, 0xe0,
+
+    /* U+004A "J" */
+    0xe, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x84,
+    0x44, 0x38,
+
+    /* U+004B "K" */
+    0x66, 0x44, 0x48, 0x50, 0x60, 0x60, 0x50, 0x48,
+    0x44, 0x66,
+
+    /* U+004C "L" */
+    0x60, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x42, 0x7e,
+
+    /* U+004D "M" */
+    0xc3, 0x46, 0x42, 0x22, 0x2a, 0x2a, 0x52, 0x52,
+    0x52, 0xc7,
+
+    /* U+004E "N" */
+    0x46, 0x22, 0x22, 0x52, 0x52, 0x4a, 0x48, 0x44,
+    0x42, 0x62,
+
+    /* U+004F "O" */
+    0x1c, 0x22, 0x42, 0x42, 0x81, 0x81, 0x42, 0x42,
+    0x42, 0x3c,
+
+    /* U+0050 "P" */
+    0x7e, 0x41, 0x41, 0x42, 0x3c, 0x40, 0x40, 0x40,
+    0x40, 0x60,
+
+    /* U+0051 "Q" */
+    0x38, 0x44, 0x42, 0x82, 0x83, 0x82, 0x92, 0x4a,
+    0x64, 0x34, 0x7,
+
+    /* U+0052 "R" */
+    0xfc, 0x42, 0x42, 0x46, 0x78, 0x48, 0x48, 0x44,
+    0x44, 0x63,
+
+    /* U+0053 "S" */
+    0x3c, 0x42, 0x40, 0x60, 0x18, 0x6, 0x2, 0xc1,
+    0x42, 0x3c,
+
+    /* U+0054 "T" */
+    0x7e, 0x91, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x3c,
+
+    /* U+0055 "U" */
+    0x62, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x22, 0x1c,
+
+    /* U+0056 "V" */
+    0xe3, 0x42, 0x22, 0x20, 0x24, 0x24, 0x10, 0x18,
+    0x10, 0x10,
+
+    /* U+0057 "W" */
+    0xd9, 0x48, 0x4a, 0x5a, 0x20, 0x24, 0x24, 0x24,
+    0x24, 0x24,
+
+    /* U+0058 "X" */
+    0x62, 0x24, 0x24, 0x10, 0x10, 0x18, 0x8, 0x24,
+    0x24, 0x46,
+
+    /* U+0059 "Y" */
+    0xe3, 0x42, 0x24, 0x24, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x3c,
+
+    /* U+005A "Z" */
+    0x7e, 0x84, 0x4, 0x8, 0x10, 0x10, 0x20, 0x20,
+    0x42, 0xfe,
+
+    /* U+005B "[" */
+    0x72, 0x10, 0x84, 0x21, 0x8, 0x42, 0x10, 0x84,
+    0x21, 0xc0,
+
+    /* U+005C "\\" */
+    0x80, 0x80, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10,
+    0x8, 0x8, 0x4, 0x4, 0x2, 0x2, 0x1,
+
+    /* U+005D "]" */
+    0x70, 0x84, 0x21, 0x8, 0x42, 0x10, 0x84, 0x21,
+    0x9, 0xc0,
+
+    /* U+005E "^" */
+    0x21, 0xe8, 0x40,
+
+    /* U+005F "_" */
+    0xff,
+
+    /* U+0060 "`" */
+    0x8c, 0x21,
+
+    /* U+0061 "a" */
+    0x38, 0x44, 0x4, 0x3c, 0x44, 0xc4, 0x7a,
+
+    /* U+0062 "b" */
+    0x40, 0x40, 0x40, 0x1c, 0x22, 0x42, 0x43, 0x42,
+    0x42, 0x3c,
+
+    /* U+0063 "c" */
+    0x3c, 0x42, 0x40, 0x40, 0x40, 0x62, 0x1c,
+
+    /* U+0064 "d" */
+    0x6, 0x2, 0x2, 0x3e, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x3e,
+
+    /* U+0065 "e" */
+    0x3c, 0x42, 0x42, 0x7e, 0x40, 0x42, 0x3c,
+
+    /* U+0066 "f" */
+    0xe, 0x12, 0x10, 0x7c, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x78,
+
+    /* U+0067 "g" */
+    0x3e, 0x44, 0x44, 0x64, 0x30, 0x7c, 0x42, 0x42,
+    0x7c,
+
+    /* U+0068 "h" */
+    0x40, 0x40, 0x40, 0x1c, 0x22, 0x42, 0x42, 0x42,
+    0x42, 0x66,
+
+    /* U+0069 "i" */
+    0x30, 0x0, 0x8, 0x60, 0x82, 0x8, 0x21, 0xe0,
+
+    /* U+006A "j" */
+    0x6, 0x0, 0x0, 0x10, 0xe0, 0x40, 0x81, 0x43,
+    0x85, 0x11, 0xe0,
+
+    /* U+006B "k" */
+    0xc0, 0x40, 0x40, 0x44, 0x48, 0x40, 0x30, 0x48,
+    0x44, 0x67,
+
+    /* U+006C "l" */
+    0x11, 0x82, 0x8, 0x20, 0x82, 0x8, 0x21, 0xf0,
+
+    /* U+006D "m" */
+    0x76, 0xca, 0x52, 0x52, 0x52, 0x52, 0xdb,
+
+    /* U+006E "n" */
+    0x5c, 0x62, 0x42, 0x42, 0x42, 0x42, 0x66,
+
+    /* U+006F "o" */
+    0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c,
+
+    /* U+0070 "p" */
+    0x7c, 0x22, 0x22, 0x21, 0x22, 0x22, 0x3c, 0x20,
+    0x70,
+
+    /* U+0071 "q" */
+    0x3c, 0x44, 0x44, 0x84, 0x44, 0x44, 0x3c, 0x4,
+    0xe,
+
+    /* U+0072 "r" */
+    0x6c, 0x64, 0x81, 0x2, 0x4, 0x1c, 0x0,
+
+    /* U+0073 "s" */
+    0x3c, 0x42, 0x20, 0x1c, 0x2, 0x42, 0x3c,
+
+    /* U+0074 "t" */
+    0x0, 0x10, 0x30, 0x5e, 0x10, 0x10, 0x10, 0x10,
+    0x12, 0x1c,
+
+    /* U+0075 "u" */
+    0x46, 0x22, 0x22, 0x22, 0x22, 0x26, 0x3a,
+
+    /* U+0076 "v" */
+    0x62, 0x20, 0x24, 0x24, 0x10, 0x18, 0x8,
+
+    /* U+0077 "w" */
+    0xd9, 0x4a, 0x4a, 0x5a, 0x20, 0x24, 0x24,
+
+    /* U+0078 "x" */
+    0x62, 0x20, 0x10, 0x8, 0x8, 0x24, 0x46,
+
+    /* U+0079 "y" */
+    0x62, 0x22, 0x24, 0x14, 0x14, 0x8, 0x8, 0x20,
+    0x30,
+
+    /* U+007A "z" */
+    0xea, 0x21, 0x8, 0x21, 0xf, 0xc0,
+
+    /* U+007B "{" */
+    0x8, 0x41, 0x8, 0x20, 0x82, 0x10, 0x20, 0x82,
+    0x8, 0x20, 0x81, 0x80,
+
+    /* U+007C "|" */
+    0x3a, 0xaa, 0xaa, 0xa8,
+
+    /* U+007D "}" */
+    0x40, 0x81, 0x4, 0x10, 0x41, 0x3, 0x10, 0x41,
+    0x4, 0x10, 0x46, 0x0,
+
+    /* U+007E "~" */
+    0x0, 0x32, 0x4c,
+
+    /* U+2026 "…" */
+    0x80, 0x1c, 0x63,
+
+    /* U+2103 "℃" */
+    0x0, 0x1, 0x83, 0x9, 0x11, 0x98, 0x82, 0x4,
+    0x0, 0x10, 0x0, 0x40, 0x1, 0x0, 0x4, 0x0,
+    0x10, 0x0, 0x20, 0x40, 0xc2, 0x0, 0xf0, 0x0,
+    0x0,
+
+    /* U+4E00 "一" */
+    0x0, 0x0, 0x7f, 0xfe,
+
+    /* U+4E03 "七" */
+    0x0, 0x0, 0x2, 0x0, 0x4, 0x0, 0x8, 0x0,
+    0x10, 0x60, 0x27, 0x0, 0xf0, 0x1e, 0x80, 0x41,
+    0x0, 0x2, 0x0, 0x4, 0x0, 0x8, 0x10, 0x10,
+    0x20, 0x3f, 0x80, 0x0, 0x0,
+
+    /* U+4E09 "三" */
+    0x0, 0x8, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xff,
+    0xe0, 0x0, 0x0,
+
+    /* U+4E0A "上" */
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0xfc, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x2, 0x7e, 0xfc,
+
+    /* U+4E0D "不" */
+    0x0, 0x0, 0x7f, 0x7e, 0x0, 0x80, 0x1, 0x0,
+    0x1, 0x0, 0x3, 0x80, 0x5, 0x20, 0x9, 0x10,
+    0x19, 0xc, 0x21, 0x6, 0x41, 0x2, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0,
+
+    /* U+4E2D "中" */
+    0x0, 0x0, 0x60, 0x4, 0x0, 0x42, 0xff, 0xf8,
+    0x42, 0x84, 0x28, 0x42, 0xff, 0xe8, 0x42, 0x4,
+    0x0, 0x40, 0x4, 0x0, 0x40, 0x4, 0x0, 0x0,
+
+    /* U+4E30 "丰" */
+    0x0, 0x0, 0x3, 0x0, 0x4, 0x21, 0xff, 0xe0,
+    0x10, 0x0, 0x20, 0x0, 0x44, 0x1f, 0xf4, 0x1,
+    0x0, 0x2, 0x9, 0xff, 0xf8, 0x8, 0x0, 0x10,
+    0x0, 0x20, 0x0, 0x40, 0x0, 0x0,
+
+    /* U+4E5D "九" */
+    0x4, 0x0, 0x8, 0x0, 0x10, 0x0, 0x20, 0xf,
+    0xfc, 0x0, 0x88, 0x1, 0x10, 0x2, 0x20, 0x8,
+    0x40, 0x10, 0x80, 0x21, 0x0, 0x82, 0x1, 0x4,
+    0x44, 0x8, 0xb0, 0x1f, 0x0, 0x0,
+
+    /* U+4E60 "习" */
+    0x0, 0x13, 0xff, 0xc0, 0x4, 0x20, 0x20, 0x81,
+    0x3, 0x8, 0x0, 0x40, 0x32, 0x6, 0x11, 0xc0,
+    0x90, 0x4, 0x0, 0x20, 0x1, 0x0, 0x70, 0x0,
+    0x0,
+
+    /* U+4E8B "事" */
+    0x1, 0x0, 0x2, 0x9, 0xff, 0xa0, 0x8, 0x81,
+    0xff, 0x82, 0x22, 0x7, 0xfc, 0x18, 0x8c, 0x1,
+    0x11, 0xff, 0xfc, 0x4, 0x41, 0xff, 0x80, 0x11,
+    0x0, 0x20, 0x0, 0xc0, 0x0,
+
+    /* U+4E8C "二" */
+    0x0, 0x8, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7f, 0xfc,
+
+    /* U+4E8E "于" */
+    0x0, 0x8, 0x3f, 0xfc, 0x0, 0x80, 0x0, 0x80,
+    0x0, 0x82, 0x7f, 0xfe, 0x0, 0x80, 0x0, 0x80,
+    0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80,
+    0x0, 0x80, 0x3, 0x0, 0x0, 0x0,
+
+    /* U+4E91 "云" */
+    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7e, 0xfe, 0x1, 0x0, 0x1, 0x0,
+    0x2, 0x0, 0x4, 0x20, 0x4, 0x10, 0x8, 0x8,
+    0x1f, 0xf8, 0x10, 0x4, 0x0, 0x0,
+
+    /* U+4E94 "五" */
+    0x0, 0x0, 0x0, 0x8, 0x3f, 0xf4, 0x1, 0x0,
+    0x1, 0x0, 0x2, 0x0, 0x2, 0x10, 0x1f, 0xf8,
+    0x2, 0x10, 0x2, 0x10, 0x2, 0x10, 0x2, 0x10,
+    0x2, 0x10, 0x4, 0x14, 0x79, 0xea,
+
+    /* U+4ECA "今" */
+    0x0, 0x0, 0x1, 0x80, 0x1, 0x0, 0x2, 0x40,
+    0x4, 0x20, 0x8, 0x10, 0x11, 0xc, 0x20, 0x82,
+    0x40, 0x80, 0x1f, 0x70, 0x0, 0x20, 0x0, 0x20,
+    0x0, 0x40, 0x0, 0x40, 0x0, 0x80, 0x0, 0x0,
+
+    /* U+4F34 "伴" */
+    0x0, 0x0, 0x8, 0x40, 0x8, 0x44, 0x12, 0x44,
+    0x11, 0x48, 0x31, 0x50, 0x16, 0xec, 0x50, 0x40,
+    0x10, 0x40, 0x1f, 0xfe, 0x10, 0x40, 0x10, 0x40,
+    0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x0, 0x0,
+
+    /* U+4F4F "住" */
+    0x0, 0x0, 0xc, 0x80, 0x8, 0x60, 0x10, 0x44,
+    0x17, 0xfe, 0x30, 0x40, 0x10, 0x40, 0x50, 0x40,
+    0x10, 0x48, 0x13, 0xf4, 0x10, 0x40, 0x10, 0x40,
+    0x10, 0x40, 0x10, 0x44, 0x17, 0xba, 0x0, 0x0,
+
+    /* U+4F7F "使" */
+    0x0, 0x0, 0x8, 0x20, 0x8, 0x22, 0x17, 0xf8,
+    0x10, 0x24, 0x33, 0xfc, 0x52, 0x24, 0x52, 0x24,
+    0x13, 0xfc, 0x12, 0x20, 0x10, 0x40, 0x10, 0x40,
+    0x10, 0xc0, 0x11, 0x30, 0x16, 0xe, 0x0, 0x0,
+
+    /* U+4FC3 "促" */
+    0x8, 0x0, 0x9, 0xfc, 0x9, 0x8, 0x11, 0x8,
+    0x11, 0x8, 0x31, 0x8, 0x11, 0xf8, 0x50, 0x20,
+    0x11, 0x24, 0x11, 0x3e, 0x11, 0x20, 0x13, 0x20,
+    0x12, 0xa0, 0x14, 0x60, 0x14, 0x3e, 0x0, 0x0,
+
+    /* U+5145 "充" */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x84, 0x7f, 0x3a,
+    0x2, 0x40, 0x4, 0x10, 0x8, 0x98, 0x1f, 0x4c,
+    0x2, 0x40, 0x2, 0x40, 0x4, 0x40, 0x4, 0x40,
+    0x4, 0x42, 0x8, 0x42, 0x30, 0x7e, 0x0, 0x0,
+
+    /* U+5165 "入" */
+    0xe, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x80, 0x2, 0x0, 0x2, 0x40, 0x4, 0x40,
+    0x4, 0x20, 0x8, 0x10, 0x10, 0x10, 0x20, 0xc,
+    0x40, 0x6, 0x0, 0x0,
+
+    /* U+5168 "全" */
+    0x0, 0x80, 0x1, 0x80, 0x1, 0x40, 0x2, 0x20,
+    0x4, 0x20, 0x8, 0x18, 0x17, 0x76, 0x20, 0x82,
+    0x0, 0x80, 0x0, 0x88, 0xf, 0xf8, 0x0, 0x80,
+    0x0, 0x80, 0x0, 0x80, 0x3f, 0xfe, 0x0, 0x0,
+
+    /* U+516B "八" */
+    0x0, 0x0, 0x0, 0x40, 0x4, 0x40, 0x6, 0x40,
+    0x4, 0x40, 0x4, 0x0, 0x4, 0x20, 0x8, 0x20,
+    0x8, 0x20, 0x8, 0x20, 0x8, 0x10, 0x10, 0x10,
+    0x20, 0x8, 0x20, 0x4, 0x40, 0x6, 0x0, 0x0,
+
+    /* U+516C "公" */
+    0x0, 0x0, 0x0, 0x40, 0x6, 0x40, 0x4, 0x40,
+    0x8, 0x20, 0x8, 0x20, 0x11, 0x90, 0x21, 0x8,
+    0x42, 0x6, 0x2, 0x0, 0x4, 0x40, 0x4, 0x20,
+    0x8, 0x10, 0x1f, 0xf8, 0x10, 0x8, 0x0, 0x0,
+
+    /* U+516D "六" */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x80, 0x0, 0x80,
+    0x7f, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
+    0x4, 0x20, 0x4, 0x10, 0x8, 0x8, 0x10, 0x8,
+    0x10, 0x4, 0x20, 0x6, 0x40, 0x0,
+
+    /* U+5171 "共" */
+    0x4, 0x20, 0x4, 0x20, 0x4, 0x24, 0x3f, 0xfc,
+    0x4, 0x20, 0x4, 0x20, 0x4, 0x20, 0x4, 0x20,
+    0x7f, 0xfe, 0x0, 0x0, 0x6, 0x30, 0x8, 0x8,
+    0x10, 0x4, 0x60, 0x4, 0x0, 0x0,
+
+    /* U+5173 "关" */
+    0x0, 0x20, 0x4, 0x20, 0x2, 0x40, 0x2, 0x48,
+    0x3d, 0xfc, 0x1, 0x0, 0x1, 0x0, 0x1, 0x4,
+    0x7f, 0xfa, 0x1, 0x0, 0x1, 0x40, 0x2, 0x40,
+    0x4, 0x20, 0x8, 0x18, 0x30, 0x6, 0x0, 0x0,
+
+    /* U+51C6 "准" */
+    0x1, 0x41, 0x2, 0x41, 0x8, 0x81, 0x17, 0xe1,
+    0x22, 0x2, 0xc4, 0xa, 0xff, 0x15, 0x10, 0x42,
+    0x21, 0x84, 0x51, 0xf, 0xd2, 0x11, 0x4, 0x22,
+    0x48, 0x7f, 0xc0, 0x80, 0x0, 0x0,
+
+    /* U+5230 "到" */
+    0x0, 0x4, 0xef, 0x8, 0x20, 0x90, 0x81, 0x21,
+    0x22, 0x44, 0xa4, 0x9e, 0x69, 0x4, 0x12, 0x9,
+    0x24, 0xff, 0x48, 0x20, 0x90, 0x41, 0x20, 0xb8,
+    0x4f, 0x80, 0x90, 0x3, 0x0, 0x0,
+
+    /* U+529B "力" */
+    0x1, 0x0, 0x3, 0x0, 0x4, 0x0, 0x8, 0x3,
+    0xff, 0xc0, 0x20, 0x80, 0x41, 0x0, 0x84, 0x2,
+    0x8, 0x4, 0x10, 0x8, 0x20, 0x20, 0x40, 0x80,
+    0x82, 0x1, 0x18, 0xc, 0x0, 0x0,
+
+    /* U+52A0 "加" */
+    0x0, 0x0, 0x30, 0x0, 0x40, 0x0, 0x91, 0xe7,
+    0xf4, 0x42, 0x48, 0x84, 0x91, 0x9, 0x22, 0x12,
+    0x44, 0x24, 0x88, 0x49, 0x11, 0x12, 0x22, 0x27,
+    0xc9, 0x88, 0x90, 0x11, 0x0, 0x0,
+
+    /* U+5341 "十" */
+    0x0, 0x0, 0x3, 0x0, 0x4, 0x0, 0x8, 0x0,
+    0x10, 0x0, 0x20, 0x9f, 0xff, 0x80, 0x80, 0x1,
+    0x0, 0x2, 0x0, 0x4, 0x0, 0x8, 0x0, 0x10,
+    0x0, 0x20, 0x0, 0x40, 0x0, 0x0,
+
+    /* U+53D7 "受" */
+    0x0, 0x18, 0x3e, 0xe0, 0x1, 0x10, 0x8, 0x90,
+    0x4, 0xa0, 0x24, 0x22, 0x3b, 0xde, 0x40, 0x4,
+    0x5f, 0xf0, 0x4, 0x20, 0x2, 0x40, 0x0, 0x80,
+    0x1, 0x80, 0x6, 0x60, 0x38, 0x1e, 0x40, 0x0,
+
+    /* U+53E3 "口" */
+    0x0, 0x7, 0xfe, 0x40, 0x24, 0x2, 0x40, 0x24,
+    0x2, 0x40, 0x24, 0x2, 0x40, 0x24, 0x2, 0x7f,
+    0xe4, 0x2, 0x0, 0x0,
+
+    /* U+5408 "合" */
+    0x0, 0x0, 0x1, 0x80, 0x2, 0x0, 0x2, 0x40,
+    0x4, 0x20, 0x8, 0x10, 0x10, 0x2c, 0x2f, 0xf6,
+    0x40, 0x0, 0x0, 0x10, 0xf, 0xf0, 0x8, 0x10,
+    0x8, 0x10, 0xf, 0xf0, 0x8, 0x10, 0x0, 0x0,
+
+    /* U+540C "同" */
+    0x0, 0x1, 0xff, 0xf4, 0x0, 0x90, 0xa, 0x5f,
+    0xe9, 0x0, 0x24, 0x4, 0x93, 0xf2, 0x48, 0x49,
+    0x21, 0x24, 0xfc, 0x92, 0x12, 0x40, 0x9, 0x0,
+    0x24, 0x3, 0x80, 0x0,
+
+    /* U+5438 "吸" */
+    0x0, 0x0, 0xb, 0xf3, 0xc8, 0x44, 0x90, 0x89,
+    0x22, 0x12, 0x45, 0x24, 0xdf, 0x49, 0x84, 0x92,
+    0x11, 0xe5, 0x22, 0x50, 0x44, 0x23, 0x0, 0x86,
+    0x2, 0x12, 0x8, 0xc3, 0x0, 0x0,
+
+    /* U+5510 "唐" */
+    0x0, 0x80, 0x0, 0x42, 0x1f, 0xfe, 0x10, 0x40,
+    0x17, 0xf8, 0x10, 0x48, 0x1f, 0xfe, 0x10, 0x48,
+    0x17, 0xf8, 0x10, 0x48, 0x10, 0x48, 0x27, 0xbc,
+    0x24, 0x8, 0x27, 0xf8, 0x44, 0x8, 0x0, 0x0,
+
+    /* U+56DB "四" */
+    0x0, 0x9, 0xff, 0xe4, 0x48, 0x91, 0x22, 0x44,
+    0x89, 0x12, 0x24, 0x48, 0x92, 0x22, 0x48, 0xf9,
+    0x40, 0x26, 0x0, 0x97, 0xfe, 0x40, 0x9, 0x0,
+    0x20,
+
+    /* U+56FD "国" */
+    0x0, 0x1, 0xff, 0xe4, 0x0, 0x90, 0xa, 0x5f,
+    0xc9, 0x8, 0x24, 0x20, 0x97, 0xfa, 0x42, 0x9,
+    0xa, 0x24, 0x24, 0x9f, 0xee, 0x40, 0x9, 0xff,
+    0xe4, 0x0, 0x80, 0x0,
+
+    /* U+5728 "在" */
+    0x1, 0x0, 0x1, 0x0, 0x2, 0x4, 0x7b, 0xbe,
+    0x4, 0x40, 0x4, 0x40, 0x8, 0x40, 0x10, 0x40,
+    0x17, 0xfc, 0x70, 0x40, 0x90, 0x40, 0x10, 0x40,
+    0x10, 0x40, 0x10, 0x44, 0x17, 0xfe, 0x0, 0x0,
+
+    /* U+573A "场" */
+    0x0, 0x0, 0x13, 0xf8, 0x10, 0x20, 0x10, 0x20,
+    0x7e, 0x40, 0x10, 0x80, 0x11, 0xfe, 0x10, 0x42,
+    0x10, 0x92, 0x1c, 0x94, 0x11, 0x24, 0x66, 0x44,
+    0x0, 0x84, 0x3, 0x4, 0x4, 0x18, 0x0, 0x0,
+
+    /* U+5904 "处" */
+    0x0, 0x0, 0x8, 0x20, 0x8, 0x20, 0x10, 0x20,
+    0x1f, 0xa0, 0x11, 0x38, 0x22, 0x24, 0x12, 0x22,
+    0x52, 0x22, 0x8, 0x20, 0xc, 0x20, 0xc, 0x20,
+    0x12, 0x20, 0x21, 0xc0, 0x40, 0x3e, 0x0, 0x0,
+
+    /* U+5916 "外" */
+    0x0, 0x0, 0x10, 0x40, 0x20, 0x80, 0x89, 0x1,
+    0xfa, 0x4, 0x24, 0x8, 0x8e, 0x25, 0x12, 0x4a,
+    0x22, 0x8, 0x40, 0x20, 0x80, 0x41, 0x1, 0x2,
+    0x4, 0x4, 0x10, 0x8, 0x0, 0x0,
+
+    /* U+591A "多" */
+    0x2, 0x0, 0x8, 0x0, 0x7d, 0x83, 0x4, 0x32,
+    0x61, 0xa, 0x0, 0x20, 0x7, 0x40, 0x62, 0x8,
+    0x1b, 0xf0, 0x81, 0xc, 0x88, 0x42, 0xc0, 0xc,
+    0x3, 0xc0, 0x30, 0x0,
+
+    /* U+591F "够" */
+    0x0, 0x0, 0x10, 0x20, 0x22, 0x3e, 0x3f, 0x44,
+    0x42, 0xa8, 0x3a, 0x8, 0x2a, 0x10, 0x2a, 0xf0,
+    0x2a, 0x3e, 0x2a, 0x24, 0x3a, 0x44, 0x2a, 0xa8,
+    0x2, 0x8, 0x2, 0x30, 0xc, 0xc0, 0x1, 0x0,
+
+    /* U+5927 "大" */
+    0x0, 0x0, 0x1, 0x80, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x4, 0x7f, 0xfa, 0x1, 0x0, 0x1, 0x0,
+    0x2, 0x0, 0x2, 0x40, 0x2, 0x40, 0x4, 0x20,
+    0x8, 0x10, 0x10, 0x8, 0x60, 0x6, 0x0, 0x0,
+
+    /* U+5929 "天" */
+    0x0, 0x0, 0x0, 0x8, 0x3f, 0xf4, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x4, 0x7f, 0xfe, 0x1, 0x0,
+    0x2, 0x40, 0x2, 0x40, 0x2, 0x40, 0x4, 0x20,
+    0x8, 0x10, 0x10, 0x8, 0x60, 0x6, 0x0, 0x0,
+
+    /* U+5B66 "学" */
+    0x0, 0x0, 0x4, 0x20, 0x44, 0x80, 0x49, 0x4,
+    0x84, 0x4e, 0xf7, 0x90, 0x2, 0x4f, 0xf0, 0x0,
+    0x40, 0x2, 0x3, 0xfd, 0xf0, 0x8, 0x0, 0x10,
+    0x0, 0xa0, 0x0, 0x80, 0x0, 0x0,
+
+    /* U+5B8C "完" */
+    0x0, 0x0, 0x1, 0x0, 0x20, 0x84, 0x3f, 0x76,
+    0x60, 0x8, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x4,
+    0x7f, 0xfe, 0x2, 0x40, 0x2, 0x40, 0x4, 0x40,
+    0x4, 0x42, 0x8, 0x42, 0x30, 0x7e, 0x40, 0x0,
+
+    /* U+5B9E "实" */
+    0x1, 0x0, 0x0, 0x80, 0x3f, 0xfe, 0x20, 0x4,
+    0x44, 0xc0, 0x2, 0x80, 0x12, 0x80, 0x8, 0x80,
+    0x4, 0x80, 0x7b, 0xfe, 0x0, 0x80, 0x1, 0xc0,
+    0x2, 0x30, 0xc, 0x8, 0x30, 0x4, 0x0, 0x0,
+
+    /* U+5BBF "宿" */
+    0x0, 0x0, 0x0, 0x80, 0x37, 0xfe, 0x28, 0x4,
+    0x4c, 0x2, 0xb, 0xf8, 0x10, 0x40, 0x18, 0x44,
+    0x31, 0xbc, 0x51, 0x4, 0x11, 0xfc, 0x11, 0x4,
+    0x11, 0x4, 0x11, 0xfc, 0x11, 0x4, 0x10, 0x0,
+
+    /* U+5BCC "富" */
+    0x2, 0x0, 0x4, 0x1, 0xff, 0x72, 0x1, 0x49,
+    0xfe, 0x0, 0x4, 0x7, 0xf8, 0x8, 0x10, 0x1d,
+    0xe0, 0x60, 0xf0, 0x88, 0x41, 0xff, 0x82, 0x21,
+    0x7, 0xfe, 0x8, 0x4, 0x0, 0x0,
+
+    /* U+5BF9 "对" */
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x7e, 0x8,
+    0x5, 0xff, 0x4, 0x8, 0x24, 0x8, 0x18, 0x88,
+    0x8, 0x88, 0xc, 0x48, 0x14, 0x48, 0x22, 0x8,
+    0x22, 0x8, 0x40, 0x8, 0x0, 0x30, 0x0, 0x0,
+
+    /* U+5DDE "州" */
+    0x0, 0x0, 0x22, 0x30, 0x88, 0x82, 0x22, 0x8,
+    0x88, 0x32, 0x24, 0xaa, 0x92, 0xaa, 0x4a, 0xa8,
+    0x42, 0x21, 0x8, 0x84, 0x22, 0x10, 0x88, 0x82,
+    0x24, 0x0, 0x80, 0x0,
+
+    /* U+5E2D "席" */
+    0x1, 0x0, 0x1, 0x8, 0xff, 0xf9, 0x11, 0x2,
+    0xff, 0xe4, 0x44, 0x8, 0x88, 0x11, 0xf0, 0x20,
+    0x80, 0x4f, 0xf8, 0x92, 0x21, 0x24, 0x42, 0x48,
+    0x88, 0x92, 0x10, 0x20, 0x0, 0x0,
+
+    /* U+5EFA "建" */
+    0x0, 0x40, 0x0, 0x40, 0x7f, 0xf8, 0x8, 0x48,
+    0x17, 0xfe, 0x10, 0x48, 0x23, 0xf8, 0x3c, 0x48,
+    0xb, 0xfc, 0x28, 0x40, 0x7, 0xfe, 0x10, 0x40,
+    0x18, 0x40, 0x26, 0x40, 0x41, 0xfe, 0x0, 0x0,
+
+    /* U+5F03 "弃" */
+    0x1, 0x0, 0x0, 0x80, 0x3f, 0xfe, 0x1, 0x0,
+    0x2, 0x30, 0x4, 0x8, 0x1f, 0xc8, 0x4, 0x24,
+    0x4, 0x20, 0x7f, 0xfe, 0x4, 0x20, 0x4, 0x20,
+    0x8, 0x20, 0x8, 0x20, 0x30, 0x20, 0x0, 0x0,
+
+    /* U+5F15 "引" */
+    0x0, 0x9, 0xfc, 0x20, 0x10, 0x80, 0x42, 0x1,
+    0x8, 0xfc, 0x22, 0x0, 0x88, 0x2, 0x7f, 0x88,
+    0x4, 0x20, 0x10, 0x80, 0x42, 0x1, 0x8, 0x8,
+    0x20, 0xe0, 0x80, 0x0,
+
+    /* U+5F85 "待" */
+    0x8, 0x0, 0x8, 0x40, 0x10, 0x44, 0x23, 0xfc,
+    0x48, 0x40, 0x8, 0x42, 0x17, 0xf6, 0x10, 0x8,
+    0x30, 0xa, 0x53, 0xfc, 0x10, 0x88, 0x10, 0xc8,
+    0x10, 0x8, 0x10, 0x8, 0x10, 0x30, 0x0, 0x0,
+
+    /* U+6027 "性" */
+    0x10, 0x20, 0x11, 0x20, 0x11, 0xa0, 0x11, 0x20,
+    0x5d, 0xfe, 0x52, 0x20, 0x52, 0x20, 0x14, 0x20,
+    0x10, 0x24, 0x11, 0xfe, 0x10, 0x20, 0x10, 0x20,
+    0x10, 0x20, 0x10, 0x22, 0x17, 0xdc, 0x0, 0x0,
+
+    /* U+60EF "惯" */
+    0x10, 0x0, 0x11, 0xfc, 0x11, 0x4a, 0x17, 0xfe,
+    0x1a, 0x48, 0x57, 0xf8, 0x50, 0x8, 0x53, 0xf8,
+    0x12, 0x8, 0x12, 0x68, 0x12, 0x48, 0x12, 0x48,
+    0x12, 0x68, 0x10, 0x98, 0x17, 0x4, 0x0, 0x0,
+
+    /* U+610F "意" */
+    0x1, 0x0, 0x2, 0x0, 0xff, 0x60, 0x23, 0x0,
+    0x44, 0x7c, 0x1, 0x6, 0xec, 0x8, 0x8, 0x1f,
+    0xf0, 0x20, 0x20, 0x7d, 0xc0, 0x48, 0x42, 0x8a,
+    0x45, 0x4, 0xd1, 0xf8, 0x0, 0x0,
+
+    /* U+6210 "成" */
+    0x0, 0x0, 0x0, 0xd0, 0x0, 0x88, 0x0, 0x84,
+    0x3f, 0xfa, 0x20, 0x80, 0x20, 0x88, 0x3f, 0x8,
+    0x22, 0x50, 0x22, 0x50, 0x22, 0x20, 0x22, 0x20,
+    0x22, 0x52, 0x44, 0x8a, 0x83, 0x6, 0x0, 0x0,
+
+    /* U+6237 "户" */
+    0x0, 0x0, 0x4, 0x0, 0x8, 0x7, 0xff, 0x10,
+    0x8, 0x40, 0x21, 0x0, 0x87, 0xfe, 0x10, 0x8,
+    0x40, 0x1, 0x0, 0x4, 0x0, 0x20, 0x0, 0x80,
+    0x4, 0x0, 0x0, 0x0,
+
+    /* U+624D "才" */
+    0x0, 0x40, 0x0, 0x80, 0x1, 0x0, 0x2, 0x7,
+    0xf7, 0xe0, 0x18, 0x0, 0x50, 0x0, 0xa0, 0x2,
+    0x40, 0x8, 0x80, 0x21, 0x0, 0x82, 0x2, 0x4,
+    0x8, 0x8, 0x0, 0x70, 0x0, 0x0,
+
+    /* U+627F "承" */
+    0x1f, 0xb0, 0x0, 0x40, 0x1, 0x80, 0x1, 0x24,
+    0x79, 0x44, 0xf, 0x98, 0x11, 0x10, 0x17, 0xf0,
+    0x11, 0x10, 0xf, 0xe8, 0x21, 0xc, 0x41, 0x6,
+    0x41, 0x0, 0x7, 0x0, 0x0, 0x0,
+
+    /* U+62BD "抽" */
+    0x10, 0x20, 0x20, 0x40, 0x40, 0x83, 0xe1, 0x1,
+    0x3f, 0xe2, 0x44, 0x85, 0x89, 0xd, 0x12, 0x72,
+    0x24, 0xa7, 0xf8, 0x48, 0x90, 0x91, 0x21, 0x22,
+    0x42, 0x7f, 0x8c, 0x81, 0x0, 0x0,
+
+    /* U+6307 "指" */
+    0x0, 0x0, 0x33, 0x18, 0x44, 0xc0, 0x8e, 0x7,
+    0xf0, 0x22, 0x20, 0xc5, 0xbf, 0xc, 0x0, 0x71,
+    0xfc, 0xa2, 0x8, 0x44, 0x10, 0x8f, 0xe1, 0x10,
+    0x4a, 0x3f, 0x8c, 0x41, 0x0, 0x0,
+
+    /* U+63A5 "接" */
+    0x0, 0x0, 0x10, 0x40, 0x10, 0x24, 0x15, 0x8,
+    0x78, 0x90, 0x10, 0x92, 0x17, 0x6e, 0x18, 0x40,
+    0x30, 0x82, 0x57, 0xbe, 0x11, 0x10, 0x11, 0x10,
+    0x10, 0xe0, 0x10, 0x58, 0x37, 0x84, 0x0, 0x0,
+
+    /* U+63A7 "控" */
+    0x0, 0x0, 0x18, 0x20, 0x10, 0x22, 0x15, 0xde,
+    0x7a, 0x4, 0x12, 0xd8, 0x15, 0x4, 0x1b, 0x6,
+    0x34, 0x8, 0x51, 0xf0, 0x10, 0x20, 0x10, 0x20,
+    0x10, 0x20, 0x10, 0x22, 0x77, 0xdd, 0x0, 0x0,
+
+    /* U+63CF "描" */
+    0x10, 0x0, 0x10, 0x88, 0x10, 0x92, 0x17, 0xfd,
+    0x78, 0x90, 0x10, 0x90, 0x13, 0x46, 0x1e, 0x22,
+    0x32, 0x22, 0x52, 0x22, 0x13, 0xfe, 0x12, 0x22,
+    0x12, 0x22, 0x13, 0xfe, 0x32, 0x2, 0x0, 0x0,
+
+    /* U+6458 "摘" */
+    0x10, 0x40, 0x10, 0x42, 0x13, 0xfe, 0x1c, 0x90,
+    0x70, 0x50, 0x13, 0xfe, 0x12, 0x24, 0x1b, 0xfc,
+    0x72, 0x24, 0x52, 0xf4, 0x12, 0x94, 0x12, 0x94,
+    0x12, 0xf4, 0x12, 0x84, 0x32, 0xc, 0x0, 0x0,
+
+    /* U+6536 "收" */
+    0x0, 0x80, 0x8, 0xc0, 0x8, 0x80, 0x49, 0x4,
+    0x69, 0xfe, 0x49, 0x10, 0x4a, 0x90, 0x48, 0x90,
+    0x48, 0x90, 0x58, 0x90, 0x68, 0x60, 0x48, 0x20,
+    0x8, 0x70, 0x8, 0x98, 0xb, 0x6, 0x0, 0x0,
+
+    /* U+653E "放" */
+    0x0, 0x0, 0x8, 0x20, 0x8, 0x40, 0x9, 0x42,
+    0x76, 0x7c, 0x10, 0x48, 0x12, 0x88, 0x1e, 0x48,
+    0x12, 0x48, 0x12, 0x20, 0x22, 0x30, 0x22, 0x10,
+    0x22, 0x30, 0x4c, 0x48, 0x45, 0x86, 0x2, 0x0,
+
+    /* U+6545 "故" */
+    0x0, 0x20, 0x8, 0x20, 0x8, 0x20, 0x8, 0x42,
+    0x7f, 0x7e, 0x8, 0x48, 0x8, 0xc8, 0xa, 0x48,
+    0x36, 0x28, 0x22, 0x28, 0x22, 0x10, 0x22, 0x10,
+    0x3e, 0x28, 0x22, 0x4c, 0x21, 0x82, 0x0, 0x0,
+
+    /* U+661F "星" */
+    0x0, 0x0, 0x1f, 0xf8, 0x10, 0x8, 0x10, 0x8,
+    0x1f, 0xf8, 0x10, 0x8, 0x1f, 0x78, 0x10, 0x80,
+    0x18, 0x84, 0x17, 0xf0, 0x20, 0x88, 0x2f, 0xfc,
+    0x40, 0x80, 0x0, 0x80, 0x7f, 0xfe, 0x0, 0x0,
+
+    /* U+662F "是" */
+    0x0, 0x0, 0xf, 0xf0, 0x8, 0x10, 0xf, 0xf0,
+    0x8, 0x10, 0xf, 0xf0, 0x8, 0x10, 0x0, 0x4,
+    0x77, 0xfa, 0x8, 0x80, 0x8, 0xfc, 0x8, 0x80,
+    0x14, 0x80, 0x23, 0x80, 0x40, 0xfe, 0x0, 0x0,
+
+    /* U+6674 "晴" */
+    0x0, 0x40, 0x20, 0x8b, 0xdf, 0xf4, 0x82, 0x49,
+    0x3f, 0x92, 0x8, 0xbd, 0xe8, 0x49, 0xc, 0x92,
+    0x9, 0x27, 0xf2, 0x48, 0x27, 0x9f, 0xc9, 0x20,
+    0x80, 0x41, 0x0, 0x8c, 0x0, 0x0,
+
+    /* U+6709 "有" */
+    0x2, 0x0, 0x2, 0x0, 0xf7, 0xfe, 0x4, 0x0,
+    0x8, 0x0, 0xf, 0xf8, 0x18, 0x8, 0x28, 0x8,
+    0x4f, 0xf8, 0x8, 0x8, 0x8, 0x8, 0xf, 0xf8,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x38, 0x0, 0x10,
+
+    /* U+671F "期" */
+    0x10, 0x0, 0x12, 0x2, 0x12, 0xbe, 0x7f, 0x22,
+    0x12, 0x22, 0x1e, 0x3e, 0x12, 0x22, 0x12, 0x22,
+    0x1e, 0x22, 0x12, 0xbe, 0x7f, 0xc2, 0x12, 0x42,
+    0x11, 0x42, 0x20, 0x82, 0x41, 0xe, 0x0, 0x0,
+
+    /* U+672F "术" */
+    0x1, 0x0, 0x2, 0x40, 0x4, 0x40, 0x8, 0x87,
+    0xde, 0xe0, 0x60, 0x0, 0x40, 0x2, 0xa0, 0x9,
+    0x40, 0x12, 0x40, 0x44, 0x41, 0x8, 0x44, 0x10,
+    0x60, 0x20, 0x0, 0x40, 0x0, 0x0,
+
+    /* U+673A "机" */
+    0x10, 0x0, 0x10, 0x10, 0x10, 0xf8, 0x14, 0x90,
+    0x7e, 0x90, 0x10, 0x90, 0x10, 0x90, 0x3c, 0x90,
+    0x16, 0x90, 0x50, 0x90, 0x11, 0x10, 0x11, 0x10,
+    0x11, 0x12, 0x12, 0x12, 0x14, 0x1e, 0x0, 0x0,
+
+    /* U+6C14 "气" */
+    0x8, 0x0, 0x8, 0x0, 0xf, 0xfe, 0x10, 0x0,
+    0xf, 0xf8, 0x20, 0x0, 0x5f, 0xf8, 0x0, 0x10,
+    0x0, 0x10, 0x0, 0x10, 0x0, 0x10, 0x0, 0x10,
+    0x0, 0xa, 0x0, 0x6, 0x0, 0x2, 0x0, 0x0,
+
+    /* U+6C7D "汽" */
+    0x0, 0x0, 0x20, 0x80, 0x19, 0x4, 0x5, 0xe2,
+    0x4a, 0x8, 0x29, 0xf8, 0x28, 0x0, 0x17, 0xf0,
+    0x10, 0x10, 0x20, 0x10, 0x60, 0x10, 0x20, 0x10,
+    0x20, 0xa, 0x20, 0xa, 0x20, 0x6, 0x0, 0x0,
+
+    /* U+6EE5 "滥" */
+    0x0, 0x10, 0x20, 0x98, 0x12, 0x92, 0x2, 0x9e,
+    0xa, 0xa0, 0x4a, 0x88, 0x2a, 0x84, 0x12, 0x84,
+    0x10, 0x80, 0x13, 0xfc, 0x62, 0xa4, 0x22, 0xa4,
+    0x22, 0xa4, 0x22, 0xa4, 0x2f, 0xff, 0x0, 0x0,
+
+    /* U+706B "火" */
+    0x0, 0x0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80,
+    0x0, 0x8c, 0x8, 0x88, 0x8, 0x90, 0x11, 0x20,
+    0x31, 0x40, 0x1, 0x40, 0x2, 0x20, 0x2, 0x20,
+    0x4, 0x10, 0x18, 0xc, 0x60, 0x6, 0x0, 0x0,
+
+    /* U+73B0 "现" */
+    0x0, 0x0, 0x5, 0xfc, 0x7d, 0x4, 0x11, 0x34,
+    0x11, 0x24, 0x11, 0x24, 0x7d, 0x24, 0x11, 0x24,
+    0x11, 0x34, 0x11, 0x34, 0x11, 0x14, 0x1c, 0x50,
+    0x60, 0x90, 0x1, 0x12, 0x6, 0x1f, 0x0, 0x0,
+
+    /* U+7528 "用" */
+    0x0, 0x0, 0x3f, 0xfc, 0x42, 0x10, 0x84, 0x21,
+    0x8, 0x43, 0xff, 0x84, 0x21, 0x8, 0x42, 0x10,
+    0x84, 0x3f, 0xf8, 0x82, 0x11, 0x4, 0x22, 0x8,
+    0x44, 0x10, 0x90, 0x27, 0x0, 0x0,
+
+    /* U+7684 "的" */
+    0x0, 0x0, 0x30, 0xc0, 0x41, 0x0, 0xa4, 0x26,
+    0xcb, 0xc8, 0xa0, 0x91, 0x41, 0x22, 0x42, 0x7c,
+    0x44, 0x88, 0xc9, 0x10, 0x12, 0x20, 0x24, 0x40,
+    0x4f, 0x81, 0x10, 0xe, 0x0, 0x0,
+
+    /* U+7814 "研" */
+    0x0, 0x0, 0x7e, 0xb6, 0x10, 0x48, 0x10, 0x48,
+    0x20, 0x48, 0x24, 0x48, 0x3c, 0x4a, 0x65, 0xfc,
+    0x24, 0x48, 0x24, 0x48, 0x24, 0x88, 0x3c, 0x88,
+    0x25, 0x8, 0x23, 0x8, 0x4, 0x8, 0x8, 0x0,
+
+    /* U+786E "确" */
+    0x0, 0x80, 0x4, 0x88, 0x7c, 0xf8, 0x11, 0x10,
+    0x23, 0xee, 0x21, 0x22, 0x3d, 0x22, 0x69, 0xfe,
+    0x29, 0x22, 0x29, 0x22, 0x29, 0xfe, 0x39, 0x22,
+    0x29, 0x22, 0x22, 0x22, 0x4, 0x2e, 0x0, 0x0,
+
+    /* U+798F "福" */
+    0x0, 0x0, 0x27, 0xfc, 0x20, 0x0, 0x27, 0xc7,
+    0xc8, 0x81, 0x11, 0x4, 0x3e, 0xa, 0x2, 0x35,
+    0xfc, 0xa2, 0x48, 0x47, 0xf0, 0x89, 0x21, 0x12,
+    0x42, 0x3f, 0x84, 0x41, 0x0, 0x0,
+
+    /* U+79EF "积" */
+    0x0, 0x0, 0x6, 0x4, 0x78, 0xfc, 0x8, 0x84,
+    0xa, 0x84, 0x7e, 0x84, 0x18, 0x84, 0x1c, 0x84,
+    0x2a, 0xfc, 0x28, 0x84, 0x48, 0x60, 0x8, 0x48,
+    0x8, 0x84, 0x9, 0x2, 0xa, 0x2, 0x0, 0x0,
+
+    /* U+7A76 "究" */
+    0x1, 0x0, 0x1, 0x0, 0x3f, 0xfe, 0x20, 0x4,
+    0x44, 0x20, 0x8, 0x10, 0x32, 0x8, 0x42, 0x0,
+    0x3f, 0xe0, 0x2, 0x20, 0x2, 0x20, 0x2, 0x20,
+    0x4, 0x22, 0x8, 0x22, 0x30, 0x3e, 0x0, 0x0,
+
+    /* U+7B26 "符" */
+    0x8, 0x20, 0x8, 0x20, 0x1f, 0xf6, 0x22, 0x50,
+    0x22, 0x88, 0x44, 0x10, 0x8, 0x10, 0x1b, 0xfe,
+    0x28, 0x10, 0x49, 0x10, 0x8, 0x90, 0x8, 0x90,
+    0x8, 0x10, 0x8, 0x10, 0x8, 0x30, 0x0, 0x0,
+
+    /* U+7B49 "等" */
+    0x8, 0x20, 0x8, 0x20, 0x1d, 0x76, 0x14, 0x48,
+    0x22, 0x88, 0x40, 0x88, 0x1f, 0xf4, 0x0, 0x82,
+    0x7f, 0xfe, 0x0, 0x14, 0x3f, 0xfe, 0x2, 0x10,
+    0x1, 0x10, 0x0, 0x10, 0x0, 0x60, 0x0, 0x0,
+
+    /* U+7CBE "精" */
+    0x10, 0x20, 0x20, 0x41, 0x4f, 0xf0, 0xa1, 0x3,
+    0x1f, 0xca, 0x84, 0x4, 0xff, 0x8c, 0x0, 0x34,
+    0xfc, 0x29, 0x11, 0x43, 0xe4, 0x84, 0x41, 0xf,
+    0x82, 0x11, 0x4, 0x26, 0x0, 0x0,
+
+    /* U+7D2F "累" */
+    0x0, 0x0, 0x1f, 0xfc, 0x10, 0x84, 0x1f, 0xfc,
+    0x10, 0x84, 0x1d, 0xec, 0x3, 0x10, 0xe, 0x38,
+    0x10, 0xc0, 0x2, 0xc, 0x3f, 0xe2, 0x4, 0x92,
+    0xc, 0x88, 0x30, 0x86, 0x43, 0x82, 0x0, 0x0,
+
+    /* U+7EA6 "约" */
+    0x0, 0x0, 0x18, 0xc0, 0x10, 0x82, 0x20, 0xfe,
+    0x25, 0x2, 0x59, 0x2, 0x4a, 0x2, 0x10, 0x42,
+    0x20, 0x22, 0x3c, 0x22, 0x60, 0x12, 0x4, 0x2,
+    0x18, 0x2, 0x60, 0x4, 0x0, 0x1c, 0x0, 0x0,
+
+    /* U+7EDD "绝" */
+    0x10, 0x40, 0x10, 0xc0, 0x20, 0xf8, 0x25, 0x10,
+    0x49, 0x10, 0x5b, 0xee, 0x51, 0x24, 0x11, 0x24,
+    0x21, 0x24, 0x79, 0xfc, 0x41, 0x4, 0x1, 0x0,
+    0x19, 0x2, 0x61, 0x2, 0x1, 0xfe, 0x0, 0x0,
+
+    /* U+7F2A "缪" */
+    0x0, 0x0, 0x16, 0xde, 0x21, 0x52, 0x2d, 0x4a,
+    0x48, 0xce, 0x5b, 0x52, 0x52, 0x62, 0x20, 0x98,
+    0x29, 0x26, 0x72, 0x50, 0x41, 0xb0, 0x0, 0x4c,
+    0x39, 0x90, 0x40, 0x60, 0x3, 0x80, 0x0, 0x0,
+
+    /* U+7F3A "缺" */
+    0x10, 0x20, 0x10, 0x20, 0x12, 0x20, 0x1f, 0xfc,
+    0x28, 0x24, 0x48, 0x24, 0x49, 0x24, 0x1c, 0x24,
+    0x2a, 0xff, 0x2b, 0x20, 0x2a, 0x50, 0x2a, 0x50,
+    0x3e, 0x88, 0x61, 0x84, 0x6, 0x3, 0x0, 0x0,
+
+    /* U+7F6E "置" */
+    0x0, 0x0, 0x1f, 0xfc, 0x12, 0x44, 0x1f, 0x78,
+    0x10, 0x80, 0x6f, 0xfe, 0x1, 0x0, 0xf, 0xf0,
+    0x8, 0x10, 0xf, 0xf0, 0x8, 0x10, 0xf, 0xf0,
+    0xc, 0x10, 0x8, 0x10, 0x7f, 0xff, 0x0, 0x0,
+
+    /* U+805A "聚" */
+    0x0, 0x0, 0x7f, 0xc0, 0x11, 0x7e, 0x1f, 0x4,
+    0x11, 0x28, 0x1f, 0x18, 0x11, 0xa4, 0x79, 0x42,
+    0x0, 0xf0, 0xc, 0x8c, 0x10, 0x90, 0x66, 0x20,
+    0xc, 0x90, 0x10, 0x8e, 0x61, 0x80, 0x0, 0x0,
+
+    /* U+80FD "能" */
+    0x8, 0x0, 0x18, 0x44, 0x12, 0x4c, 0x25, 0x70,
+    0x79, 0x42, 0x22, 0x42, 0x3e, 0x3c, 0x22, 0x0,
+    0x3e, 0x44, 0x22, 0x4c, 0x3e, 0x70, 0x22, 0x40,
+    0x22, 0x42, 0x22, 0x42, 0x2e, 0x7e, 0x0, 0x0,
+
+    /* U+8154 "腔" */
+    0x0, 0x0, 0x24, 0x20, 0x3e, 0x22, 0x25, 0xde,
+    0x25, 0x4, 0x3c, 0x58, 0x24, 0x84, 0x25, 0x2,
+    0x25, 0x4, 0x3c, 0xfc, 0x24, 0x20, 0x24, 0x20,
+    0x44, 0x20, 0x44, 0x22, 0x4d, 0xdc, 0x0, 0x0,
+
+    /* U+81B3 "膳" */
+    0x0, 0x8, 0x2c, 0x88, 0x24, 0x54, 0x27, 0xa2,
+    0x25, 0x24, 0x3c, 0x20, 0x27, 0xf6, 0x25, 0x24,
+    0x3c, 0xa8, 0x27, 0xfe, 0x24, 0x0, 0x25, 0xfc,
+    0x45, 0x4, 0x45, 0x4, 0x5d, 0xfc, 0x8, 0x0,
+
+    /* U+81F4 "致" */
+    0x0, 0x0, 0x1, 0x20, 0x7e, 0x20, 0x10, 0x42,
+    0x12, 0x7c, 0x25, 0x48, 0x79, 0x8, 0x8, 0xa8,
+    0x9, 0x28, 0x7f, 0x20, 0x8, 0x10, 0x8, 0x10,
+    0xf, 0x28, 0x78, 0x4c, 0x41, 0x86, 0x2, 0x0,
+
+    /* U+8239 "船" */
+    0x8, 0x0, 0x8, 0x78, 0x3f, 0x48, 0x22, 0x48,
+    0x2a, 0x48, 0x2a, 0x48, 0x2a, 0x4e, 0x76, 0x80,
+    0x22, 0x0, 0x2a, 0x7c, 0x2a, 0x44, 0x2a, 0x44,
+    0x22, 0x44, 0x42, 0x7c, 0x46, 0x44, 0x0, 0x0,
+
+    /* U+8352 "荒" */
+    0x4, 0x20, 0x4, 0x22, 0x7e, 0xfe, 0x5, 0x20,
+    0x4, 0x82, 0x7b, 0xfe, 0x8, 0x0, 0x1f, 0xf8,
+    0x8, 0x0, 0xd, 0xb0, 0x9, 0x10, 0x9, 0x10,
+    0x9, 0x11, 0x19, 0x11, 0x61, 0x1e, 0x0, 0x0,
+
+    /* U+8650 "虐" */
+    0x1, 0x0, 0x1, 0x8, 0x1, 0xd0, 0x3f, 0x6,
+    0x21, 0x24, 0x21, 0xf4, 0x2f, 0x4, 0x21, 0xf8,
+    0x20, 0x0, 0x27, 0xf8, 0x24, 0x0, 0x3f, 0xfe,
+    0x24, 0x0, 0x44, 0x8, 0x47, 0xfc, 0x0, 0x0,
+
+    /* U+88D5 "裕" */
+    0x0, 0x0, 0x10, 0x58, 0x8, 0x88, 0x5, 0x24,
+    0xfd, 0x20, 0x8, 0x40, 0x12, 0x50, 0x34, 0x88,
+    0x18, 0x86, 0x55, 0xf8, 0x14, 0x88, 0x10, 0x88,
+    0x10, 0x88, 0x10, 0xf8, 0x10, 0x88, 0x0, 0x80,
+
+    /* U+8981 "要" */
+    0x0, 0x0, 0x7f, 0xfe, 0x2, 0x40, 0x1f, 0xf8,
+    0x12, 0x48, 0x12, 0x48, 0x1f, 0xf8, 0x11, 0x8,
+    0x2, 0x2, 0xff, 0xfe, 0x4, 0x20, 0xc, 0x40,
+    0x0, 0xc0, 0x3, 0x30, 0x1c, 0xc, 0x20, 0x0,
+
+    /* U+8BA4 "认" */
+    0x0, 0x0, 0x20, 0x60, 0x10, 0x40, 0x10, 0x40,
+    0x0, 0x40, 0x70, 0x40, 0x10, 0x40, 0x10, 0x40,
+    0x10, 0x40, 0x10, 0x50, 0x14, 0x90, 0x18, 0x88,
+    0x11, 0x8, 0x12, 0x4, 0x4, 0x2, 0x0, 0x0,
+
+    /* U+8C03 "调" */
+    0x0, 0x0, 0x23, 0xde, 0x1a, 0x22, 0x2, 0x2a,
+    0x2, 0xfa, 0x72, 0x22, 0x12, 0xfe, 0x12, 0x2,
+    0x12, 0x7a, 0x16, 0x52, 0x1a, 0x52, 0x12, 0x72,
+    0x14, 0x52, 0x4, 0x2, 0x8, 0xe, 0x0, 0x0,
+
+    /* U+8C61 "象" */
+    0x4, 0x0, 0x7, 0xe0, 0x8, 0x40, 0x10, 0x88,
+    0x7f, 0xf8, 0x11, 0x8, 0x1f, 0xf8, 0x12, 0xc,
+    0xd, 0x10, 0x72, 0xa0, 0xc, 0xd0, 0x33, 0x48,
+    0x4, 0x44, 0x18, 0x42, 0x63, 0x80, 0x0, 0x0,
+
+    /* U+8D23 "责" */
+    0x0, 0x0, 0x1, 0x4, 0x3f, 0xfc, 0x1, 0x8,
+    0x1f, 0xf8, 0x1, 0x4, 0x7e, 0xea, 0x0, 0x10,
+    0xe, 0xf8, 0x11, 0x10, 0x11, 0x10, 0x11, 0x18,
+    0x11, 0x10, 0x2, 0x70, 0x3c, 0x8, 0x0, 0x4,
+
+    /* U+8D26 "账" */
+    0x0, 0x80, 0x7c, 0x84, 0x44, 0x88, 0x54, 0x90,
+    0x54, 0xa0, 0x54, 0xc0, 0x54, 0x80, 0x57, 0xee,
+    0x54, 0x90, 0x54, 0x90, 0x54, 0x90, 0x14, 0x88,
+    0x28, 0x98, 0x24, 0xe4, 0x42, 0x82, 0x0, 0x0,
+
+    /* U+8D85 "超" */
+    0x8, 0x0, 0x8, 0xde, 0xa, 0x24, 0x7f, 0x24,
+    0x8, 0x24, 0x9, 0x5c, 0x7f, 0x88, 0x8, 0x74,
+    0x2a, 0x44, 0x2f, 0x44, 0x28, 0x44, 0x28, 0x7c,
+    0x58, 0x44, 0x46, 0x0, 0x1, 0xfe, 0x0, 0x0,
+
+    /* U+8F66 "车" */
+    0x0, 0x0, 0x4, 0x0, 0x10, 0x23, 0xf7, 0x80,
+    0x90, 0x2, 0x20, 0x4, 0x48, 0x1f, 0xf8, 0x1,
+    0x0, 0x2, 0x3, 0xff, 0xf0, 0x8, 0x0, 0x10,
+    0x0, 0x20, 0x0, 0x40, 0x0, 0x0,
+
+    /* U+8FC7 "过" */
+    0x0, 0x0, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x7, 0xfe, 0x0, 0x10, 0x10, 0x10, 0x71, 0x10,
+    0x10, 0x90, 0x10, 0x90, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x70, 0x2c, 0x20, 0x43, 0xfe, 0x0, 0x0,
+
+    /* U+8FD1 "近" */
+    0x0, 0x0, 0x20, 0x3c, 0x11, 0xc0, 0x19, 0x0,
+    0x1, 0x0, 0x1, 0xee, 0x71, 0x10, 0x11, 0x10,
+    0x11, 0x10, 0x12, 0x10, 0x12, 0x10, 0x14, 0x10,
+    0x18, 0x10, 0x64, 0x0, 0x43, 0xfe,
+
+    /* U+8FDB "进" */
+    0x0, 0x0, 0x20, 0x98, 0x10, 0x90, 0x17, 0xfe,
+    0x0, 0x90, 0x0, 0x90, 0x10, 0x90, 0x77, 0xfe,
+    0x10, 0x90, 0x11, 0x10, 0x11, 0x10, 0x12, 0x10,
+    0x14, 0x10, 0x28, 0x0, 0x43, 0xfe, 0x0, 0x0,
+
+    /* U+8FF0 "述" */
+    0x0, 0x0, 0x20, 0x60, 0x20, 0x48, 0x10, 0x40,
+    0x7, 0xfe, 0x0, 0xc0, 0x10, 0xe0, 0x71, 0x50,
+    0x11, 0x48, 0x12, 0x44, 0x14, 0x46, 0x10, 0x40,
+    0x10, 0x40, 0x28, 0x0, 0x47, 0xfe, 0x0, 0x0,
+
+    /* U+901A "通" */
+    0x23, 0xfc, 0x10, 0x8, 0x10, 0x40, 0x3, 0xfc,
+    0x2, 0x44, 0x12, 0x44, 0x73, 0xfc, 0x12, 0x44,
+    0x13, 0xfc, 0x12, 0x44, 0x12, 0x44, 0x12, 0x5c,
+    0x2c, 0x0, 0x43, 0xfe, 0x0, 0x0,
+
+    /* U+901F "速" */
+    0x0, 0x40, 0x0, 0x40, 0x2f, 0xfe, 0x10, 0x40,
+    0x10, 0x48, 0x3, 0xfc, 0x2, 0x48, 0x7b, 0x78,
+    0x12, 0x48, 0x10, 0xe0, 0x11, 0x58, 0x16, 0x44,
+    0x10, 0x40, 0x2c, 0x40, 0x43, 0xfe, 0x0, 0x0,
+
+    /* U+9053 "道" */
+    0x0, 0x0, 0x3, 0x18, 0x21, 0x20, 0x17, 0xee,
+    0x0, 0x80, 0x3, 0xb8, 0x12, 0x8, 0x73, 0xf8,
+    0x12, 0x8, 0x13, 0xf8, 0x12, 0x8, 0x13, 0xf8,
+    0x12, 0x8, 0x2c, 0x0, 0x43, 0xfe, 0x0, 0x0,
+
+    /* U+9057 "遗" */
+    0x0, 0x40, 0x23, 0xfc, 0x12, 0x44, 0x13, 0xfc,
+    0x2, 0x42, 0xd, 0xfe, 0x10, 0x4, 0x7b, 0xbc,
+    0x12, 0x44, 0x12, 0x44, 0x12, 0x44, 0x12, 0x90,
+    0x11, 0xc, 0x2c, 0x0, 0x43, 0xfe, 0x0, 0x0,
+
+    /* U+9634 "阴" */
+    0x0, 0x0, 0x7, 0xf7, 0xd0, 0x92, 0x42, 0x49,
+    0x9, 0x47, 0xe5, 0x10, 0x94, 0x42, 0x49, 0xf9,
+    0x14, 0x24, 0x50, 0x9b, 0x2, 0x5a, 0x9, 0x10,
+    0x24, 0x83, 0x80, 0x0,
+
+    /* U+9662 "院" */
+    0x0, 0x1, 0x20, 0x83, 0xe1, 0x4, 0xbd, 0xe9,
+    0x40, 0x94, 0x82, 0x28, 0xf8, 0x48, 0x0, 0x87,
+    0xfd, 0x12, 0x42, 0x24, 0x87, 0x89, 0x8, 0x22,
+    0x50, 0x84, 0xa6, 0xf, 0x0, 0x0,
+
+    /* U+966A "陪" */
+    0x0, 0x40, 0xf0, 0x81, 0x3f, 0xb2, 0x80, 0x85,
+    0x11, 0xa, 0x12, 0x14, 0x29, 0x27, 0xbf, 0x48,
+    0x0, 0x9b, 0xf1, 0xa4, 0x22, 0x88, 0x44, 0x10,
+    0x88, 0x3f, 0x10, 0x42, 0x0, 0x0,
+
+    /* U+9762 "面" */
+    0x0, 0x0, 0x7e, 0xfe, 0x1, 0x0, 0x1, 0x0,
+    0x3f, 0xbc, 0x22, 0x44, 0x22, 0x44, 0x23, 0xc4,
+    0x22, 0x44, 0x22, 0x44, 0x23, 0xc4, 0x22, 0x44,
+    0x22, 0x44, 0x3f, 0xfc, 0x20, 0x4, 0x0, 0x0,
+
+    /* U+97F3 "音" */
+    0x1, 0x0, 0x0, 0x80, 0x3b, 0xdc, 0x4, 0x20,
+    0x4, 0x20, 0x2, 0x40, 0x7f, 0xfe, 0x0, 0x0,
+    0xf, 0xf8, 0x8, 0x10, 0x8, 0x10, 0xf, 0xf0,
+    0x8, 0x10, 0x8, 0x10, 0xf, 0xf0, 0x8, 0x10,
+
+    /* U+98DE "飞" */
+    0x1, 0x1, 0xfe, 0x0, 0x4, 0x40, 0x8, 0x80,
+    0x12, 0x0, 0x38, 0x0, 0x58, 0x0, 0x98, 0x1,
+    0x10, 0x2, 0x0, 0x4, 0x0, 0x4, 0x20, 0x6,
+    0x40, 0x3, 0x0,
+
+    /* U+FF08 "（" */
+    0x0, 0x2, 0x44, 0x88, 0x88, 0x88, 0x44, 0x20,
+    0x0,
+
+    /* U+FF09 "）" */
+    0x0, 0x4, 0x22, 0x11, 0x11, 0x12, 0x22, 0x40,
+    0x0,
+
+    /* U+FF0C "，" */
+    0x4d, 0x0,
+
+    /* U+FF1B "；" */
+    0x70, 0x58,
+
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 128, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 128, .box_w = 3, .box_h = 10, .ofs_x = 3, .ofs_y = 1},
+    {.bitmap_index = 4, .adv_w = 128, .box_w = 4, .box_h = 4, .ofs_x = 2, .ofs_y = 7},
+    {.bitmap_index = 6, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 19, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 31, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 41, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 53, .adv_w = 128, .box_w = 2, .box_h = 5, .ofs_x = 2, .ofs_y = 7},
+    {.bitmap_index = 55, .adv_w = 128, .box_w = 5, .box_h = 16, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 65, .adv_w = 128, .box_w = 5, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 75, .adv_w = 128, .box_w = 6, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 79, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 87, .adv_w = 128, .box_w = 4, .box_h = 4, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 89, .adv_w = 128, .box_w = 8, .box_h = 1, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 90, .adv_w = 128, .box_w = 2, .box_h = 3, .ofs_x = 3, .ofs_y = 1},
+    {.bitmap_index = 91, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 106, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 116, .adv_w = 128, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 124, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 134, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 144, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 154, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 164, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 174, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 184, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 194, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 204, .adv_w = 128, .box_w = 3, .box_h = 7, .ofs_x = 3, .ofs_y = 2},
+    {.bitmap_index = 207, .adv_w = 128, .box_w = 4, .box_h = 8, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 211, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 219, .adv_w = 128, .box_w = 8, .box_h = 4, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 223, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 231, .adv_w = 128, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 239, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 248, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 258, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 268, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 278, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 288, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 298, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 308, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 318, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 328, .adv_w = 128, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 336, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 346, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 356, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 366, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 376, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 386, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 396, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 406, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 417, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 427, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 437, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 447, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 457, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 467, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 477, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 487, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 497, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 507, .adv_w = 128, .box_w = 5, .box_h = 15, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 517, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 532, .adv_w = 128, .box_w = 5, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 542, .adv_w = 128, .box_w = 6, .box_h = 3, .ofs_x = 1, .ofs_y = 10},
+    {.bitmap_index = 545, .adv_w = 128, .box_w = 8, .box_h = 1, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 546, .adv_w = 128, .box_w = 4, .box_h = 4, .ofs_x = 2, .ofs_y = 8},
+    {.bitmap_index = 548, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 555, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 565, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 572, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 582, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 589, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 599, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 608, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 618, .adv_w = 128, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 626, .adv_w = 128, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 637, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 647, .adv_w = 128, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 655, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 662, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 669, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 676, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 685, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 694, .adv_w = 128, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 701, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 708, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 718, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 725, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 732, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 739, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 746, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 755, .adv_w = 128, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 761, .adv_w = 128, .box_w = 6, .box_h = 15, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 773, .adv_w = 128, .box_w = 2, .box_h = 15, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 777, .adv_w = 128, .box_w = 6, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 789, .adv_w = 128, .box_w = 8, .box_h = 3, .ofs_x = 0, .ofs_y = 9},
+    {.bitmap_index = 792, .adv_w = 256, .box_w = 12, .box_h = 2, .ofs_x = 2, .ofs_y = 6},
+    {.bitmap_index = 795, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 820, .adv_w = 256, .box_w = 16, .box_h = 2, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 824, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 853, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 880, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 910, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 942, .adv_w = 256, .box_w = 12, .box_h = 16, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 966, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 996, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1026, .adv_w = 256, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1051, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1080, .adv_w = 256, .box_w = 16, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1104, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1134, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1164, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1194, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1226, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1258, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1290, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1322, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1354, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1386, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1414, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1446, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1478, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1510, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1540, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1570, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1602, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1632, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1662, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1692, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1722, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1752, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1784, .adv_w = 256, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 1804, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1836, .adv_w = 256, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1864, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1894, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1926, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1951, .adv_w = 256, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1979, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2011, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2043, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2075, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2105, .adv_w = 256, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 2133, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2165, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2197, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2229, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 2259, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2291, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2323, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2355, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 2385, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2417, .adv_w = 256, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 2445, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2475, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2507, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2539, .adv_w = 256, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2567, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2599, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2631, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2663, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2693, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2725, .adv_w = 256, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2753, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2783, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2813, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2843, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2873, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2905, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2937, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2969, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3001, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3033, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3065, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3097, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3129, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3161, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3191, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3223, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3255, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3285, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3317, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3349, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3381, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3413, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3445, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3477, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3507, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3537, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3569, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3601, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3631, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3663, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3695, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3727, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3759, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3789, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3821, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3853, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3885, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3917, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3949, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3981, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4013, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4045, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4077, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4109, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4141, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4173, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4205, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4237, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4269, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4301, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4333, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4365, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4397, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4429, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4461, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4493, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 4523, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4555, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4585, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4617, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4649, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4679, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4711, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4743, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4775, .adv_w = 256, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 4803, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 4833, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 4863, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4895, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4927, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4954, .adv_w = 256, .box_w = 4, .box_h = 17, .ofs_x = 11, .ofs_y = -2},
+    {.bitmap_index = 4963, .adv_w = 256, .box_w = 4, .box_h = 17, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 4972, .adv_w = 256, .box_w = 3, .box_h = 3, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 4974, .adv_w = 256, .box_w = 2, .box_h = 7, .ofs_x = 2, .ofs_y = -1}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_1[] = {
+    0x0, 0xdd, 0x2dda, 0x2ddd, 0x2de3, 0x2de4, 0x2de7, 0x2e07,
+    0x2e0a, 0x2e37, 0x2e3a, 0x2e65, 0x2e66, 0x2e68, 0x2e6b, 0x2e6e,
+    0x2ea4, 0x2f0e, 0x2f29, 0x2f59, 0x2f9d, 0x311f, 0x313f, 0x3142,
+    0x3145, 0x3146, 0x3147, 0x314b, 0x314d, 0x31a0, 0x320a, 0x3275,
+    0x327a, 0x331b, 0x33b1, 0x33bd, 0x33e2, 0x33e6, 0x3412, 0x34ea,
+    0x36b5, 0x36d7, 0x3702, 0x3714, 0x38de, 0x38f0, 0x38f4, 0x38f9,
+    0x3901, 0x3903, 0x3b40, 0x3b66, 0x3b78, 0x3b99, 0x3ba6, 0x3bd3,
+    0x3db8, 0x3e07, 0x3ed4, 0x3edd, 0x3eef, 0x3f5f, 0x4001, 0x40c9,
+    0x40e9, 0x41ea, 0x4211, 0x4227, 0x4259, 0x4297, 0x42e1, 0x437f,
+    0x4381, 0x43a9, 0x4432, 0x4510, 0x4518, 0x451f, 0x45f9, 0x4609,
+    0x464e, 0x46e3, 0x46f9, 0x4709, 0x4714, 0x4bee, 0x4c57, 0x4ebf,
+    0x5045, 0x538a, 0x5502, 0x565e, 0x57ee, 0x5848, 0x5969, 0x59c9,
+    0x5a50, 0x5b00, 0x5b23, 0x5c98, 0x5d09, 0x5e80, 0x5eb7, 0x5f04,
+    0x5f14, 0x5f48, 0x6034, 0x60d7, 0x612e, 0x618d, 0x61ce, 0x6213,
+    0x632c, 0x662a, 0x68af, 0x695b, 0x6b7e, 0x6bdd, 0x6c3b, 0x6cfd,
+    0x6d00, 0x6d5f, 0x6f40, 0x6fa1, 0x6fab, 0x6fb5, 0x6fca, 0x6ff4,
+    0x6ff9, 0x702d, 0x7031, 0x760e, 0x763c, 0x7644, 0x773c, 0x77cd,
+    0x78b8, 0xdee2, 0xdee3, 0xdee6, 0xdef5
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 8230, .range_length = 57078, .glyph_id_start = 96,
+        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 141, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+#if LVGL_VERSION_MAJOR == 8
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+#endif
+
+#if LVGL_VERSION_MAJOR >= 8
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+#else
+static lv_font_fmt_txt_dsc_t font_dsc = {
+#endif
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = 2,
+    .bpp = 1,
+    .kern_classes = 0,
+    .bitmap_format = 0,
+#if LVGL_VERSION_MAJOR == 8
+    .cache = &cache
+#endif
+};
+
+
+
+/*--------------------
+ *  GLYPH INDEX (tools/font_index.py)
+ *--------------------*/
+
+#include "gui_port/gui_font.h"
+
+static const uint8_t index_seeds[] = {
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x2, 0x3, 0x2, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x3, 0x2, 0x6, 0x0, 0x0, 0x5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x2, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x2, 0x0, 0x2,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x3, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x3, 0x2, 0x1, 0x0,
+    0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x2, 0x6, 0x5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x2, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+};
+
+static const uint16_t index_keys[] = {
+    0x0, 0x0, 0x0, 0x7d, 0x0, 0x7ea6, 0x0, 0x5728, 0x0, 0x0, 0x0, 0x21,
+    0x47, 0x5f85, 0x0, 0x0, 0x0, 0x8981, 0x69, 0x0, 0x0, 0x0, 0x624d, 0x0,
+    0x671f, 0x0, 0x7f3a, 0x0, 0x0, 0x5b66, 0x4f, 0x6a, 0x2026, 0x591a, 0x34, 0x0,
+    0x6709, 0x9662, 0x0, 0x60ef, 0x0, 0x73b0, 0x0, 0x0, 0x0, 0x5b9e, 0x7b, 0x0,
+    0x26, 0x0, 0x0, 0x61, 0x98de, 0x0, 0x0, 0x7a, 0x0, 0x706b, 0x63cf, 0x0,
+    0x0, 0x81b3, 0x0, 0x0, 0x0, 0x0, 0x63a7, 0x36, 0x38, 0x6458, 0x56, 0x0,
+    0x57, 0x41, 0x70, 0x0, 0x4f4f, 0x5bcc, 0x6674, 0x0, 0x0, 0x0, 0xff08, 0x0,
+    0x0, 0x0, 0x0, 0x540c, 0x4e5d, 0x71, 0x22, 0x0, 0x5438, 0x0, 0x52a0, 0x0,
+    0x8fd1, 0x0, 0x0, 0x0, 0x43, 0x4e03, 0x0, 0x0, 0x0, 0x0, 0x0, 0x516b,
+    0x30, 0x3d, 0x0, 0x0, 0x6545, 0x0, 0x4e94, 0x0, 0x4f34, 0x0, 0x0, 0x77,
+    0x97f3, 0x0, 0x0, 0x653e, 0x0, 0x0, 0x0, 0x62, 0x0, 0x8352, 0x53, 0x0,
+    0x5bbf, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0x7f6e, 0x0, 0x0,
+    0x40, 0x79, 0x4e91, 0x0, 0x0, 0x8c61, 0x0, 0x0, 0x68, 0x0, 0x5e, 0x0,
+    0x0, 0xff0c, 0x516c, 0x6e, 0xff1b, 0x65, 0x0, 0x0, 0x0, 0x44, 0x73, 0x0,
+    0x78, 0x0, 0x0, 0x0, 0x51, 0x6210, 0x0, 0x591f, 0x7528, 0x0, 0x0, 0x0,
+    0x5f03, 0x0, 0x0, 0x0, 0x661f, 0x0, 0x4e0a, 0x66, 0x4a, 0x0, 0x0, 0x0,
+    0x6307, 0x0, 0x0, 0x0, 0x0, 0x50, 0x0, 0x4e8c, 0x0, 0x5dde, 0x673a, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x516d, 0x4f7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5904,
+    0x0, 0x59, 0x75, 0x0, 0x0, 0x0, 0x2b, 0x0, 0x0, 0x0, 0x3b, 0x52,
+    0x0, 0x0, 0x0, 0x32, 0x901f, 0x0, 0x0, 0x6237, 0x0, 0x0, 0x5bf9, 0x8ba4,
+    0x5929, 0x0, 0x0, 0x0, 0x8fdb, 0x0, 0x5b, 0x0, 0x0, 0x8ff0, 0x0, 0x0,
+    0x7f2a, 0x67, 0x4e, 0x0, 0x8d23, 0x0, 0x5510, 0x0, 0x786e, 0x0, 0x5145, 0x0,
+    0x3c, 0x7a76, 0x6c14, 0x58, 0x0, 0x62bd, 0x610f, 0x64, 0x6027, 0x72, 0x0, 0x42,
+    0x0, 0x4e0d, 0x0, 0x0, 0x805a, 0x0, 0x0, 0x0, 0x28, 0x0, 0x0, 0x0,
+    0x0, 0x3a, 0x0, 0x0, 0x7684, 0x0, 0x0, 0x4fc3, 0x0, 0x7d2f, 0x5f, 0x0,
+    0x0, 0x3e, 0x0, 0x5e2d, 0x49, 0x81f4, 0x4eca, 0x0, 0x0, 0x0, 0x0, 0x6c7d,
+    0x0, 0x0, 0x80fd, 0x0, 0x5168, 0x0, 0x5341, 0x798f, 0x9053, 0x0, 0x0, 0x0,
+    0x0, 0x55, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x8d85, 0x627f, 0x0,
+    0x3f, 0x8f66, 0x7b49, 0x45, 0x2e, 0x2a, 0x4e2d, 0x0, 0x6536, 0x0, 0x0, 0x27,
+    0x0, 0x0, 0x53e3, 0x0, 0x37, 0x0, 0x0, 0x4b, 0x0, 0x4e30, 0x29, 0x4c,
+    0x0, 0x63a5, 0x0, 0x5171, 0x0, 0x0, 0x662f, 0x9762, 0x0, 0x4e8b, 0x529b, 0x0,
+    0x31, 0x0, 0x4e00, 0x9057, 0x0, 0x5916, 0x60, 0x74, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4e8e, 0x56fd, 0x0, 0x2c, 0x56db, 0x54, 0x0, 0x4e09, 0x8154, 0x6ee5,
+    0x0, 0x0, 0x0, 0x8fc7, 0x7e, 0x7edd, 0xff09, 0x0, 0x9634, 0x0, 0x0, 0x7b26,
+    0x0, 0x573a, 0x0, 0x0, 0x5efa, 0x0, 0x0, 0x0, 0x5165, 0x63, 0x0, 0x0,
+    0x5f15, 0x2d, 0x0, 0x0, 0x4d, 0x0, 0x0, 0x46, 0x901a, 0x5927, 0x5d, 0x8650,
+    0x0, 0x0, 0x5230, 0x0, 0x0, 0x0, 0x0, 0x0, 0x76, 0x0, 0x24, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5408, 0x5b8c, 0x8c03, 0x35, 0x6b, 0x0, 0x25,
+    0x8239, 0x0, 0x0, 0x672f, 0x0, 0x0, 0x0, 0x5a, 0x0, 0x23, 0x7814, 0x0,
+    0x0, 0x6c, 0x48, 0x8d26, 0x6d, 0x0, 0x0, 0x0, 0x5173, 0x0, 0x0, 0x0,
+    0x0, 0x51c6, 0x0, 0x966a, 0x0, 0x0, 0x7cbe, 0x0, 0x4e60, 0x0, 0x0, 0x0,
+    0x0, 0x33, 0x0, 0x53d7, 0x79ef, 0x0, 0x0, 0x0, 0x88d5, 0x0, 0x39, 0x2103,
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x6f, 0x0, 0x0,
+};
+
+static const uint16_t index_gids[] = {
+    0x0, 0x0, 0x0, 0x5e, 0x0, 0xc5, 0x0, 0x8a, 0x0, 0x0, 0x0, 0x2,
+    0x28, 0x9d, 0x0, 0x0, 0x0, 0xd3, 0x4a, 0x0, 0x0, 0x0, 0xa3, 0x0,
+    0xb2, 0x0, 0xc8, 0x0, 0x0, 0x92, 0x30, 0x4b, 0x60, 0x8e, 0x15, 0x0,
+    0xb1, 0xe4, 0x0, 0x9f, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x94, 0x5c, 0x0,
+    0x7, 0x0, 0x0, 0x42, 0xe8, 0x0, 0x0, 0x5b, 0x0, 0xb8, 0xa9, 0x0,
+    0x0, 0xcd, 0x0, 0x0, 0x0, 0x0, 0xa8, 0x17, 0x19, 0xaa, 0x37, 0x0,
+    0x38, 0x22, 0x51, 0x0, 0x72, 0x96, 0xb0, 0x0, 0x0, 0x0, 0xe9, 0x0,
+    0x0, 0x0, 0x0, 0x85, 0x69, 0x52, 0x3, 0x0, 0x86, 0x0, 0x80, 0x0,
+    0xdc, 0x0, 0x0, 0x0, 0x24, 0x63, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78,
+    0x11, 0x1e, 0x0, 0x0, 0xad, 0x0, 0x6f, 0x0, 0x71, 0x0, 0x0, 0x58,
+    0xe7, 0x0, 0x0, 0xac, 0x0, 0x0, 0x0, 0x43, 0x0, 0xd0, 0x34, 0x0,
+    0x95, 0x0, 0x5d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xc9, 0x0, 0x0,
+    0x21, 0x5a, 0x6e, 0x0, 0x0, 0xd6, 0x0, 0x0, 0x49, 0x0, 0x3f, 0x0,
+    0x0, 0xeb, 0x79, 0x4f, 0xec, 0x46, 0x0, 0x0, 0x0, 0x25, 0x54, 0x0,
+    0x59, 0x0, 0x0, 0x0, 0x32, 0xa1, 0x0, 0x8f, 0xba, 0x0, 0x0, 0x0,
+    0x9b, 0x0, 0x0, 0x0, 0xae, 0x0, 0x65, 0x47, 0x2b, 0x0, 0x0, 0x0,
+    0xa6, 0x0, 0x0, 0x0, 0x0, 0x31, 0x0, 0x6c, 0x0, 0x98, 0xb4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7a, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8c,
+    0x0, 0x3a, 0x56, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x1c, 0x33,
+    0x0, 0x0, 0x0, 0x13, 0xe0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x97, 0xd4,
+    0x91, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x3c, 0x0, 0x0, 0xde, 0x0, 0x0,
+    0xc7, 0x48, 0x2f, 0x0, 0xd7, 0x0, 0x87, 0x0, 0xbd, 0x0, 0x75, 0x0,
+    0x1d, 0xc0, 0xb5, 0x39, 0x0, 0xa5, 0xa0, 0x45, 0x9e, 0x53, 0x0, 0x23,
+    0x0, 0x66, 0x0, 0x0, 0xca, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0x0, 0x0, 0xbb, 0x0, 0x0, 0x74, 0x0, 0xc4, 0x40, 0x0,
+    0x0, 0x1f, 0x0, 0x99, 0x2a, 0xce, 0x70, 0x0, 0x0, 0x0, 0x0, 0xb6,
+    0x0, 0x0, 0xcb, 0x0, 0x77, 0x0, 0x81, 0xbe, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0xd9, 0xa4, 0x0,
+    0x20, 0xda, 0xc2, 0x26, 0xf, 0xb, 0x67, 0x0, 0xab, 0x0, 0x0, 0x8,
+    0x0, 0x0, 0x83, 0x0, 0x18, 0x0, 0x0, 0x2c, 0x0, 0x68, 0xa, 0x2d,
+    0x0, 0xa7, 0x0, 0x7b, 0x0, 0x0, 0xaf, 0xe6, 0x0, 0x6b, 0x7f, 0x0,
+    0x12, 0x0, 0x62, 0xe2, 0x0, 0x8d, 0x41, 0x55, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6d, 0x89, 0x0, 0xd, 0x88, 0x35, 0x0, 0x64, 0xcc, 0xb7,
+    0x0, 0x0, 0x0, 0xdb, 0x5f, 0xc6, 0xea, 0x0, 0xe3, 0x0, 0x0, 0xc1,
+    0x0, 0x8b, 0x0, 0x0, 0x9a, 0x0, 0x0, 0x0, 0x76, 0x44, 0x0, 0x0,
+    0x9c, 0xe, 0x0, 0x0, 0x2e, 0x0, 0x0, 0x27, 0xdf, 0x90, 0x3e, 0xd1,
+    0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x57, 0x0, 0x5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x84, 0x93, 0xd5, 0x16, 0x4c, 0x0, 0x6,
+    0xcf, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0x3b, 0x0, 0x4, 0xbc, 0x0,
+    0x0, 0x4d, 0x29, 0xd8, 0x4e, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0,
+    0x0, 0x7d, 0x0, 0xe5, 0x0, 0x0, 0xc3, 0x0, 0x6a, 0x0, 0x0, 0x0,
+    0x0, 0x14, 0x0, 0x82, 0xbf, 0x0, 0x0, 0x0, 0xd2, 0x0, 0x1a, 0x61,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x50, 0x0, 0x0,
+};
+
+static const gui_font_index_t glyph_index = {
+    .size_mask = 511,
+    .bucket_mask = 127,
+    .seeds = index_seeds,
+    .keys = index_keys,
+    .gids = index_gids,
+};
+
+/* GLYPH INDEX END */
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+#if LVGL_VERSION_MAJOR >= 8
+const lv_font_t ui_font_ChineseSong16 = {
+#else
+lv_font_t ui_font_ChineseSong16 = {
+#endif
+    .get_glyph_dsc = gui_font_get_glyph_dsc_indexed,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = gui_font_get_bitmap_indexed,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 17,          /*The maximum line height required by the font*/
+    .base_line = 2,             /*Baseline measured from the bottom of the line*/
+#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
+    .subpx = LV_FONT_SUBPX_NONE,
+#endif
+#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
+    .underline_position = -1,
+    .underline_thickness = 1,
+#endif
+    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
+    .fallback = NULL,
+#endif
+    .user_data = (void *)&glyph_index,
+};
+
+
+
+#endif /*#if UI_FONT_CHINESESONG16_1BPP*/
+
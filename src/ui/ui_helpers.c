@@ -4,6 +4,7 @@
 // Project name: SquareLine_Project
 
 #include "ui_helpers.h"
+#include "system/PageBridge.h"
 
 void _ui_bar_set_property(lv_obj_t * target, int id, int val)
 {
@@ -51,9 +52,8 @@ void _ui_slider_set_property(lv_obj_t * target, int id, int val)
 
 void _ui_screen_change(lv_obj_t ** target, lv_scr_load_anim_t fademode, int spd, int delay, void (*target_init)(void))
 {
-    if(*target == NULL)
-        target_init();
-    lv_scr_load_anim(*target, fademode, spd, delay, false);
+    // 页面的构建、复用与淘汰统一交给 PageManager 的页面缓存
+    page_show_screen(target, fademode, spd, delay, target_init);
 }
 
 void _ui_screen_delete(lv_obj_t ** target)
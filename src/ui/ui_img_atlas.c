@@ -0,0 +1,134 @@
+// Generated by tools/img_atlas.py, do not edit
+// Sources: ui_img_back_png.c ui_img_qr_png.c ui_img_setting_png.c ui_img_time_png.c ui_img_weather_png.c
+
+#include "ui_img_atlas.h"
+
+static const uint8_t atlas_bitmap[] = {
+    0x00,0x00,0x03,0xFF,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x1F,0xFE,0x00,0x00,0x00,0xFF,0xFF,0x80,0x1F,0xFF,0xC3,0xFF,0xFF,0xFC,0x00,0x00,
+    0x00,0x0F,0xFF,0xC0,0x00,0x00,0x00,0x30,0x00,0x30,0x00,0x00,0x00,0x00,0x01,0xFF,
+    0xFF,0xE0,0x00,0x03,0xFF,0xFF,0xE0,0x7F,0xFF,0xF2,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x0F,0xFF,0xC0,0x00,0x00,0x00,0x38,0x00,0x30,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,
+    0xF8,0x00,0x07,0xFF,0xFF,0xF0,0xFF,0xFF,0xFA,0x00,0x00,0x04,0x00,0x00,0x00,0x0F,
+    0xFF,0xC0,0x00,0x00,0x00,0x18,0x00,0x70,0x00,0x00,0x00,0x00,0x1F,0xFF,0xFF,0xFE,
+    0x00,0x07,0x00,0x00,0xF0,0xE0,0x00,0x3A,0x00,0x00,0x04,0x00,0x00,0x00,0x0F,0xFF,
+    0xC0,0x00,0x00,0x00,0x1C,0x00,0x60,0x00,0x00,0x00,0x00,0x3F,0xE0,0x01,0xFF,0x00,
+    0x07,0x00,0x00,0x70,0xE0,0x00,0x3A,0x00,0x00,0x04,0x00,0x00,0x00,0x0F,0x03,0xC0,
+    0x00,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x3F,0xC0,0x0E,
+    0x00,0x00,0x31,0xC0,0x00,0x1E,0x00,0x00,0x04,0x00,0x00,0x00,0x1F,0x03,0xE0,0x00,
+    0x00,0x00,0x0C,0x00,0x40,0x00,0x00,0x00,0x01,0xFC,0x00,0x00,0x0F,0xE0,0x0E,0x00,
+    0x00,0x31,0xC0,0x00,0x1E,0x00,0x00,0x04,0x00,0x00,0x00,0x1F,0x03,0xE0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xF0,0x00,0x00,0x03,0xF0,0x0E,0x00,0x00,
+    0x31,0xC0,0x00,0x1E,0x00,0x00,0x04,0x00,0x00,0x00,0x7F,0x03,0xF8,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE0,0x00,0x00,0x01,0xF8,0x0E,0x00,0x00,0x31,
+    0xC0,0x00,0x1E,0x00,0x80,0x04,0x00,0x03,0x81,0xFE,0x03,0xFE,0x07,0x00,0x00,0x01,
+    0xFE,0x00,0x00,0x00,0x00,0x0F,0xC0,0x00,0x00,0x00,0xFC,0x0E,0x00,0x00,0x31,0xC0,
+    0x00,0x1E,0x01,0x80,0x04,0x00,0x07,0xF3,0xFE,0x01,0xFF,0x3F,0x80,0x00,0x07,0xFF,
+    0x80,0x00,0x00,0x00,0x1F,0x80,0x00,0xC0,0x00,0x7E,0x0E,0x00,0x00,0x31,0xC0,0x00,
+    0x1E,0x03,0x00,0x04,0x00,0x0F,0xFF,0xF8,0x00,0x7F,0xFF,0xC0,0x00,0x1F,0xFF,0xE0,
+    0x00,0x00,0x00,0x3F,0x00,0x01,0xE0,0x00,0x3F,0x0E,0x00,0x00,0x31,0xC0,0x00,0x1E,
+    0x06,0x00,0x00,0x00,0x0F,0xFF,0xE0,0x00,0x1F,0xFF,0xC3,0x80,0x3E,0x01,0xF0,0x07,
+    0x00,0x00,0x3E,0x00,0x01,0xE0,0x00,0x1F,0x0E,0x00,0x00,0x31,0xC0,0x00,0x1E,0x0C,
+    0x00,0x00,0x00,0x1F,0xFF,0x80,0x00,0x07,0xFF,0xE3,0xF0,0x78,0x00,0x78,0x1F,0x00,
+    0x00,0x7C,0x00,0x01,0xE0,0x00,0x0F,0x8E,0x00,0x00,0x31,0xC0,0x00,0x1E,0x1F,0xFF,
+    0xFF,0xC0,0x3F,0x7F,0x00,0x00,0x03,0xFB,0xF0,0xF8,0x70,0x00,0x38,0x3E,0x00,0x00,
+    0x78,0x00,0x01,0xE0,0x00,0x07,0x8E,0x00,0x00,0x31,0xC0,0x00,0x1E,0x1F,0xFF,0xFF,
+    0xC0,0x3E,0x0E,0x00,0x00,0x01,0xC1,0xF0,0x30,0xE0,0x00,0x1C,0x38,0x00,0x00,0xF8,
+    0x00,0x01,0xE0,0x00,0x07,0xCE,0x00,0x00,0x31,0xC0,0x00,0x1E,0x0C,0x00,0x00,0x00,
+    0x7E,0x00,0x00,0x00,0x00,0x01,0xF8,0x01,0xC0,0x00,0x0C,0x00,0x00,0x00,0xF0,0x00,
+    0x01,0xE0,0x00,0x03,0xCE,0x00,0x00,0x31,0xC0,0x00,0x1E,0x06,0x00,0x00,0x00,0x7C,
+    0x00,0x03,0xFF,0x00,0x00,0xF8,0x01,0xC0,0x00,0x0E,0x00,0x00,0x01,0xF0,0x00,0x01,
+    0xE0,0x00,0x03,0xEE,0x00,0x00,0x31,0xC0,0x00,0x1E,0x03,0x00,0x04,0x00,0x7C,0x00,
+    0x07,0xFF,0x80,0x00,0xF8,0x01,0x80,0x00,0x0E,0x00,0x00,0x01,0xE0,0x00,0x01,0xE0,
+    0x00,0x01,0xE7,0x00,0x00,0x70,0xE0,0x00,0x3A,0x01,0x80,0x04,0x00,0xFC,0x00,0x1F,
+    0xFF,0xE0,0x00,0xFC,0x01,0x80,0x00,0x06,0x00,0x00,0x01,0xE0,0x00,0x01,0xE0,0x00,
+    0x01,0xE7,0x00,0x00,0x70,0xF0,0x00,0x7A,0x00,0x80,0x04,0x00,0x7F,0x00,0x3F,0xFF,
+    0xF0,0x03,0xF8,0x03,0x80,0x00,0x06,0x00,0x00,0x03,0xE0,0x00,0x01,0xE0,0x00,0x01,
+    0xF7,0xFF,0xFF,0xF0,0x7F,0xFF,0xF2,0x00,0x00,0x04,0x00,0x3F,0x80,0x3E,0x01,0xF0,
+    0x07,0xF0,0x03,0x80,0x00,0x07,0x00,0x00,0x03,0xC0,0x00,0x01,0xE0,0x00,0x00,0xF3,
+    0xFF,0xFF,0xE0,0x3F,0xFF,0xE2,0x00,0x00,0x04,0x00,0x1F,0xC0,0x7C,0x00,0xF8,0x0F,
+    0xE0,0x01,0x80,0x00,0x07,0x00,0x00,0x03,0xC0,0x00,0x01,0xE0,0x00,0x00,0xF1,0xFF,
+    0xFF,0x80,0x0F,0xFF,0x82,0x00,0x00,0x04,0x00,0x0F,0xC0,0x78,0x00,0x78,0x0F,0xC0,
+    0x01,0x80,0x00,0x7F,0xF0,0x00,0x03,0xC0,0x00,0x01,0xE0,0x00,0x00,0xF0,0x00,0x00,
+    0x00,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x07,0xC0,0xF8,0x00,0x7C,0x0F,0x80,0x01,
+    0xC0,0x01,0xFF,0xFC,0x00,0x03,0xC0,0x00,0x01,0xE0,0x00,0x00,0xF0,0x00,0x00,0x00,
+    0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x07,0xC0,0xF0,0x00,0x3C,0x0F,0x80,0x01,0xC0,
+    0x03,0xE0,0x3F,0x00,0x03,0xC0,0x00,0x01,0xE0,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,
+    0x00,0x02,0x00,0x00,0x04,0x00,0x07,0xC0,0xF0,0x00,0x3C,0x0F,0x80,0x10,0xC0,0x07,
+    0x80,0x07,0x80,0x03,0xC0,0x00,0x01,0xF0,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x04,0x00,0x07,0xC0,0xF0,0x00,0x3C,0x0F,0x80,0xF8,0xE0,0x0E,0x00,
+    0x03,0xC0,0x03,0xC0,0x00,0x01,0xFC,0x00,0x00,0xF1,0xFF,0xFF,0x80,0x00,0x00,0x03,
+    0xFF,0xFF,0xFC,0x00,0x07,0xC0,0xF0,0x00,0x3C,0x0F,0x83,0xF0,0x70,0x1C,0x00,0x00,
+    0xE0,0x03,0xC0,0x00,0x01,0xFF,0x00,0x00,0xF3,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x07,0xC0,0xF0,0x00,0x3C,0x0F,0x83,0xC0,0x38,0x38,0x00,0x00,0xF0,
+    0x03,0xC0,0x00,0x00,0x7F,0xC0,0x00,0xF7,0xFF,0xFF,0xE0,0x30,0x60,0xC0,0x00,0x00,
+    0x00,0x00,0x07,0xC0,0xF8,0x00,0x78,0x0F,0x80,0x00,0x3F,0xB8,0x00,0x00,0x70,0x03,
+    0xC0,0x00,0x00,0x1F,0xF0,0x00,0xF7,0x00,0x00,0xF0,0x78,0xF1,0xE0,0x00,0x00,0x00,
+    0x00,0x07,0xC0,0x78,0x00,0x78,0x0F,0x80,0x00,0x7F,0xF0,0x00,0x00,0x38,0x03,0xC0,
+    0x00,0x00,0x07,0xF8,0x00,0xFE,0x00,0x00,0x70,0x78,0xF1,0xE0,0x00,0x00,0x00,0x00,
+    0x0F,0xC0,0x7C,0x00,0xF8,0x0F,0xC0,0x00,0xF1,0xE0,0x00,0x00,0x38,0x03,0xC0,0x00,
+    0x00,0x01,0xFC,0x00,0xFE,0x00,0x00,0x70,0x70,0xF1,0xE0,0x00,0x00,0x00,0x00,0x1F,
+    0xC0,0x3F,0x03,0xF0,0x0F,0xE0,0x00,0xE0,0x60,0x00,0x00,0x18,0x03,0xE0,0x00,0x00,
+    0x00,0x78,0x01,0xFE,0x00,0x00,0x70,0x20,0xF1,0xE0,0x00,0x00,0x00,0x00,0x3F,0x80,
+    0x1F,0xFF,0xE0,0x07,0xF0,0x01,0xC0,0x60,0x00,0x00,0x1C,0x01,0xE0,0x00,0x00,0x00,
+    0x00,0x01,0xEE,0x00,0x00,0x70,0x00,0xF0,0xE0,0x00,0x00,0x00,0x00,0x7F,0x00,0x0F,
+    0xFF,0xC0,0x03,0xF8,0x01,0xC0,0x00,0x00,0x00,0x1C,0x01,0xE0,0x00,0x00,0x00,0x00,
+    0x01,0xEE,0x00,0x00,0x70,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x07,0xFF,
+    0x80,0x01,0xFC,0x01,0x80,0x00,0x00,0x00,0x1C,0x01,0xF0,0x00,0x00,0x00,0x00,0x03,
+    0xEE,0x00,0x00,0x70,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x01,0xFE,0x00,
+    0x00,0xF8,0x07,0xC0,0x00,0x00,0x00,0x1F,0x80,0xF0,0x00,0x00,0x00,0x00,0x03,0xCE,
+    0x00,0x00,0x70,0x30,0x70,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,
+    0xF8,0x1F,0x80,0x00,0x00,0x00,0x0F,0xC0,0xF8,0x00,0x00,0x00,0x00,0x07,0xCE,0x00,
+    0x00,0x70,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x01,0xF8,
+    0x3E,0x00,0x00,0x00,0x00,0x01,0xE0,0x78,0x00,0x00,0x00,0x00,0x07,0x8E,0x00,0x00,
+    0x70,0x78,0x00,0xE0,0x00,0x00,0x00,0x00,0x3E,0x0E,0x00,0x00,0x01,0xC1,0xF0,0x78,
+    0x00,0x00,0x00,0x00,0x00,0x70,0x7C,0x00,0x00,0x00,0x00,0x0F,0x8E,0x00,0x00,0x70,
+    0x78,0x61,0xE0,0x00,0x00,0x00,0x00,0x3F,0x7F,0x00,0x00,0x03,0xF3,0xF0,0x70,0x00,
+    0x00,0x00,0x00,0x00,0x38,0x3E,0x00,0x00,0x00,0x00,0x1F,0x0E,0x00,0x00,0x70,0x78,
+    0xF1,0xE0,0x00,0x00,0x00,0x00,0x1F,0xFF,0x80,0x00,0x07,0xFF,0xE0,0xE0,0x00,0x00,
+    0x00,0x00,0x00,0x38,0x3F,0x00,0x00,0x00,0x00,0x3F,0x0E,0x00,0x00,0x70,0x78,0xF1,
+    0xE0,0x00,0x00,0x00,0x00,0x0F,0xFF,0xE0,0x00,0x1F,0xFF,0xC0,0xE0,0x00,0x00,0x00,
+    0x00,0x00,0x1C,0x1F,0x80,0x00,0x00,0x00,0x7E,0x0E,0x00,0x00,0x70,0x78,0xF1,0xE0,
+    0x00,0x00,0x00,0x00,0x0F,0xFF,0xF8,0x00,0x7F,0xFF,0xC0,0xC0,0x00,0x00,0x00,0x00,
+    0x00,0x1C,0x0F,0xC0,0x00,0x00,0x00,0xFC,0x06,0x00,0x00,0x70,0x78,0xF1,0xE0,0x00,
+    0x00,0x00,0x00,0x07,0xF3,0xFE,0x01,0xFF,0x3F,0x80,0xC0,0x00,0x00,0x00,0x00,0x00,
+    0x1C,0x07,0xE0,0x00,0x00,0x01,0xF8,0x07,0x00,0x00,0xE0,0x70,0x70,0xE0,0x00,0x00,
+    0x00,0x00,0x03,0x81,0xFE,0x03,0xFE,0x07,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x1C,
+    0x03,0xF0,0x00,0x00,0x03,0xF0,0x07,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x7F,0x03,0xF8,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x1C,0x01,
+    0xFC,0x00,0x00,0x0F,0xE0,0x03,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x1F,0x03,0xE0,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0xFF,
+    0x00,0x00,0x3F,0xC0,0x01,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x1F,0x03,0xE0,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x7F,0xE0,
+    0x01,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x0F,0x03,0xC0,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x1F,0xFF,0xFF,
+    0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,
+    0x87,0xC0,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x07,0xFF,0xFF,0xF8,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,
+    0xC0,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x01,0xFF,0xFF,0xE0,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xC0,
+    0x00,0x00,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x3F,0xFF,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xC0,0x00,
+    0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0x00,0x00,0x00,
+    0x01,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+// x, y, w, h (atlas sub-rect), ofs_x, ofs_y, full_w, full_h (original icon)
+static const gui_atlas_sprite_t atlas_sprites[] = {
+    [UI_ICON_BACK] = { 214, 0, 28, 28, 2, 2, 32, 32 },
+    [UI_ICON_QR] = { 164, 0, 50, 49, 7, 7, 64, 64 },
+    [UI_ICON_SETTING] = { 0, 0, 54, 56, 5, 4, 64, 64 },
+    [UI_ICON_TIME] = { 110, 0, 54, 54, 5, 5, 64, 64 },
+    [UI_ICON_WEATHER] = { 54, 0, 56, 56, 4, 4, 64, 64 },
+};
+
+const gui_atlas_t ui_icon_atlas = {
+    .bitmap = atlas_bitmap,
+    .w = 242,
+    .h = 56,
+    .stride = 31,
+    .count = UI_ICON_COUNT,
+    .sprites = atlas_sprites,
+};
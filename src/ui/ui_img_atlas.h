@@ -0,0 +1,27 @@
+// Generated by tools/img_atlas.py, do not edit
+
+#ifndef UI_IMG_ATLAS_H
+#define UI_IMG_ATLAS_H
+
+#include "gui_port/gui_atlas.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    UI_ICON_BACK,
+    UI_ICON_QR,
+    UI_ICON_SETTING,
+    UI_ICON_TIME,
+    UI_ICON_WEATHER,
+    UI_ICON_COUNT
+} ui_icon_t;
+
+extern const gui_atlas_t ui_icon_atlas;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_IMG_ATLAS_H
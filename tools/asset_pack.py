@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file asset_pack.py
+@brief 生成资源包 (EPA1)，烧录到 assets 分区，由 gui_pack 内存映射后直接使用
+
+图片和字体编译进固件时，改一个图标也要重新烧录整个固件。资源包放在独立的 assets 分区，
+固件启动时用 esp_partition_mmap 映射整个包，LVGL 图片描述符的 data 直接指向映射后的 flash，
+不拷贝到 RAM；包内的 EPF1 字体 (tools/font_pack.py) 也按映射地址直接取字形。
+资源包可以单独烧录，与固件版本无关 (按名称查找，包内没有的资源继续使用固件内置版本)。
+
+资源包格式 (小端，全部偏移相对包起始，数据 4 字节对齐):
+    头部 (32 B)
+        char     magic[4]      "EPA1"
+        uint16   version       1
+        uint16   count         条目数
+        uint32   index_offset  索引偏移
+        uint32   image_size    包总字节数
+        uint32   build         打包时间 (unix 时间戳，仅用于日志)
+        uint32   crc32         [32, image_size) 的 CRC-32 (与 zlib.crc32 相同)
+        uint8    reserved[8]
+    索引: count x 32 B
+        char     name[16]      名称 (NUL 填充，如 "back"、"font")
+        uint8    fmt           0: 原始数据  1: 1bit 图片 (ALPHA_1BIT)
+                               2: 游程压缩 1bit 图片 (tools/img_rle.py)  3: EPF1 字体
+        uint8    reserved
+        uint16   w, h          图片尺寸 (其他格式为 0)
+        uint16   reserved
+        uint32   offset
+        uint32   size
+
+输入:
+    *.c     tools/img_1bpp.py / img_rle.py 处理过的图片，名称取自符号名 (ui_img_back_png -> back)，
+            默认以游程压缩格式存储 (--no-rle 存未压缩 1bit，绘制时不需要解码)
+    *.epf   EPF1 字体镜像，名称默认 "font"
+    其他    原始数据，名称为去掉扩展名的文件名
+    name=path 可指定名称
+
+用法:
+    python tools/asset_pack.py src/ui/ui_img_*_png.c build/font.epf -o build/assets.bin
+    esptool.py --chip esp32s3 write_flash 0xE90000 build/assets.bin   # 地址见 partitions.csv 的 assets 分区
+"""
+import argparse
+import os
+import struct
+import sys
+import time
+import zlib
+
+import img_atlas
+import img_rle
+
+MAGIC = b"EPA1"
+HEADER_FMT = "<4sHHIIII8x"
+ENTRY_FMT = "<16sBBHHHII"
+HEADER_SIZE = struct.calcsize(HEADER_FMT)
+ENTRY_SIZE = struct.calcsize(ENTRY_FMT)
+
+FMT_RAW, FMT_1BIT, FMT_RLE, FMT_EPF1 = 0, 1, 2, 3
+FMT_NAMES = {FMT_RAW: "raw", FMT_1BIT: "1bit", FMT_RLE: "rle", FMT_EPF1: "epf1"}
+
+
+def load_entry(spec, rle):
+    """返回 (名称, fmt, w, h, 数据)"""
+    name, path = spec.split("=", 1) if "=" in spec else (None, spec)
+    ext = os.path.splitext(path)[1].lower()
+
+    if ext == ".c":
+        icon, w, h, rows = img_atlas.load_1bit(path)
+        if rle:
+            return name or icon, FMT_RLE, w, h, img_rle.encode(w, h, rows)
+        stride = (w + 7) // 8
+        data = bytearray(stride * h)
+        for y, row in enumerate(rows):
+            for x, v in enumerate(row):
+                if v:
+                    data[y * stride + x // 8] |= 0x80 >> (x % 8)
+        return name or icon, FMT_1BIT, w, h, bytes(data)
+
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] == b"EPF1":
+        return name or "font", FMT_EPF1, 0, 0, data
+    return name or os.path.splitext(os.path.basename(path))[0], FMT_RAW, 0, 0, data
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Build an EPA1 asset pack for the assets partition")
+    ap.add_argument("inputs", nargs="+", help="image .c / font .epf / raw files, optionally name=path")
+    ap.add_argument("-o", "--out", default="assets.bin")
+    ap.add_argument("--no-rle", action="store_true", help="store images as plain 1-bit")
+    ap.add_argument("--max-size", type=lambda s: int(s, 0), default=0x160000, help="partition size (default 0x160000)")
+    args = ap.parse_args()
+
+    entries = [load_entry(spec, not args.no_rle) for spec in args.inputs]
+    names = [e[0] for e in entries]
+    for n in names:
+        if len(n.encode()) > 15:
+            sys.exit("name too long (max 15 bytes): %s" % n)
+        if names.count(n) > 1:
+            sys.exit("duplicate name: %s" % n)
+
+    index_offset = HEADER_SIZE
+    pos = index_offset + ENTRY_SIZE * len(entries)
+    index = bytearray()
+    body = bytearray()
+    for name, fmt, w, h, data in entries:
+        pad = (-pos) % 4
+        body += b"\0" * pad
+        pos += pad
+        index += struct.pack(ENTRY_FMT, name.encode(), fmt, 0, w, h, 0, pos, len(data))
+        body += data
+        pos += len(data)
+
+    image_size = pos
+    payload = bytes(index) + bytes(body)
+    header = struct.pack(HEADER_FMT, MAGIC, 1, len(entries), index_offset, image_size,
+                         int(time.time()), zlib.crc32(payload) & 0xFFFFFFFF)
+
+    if image_size > args.max_size:
+        sys.exit("pack %d B exceeds partition size %d B" % (image_size, args.max_size))
+    with open(args.out, "wb") as f:
+        f.write(header + payload)
+
+    for name, fmt, w, h, data in entries:
+        print("  %-15s %-4s %s %7d B" % (name, FMT_NAMES[fmt], ("%dx%d" % (w, h)).ljust(7) if w else " " * 7, len(data)))
+    print("%s: %d entries, %d B (%.1f%% of partition)" % (args.out, len(entries), image_size,
+                                                           100.0 * image_size / args.max_size))
+
+
+if __name__ == "__main__":
+    main()
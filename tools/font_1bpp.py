@@ -0,0 +1,295 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file font_1bpp.py
+@brief 把 lv_font_conv 生成的 4bpp 字体 (.c) 转换为 1bpp 字体
+
+墨水屏只有黑白两色。4bpp 抗锯齿字体在 LVGL 中按 16bit 混合后，
+disp_flush 又把所有非纯白像素当作黑色，边缘的浅灰像素全部变黑，笔画发粗发糊。
+本工具在构建前完成二值化，生成的 1bpp 字体由 gui_font 的快速字形绘制路径直接写像素。
+
+二值化规则 ("笔画保留")：
+1. 覆盖率 >= --threshold (默认 8/15) 的像素为黑。
+2. 细笔画可能整条落在两个像素之间，每个像素的覆盖率都低于阈值，直接二值化会断笔。
+   对每个水平/垂直方向的连续灰度段 (覆盖率 >= --stem-min)，若段内没有任何黑像素，
+   则把段内覆盖率最大的像素置黑，保证笔画连续且只有 1 像素宽。
+
+用法:
+    python tools/font_1bpp.py src/ui/ui_font_ChineseSong16.c -o src/ui/ui_font_ChineseSong16_1bpp.c
+    python tools/font_1bpp.py src/ui/ui_font_ChineseSong16.c --golden build/golden --text "今天是星期一 12℃"
+
+重新生成后需再执行 tools/font_index.py 添加字形索引。
+生成的字体与 4bpp 版本同名 (如 ui_font_ChineseSong16)，页面代码无需修改；
+两者由开关宏二选一编译 (见 platformio.ini 的 build_flags)。
+
+--golden 在主机上输出对比图 (PBM)：
+    <name>_4bpp.pbm  4bpp 字体经 disp_flush 规则 (非纯白即黑) 显示的效果 (现状)
+    <name>_1bpp.pbm  转换后的 1bpp 字体
+    <name>_ref.pbm   4bpp 按 50% 阈值二值化 (参考)
+并输出与参考图的差异像素数。
+"""
+import argparse
+import os
+import re
+import sys
+
+GLYPH_RE = re.compile(
+    r"\{\.bitmap_index\s*=\s*(\d+),\s*\.adv_w\s*=\s*(\d+),\s*\.box_w\s*=\s*(\d+),\s*"
+    r"\.box_h\s*=\s*(\d+),\s*\.ofs_x\s*=\s*(-?\d+),\s*\.ofs_y\s*=\s*(-?\d+)\}")
+
+
+def parse_cmap(src):
+    """解析字体源码中的 cmaps (支持 FORMAT0_TINY 与 SPARSE_TINY)，得到 unicode -> glyph id"""
+    lists = {}
+    for name, body in re.findall(r"static const uint16_t (unicode_list_\d+)\[\]\s*=\s*\{(.*?)\};", src, re.S):
+        lists[name] = [int(x, 16) for x in re.findall(r"0x[0-9a-fA-F]+", body)]
+    cmap = {}
+    for start, length, gid, ulist, kind in re.findall(
+            r"\.range_start\s*=\s*(\d+),\s*\.range_length\s*=\s*(\d+),\s*\.glyph_id_start\s*=\s*(\d+),\s*"
+            r"\.unicode_list\s*=\s*(\w+),.*?\.type\s*=\s*(\w+)", src, re.S):
+        start, length, gid = int(start), int(length), int(gid)
+        if kind.endswith("FORMAT0_TINY"):
+            for i in range(length):
+                cmap[start + i] = gid + i
+        elif kind.endswith("SPARSE_TINY"):
+            for i, ofs in enumerate(lists[ulist]):
+                cmap[start + ofs] = gid + i
+        else:
+            sys.exit("unsupported cmap type %s" % kind)
+    return cmap
+
+
+class Font:
+    """解析后的 lv_font_conv 字体"""
+
+    def __init__(self, path):
+        self.path = path
+        with open(path, encoding="utf-8") as f:
+            self.src = f.read()
+
+        m = re.search(r"Bpp:\s*(\d+)", self.src)
+        self.bpp = int(m.group(1)) if m else 4
+        if self.bpp != 4:
+            sys.exit("only 4bpp fonts are supported (got %d)" % self.bpp)
+        if "--no-compress" not in self.src:
+            sys.exit("compressed fonts are not supported, regenerate with --no-compress")
+
+        bm = re.search(r"glyph_bitmap\[\]\s*=\s*\{(.*?)\n\};", self.src, re.S)
+        body = re.sub(r"/\*.*?\*/", "", bm.group(1), flags=re.S)
+        self.bitmap = bytes(int(x, 16) for x in re.findall(r"0x[0-9a-fA-F]+", body))
+        self.bitmap_span = bm.span()
+
+        gd = re.search(r"glyph_dsc\[\]\s*=\s*\{(.*?)\n\};", self.src, re.S)
+        self.glyphs = [tuple(int(v) for v in g) for g in GLYPH_RE.findall(gd.group(1))]
+        self.glyph_span = gd.span()
+
+        # 字形 id -> 字符 (用于注释与 --golden)
+        self.names = re.findall(r"/\* (U\+[0-9A-F]+ \".*?\") \*/", bm.group(1))
+        self.line_height = int(re.search(r"\.line_height\s*=\s*(\d+)", self.src).group(1))
+        self.base_line = int(re.search(r"\.base_line\s*=\s*(\d+)", self.src).group(1))
+        self.cmap = parse_cmap(self.src)
+
+    def glyph_4bpp(self, gid):
+        """返回字形的覆盖率矩阵 (0..15)"""
+        index, _, w, h, _, _ = self.glyphs[gid]
+        px = []
+        for i in range(w * h):
+            b = self.bitmap[index + i // 2]
+            px.append(b >> 4 if i % 2 == 0 else b & 0x0F)
+        return [px[r * w:(r + 1) * w] for r in range(h)]
+
+
+def _stem_runs(line, stem_min):
+    """一行 (或一列) 中覆盖率 >= stem_min 的连续段"""
+    runs, start = [], None
+    for i, v in enumerate(line + [0]):
+        if v >= stem_min and start is None:
+            start = i
+        elif v < stem_min and start is not None:
+            runs.append((start, i))
+            start = None
+    return runs
+
+
+def binarize(cov, threshold, stem_min):
+    """覆盖率矩阵 -> 0/1 矩阵 (笔画保留二值化)"""
+    h = len(cov)
+    w = len(cov[0]) if h else 0
+    out = [[1 if v >= threshold else 0 for v in row] for row in cov]
+
+    # 垂直方向扫描行 (保留竖笔画)，水平方向扫描列 (保留横笔画)
+    for y in range(h):
+        for a, b in _stem_runs(cov[y], stem_min):
+            if not any(out[y][a:b]):
+                x = max(range(a, b), key=lambda i: cov[y][i])
+                out[y][x] = 1
+    for x in range(w):
+        col = [cov[y][x] for y in range(h)]
+        for a, b in _stem_runs(col, stem_min):
+            if not any(out[y][x] for y in range(a, b)):
+                y = max(range(a, b), key=lambda i: col[i])
+                out[y][x] = 1
+    return out
+
+
+def pack_1bpp(bits):
+    """按 LVGL 1bpp 格式打包：逐行连续，MSB 在前，行之间不补齐"""
+    flat = [v for row in bits for v in row]
+    data = bytearray()
+    for i in range(0, len(flat), 8):
+        chunk = flat[i:i + 8] + [0] * (8 - len(flat[i:i + 8]))
+        byte = 0
+        for v in chunk:
+            byte = (byte << 1) | v
+        data.append(byte)
+    return bytes(data)
+
+
+def convert(font, threshold, stem_min):
+    """返回 (新位图, 新字形描述列表, 每个字形的 0/1 矩阵)"""
+    bitmap = bytearray()
+    glyphs, bits_all = [], []
+    for gid, (index, adv, w, h, ox, oy) in enumerate(font.glyphs):
+        if w == 0 or h == 0:
+            glyphs.append((len(bitmap) if gid else 0, adv, w, h, ox, oy))
+            bits_all.append([])
+            continue
+        bits = binarize(font.glyph_4bpp(gid), threshold, stem_min)
+        glyphs.append((len(bitmap), adv, w, h, ox, oy))
+        bitmap += pack_1bpp(bits)
+        bits_all.append(bits)
+    return bytes(bitmap), glyphs, bits_all
+
+
+def emit_c(font, bitmap, glyphs, out_path, guard, threshold, stem_min):
+    """生成 1bpp 字体 C 文件 (cmaps 等其余部分原样沿用)"""
+    lines = ["glyph_bitmap[] = {"]  # 匹配范围从数组名开始
+    for gid, (index, _, w, h, _, _) in enumerate(glyphs):
+        if gid == 0:
+            continue
+        name = font.names[gid - 1] if gid - 1 < len(font.names) else "id %d" % gid
+        lines.append("    /* %s */" % name)
+        if not (w and h):
+            lines.append("")
+            continue
+        n = (w * h + 7) // 8
+        chunk = bitmap[index:index + n]
+        for i in range(0, n, 8):
+            lines.append("    " + ", ".join("0x%x" % b for b in chunk[i:i + 8]) + ",")
+        lines.append("")
+    lines.append("};")
+    new_bitmap = "\n".join(lines)
+
+    dsc = ["glyph_dsc[] = {"]
+    for gid, (index, adv, w, h, ox, oy) in enumerate(glyphs):
+        sep = "," if gid + 1 < len(glyphs) else ""
+        note = " /* id = 0 reserved */" if gid == 0 else ""
+        dsc.append("    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d}%s%s"
+                   % (index, adv, w, h, ox, oy, note, sep))
+    dsc.append("};")
+    new_dsc = "\n".join(dsc)
+
+    src = font.src
+    # 先替换后面的块，前面的偏移不变
+    bs, be = font.bitmap_span
+    gs, ge = font.glyph_span
+    src = src[:gs] + new_dsc + src[ge:]
+    src = src[:bs] + new_bitmap + src[be:]
+
+    # 与 4bpp 版本同名 (页面代码无需修改)，两者由各自的开关宏二选一编译
+    old_sym = re.search(r"lv_font_t (\w+) = \{", src).group(1)
+    old_guard = "UI_FONT_" + old_sym[len("ui_font_"):].upper()
+    src = src.replace(old_guard, guard)
+    src = re.sub(r"\.bpp\s*=\s*4,", ".bpp = 1,", src)
+    src = re.sub(r"^ \* Bpp: 4", " * Bpp: 1 (converted by tools/font_1bpp.py, threshold %d/15, stem-min %d/15)"
+                 % (threshold, stem_min), src, count=1, flags=re.M)
+    # 默认不编译，由 build_flags 中的 -D <guard>=1 启用
+    src = src.replace("#ifndef %s\n#define %s 1\n#endif" % (guard, guard),
+                      "#ifndef %s\n#define %s 0\n#endif" % (guard, guard))
+    with open(out_path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(src)
+
+
+def render(font, text, pixel):
+    """按 LVGL 的字形定位规则把一行文字排到位图上 (1 = 黑)"""
+    width = sum((font.glyphs[font.cmap.get(ord(c), 0)][1] + 8) // 16 for c in text) + 2
+    height = font.line_height
+    img = [[0] * width for _ in range(height)]
+    x = 1
+    for c in text:
+        gid = font.cmap.get(ord(c), 0)
+        _, adv, w, h, ox, oy = font.glyphs[gid]
+        gx = x + ox
+        gy = (font.line_height - font.base_line) - h - oy
+        for r in range(h):
+            for col in range(w):
+                if pixel(gid, r, col) and 0 <= gy + r < height and 0 <= gx + col < width:
+                    img[gy + r][gx + col] = 1
+        x += (adv + 8) // 16
+    return img
+
+
+def write_pbm(path, img):
+    with open(path, "w") as f:
+        f.write("P1\n%d %d\n" % (len(img[0]), len(img)))
+        for row in img:
+            f.write(" ".join(str(v) for v in row) + "\n")
+
+
+def golden(font, bits_all, text, out_dir, threshold, name):
+    os.makedirs(out_dir, exist_ok=True)
+    cov = {}
+
+    def cov_of(gid):
+        if gid not in cov:
+            cov[gid] = font.glyph_4bpp(gid)
+        return cov[gid]
+
+    shown = render(font, text, lambda g, r, c: cov_of(g)[r][c] > 0)      # 现状: 非纯白即黑
+    ref = render(font, text, lambda g, r, c: cov_of(g)[r][c] >= 8)       # 参考: 50% 阈值
+    mono = render(font, text, lambda g, r, c: bits_all[g][r][c])         # 1bpp
+
+    def diff(a, b):
+        return sum(1 for ra, rb in zip(a, b) for va, vb in zip(ra, rb) if va != vb)
+
+    def ink(a):
+        return sum(map(sum, a))
+
+    write_pbm(os.path.join(out_dir, name + "_4bpp.pbm"), shown)
+    write_pbm(os.path.join(out_dir, name + "_1bpp.pbm"), mono)
+    write_pbm(os.path.join(out_dir, name + "_ref.pbm"), ref)
+    print("golden: %d x %d px, threshold %d" % (len(ref[0]), len(ref), threshold))
+    print("  4bpp as displayed: ink %5d px, diff vs ref %5d px" % (ink(shown), diff(shown, ref)))
+    print("  1bpp converted   : ink %5d px, diff vs ref %5d px" % (ink(mono), diff(mono, ref)))
+    print("  reference        : ink %5d px" % ink(ref))
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Convert a 4bpp lv_font_conv font to 1bpp for e-paper")
+    ap.add_argument("src", help="4bpp font .c generated by lv_font_conv / SquareLine")
+    ap.add_argument("-o", "--out", help="output .c (default: <src>_1bpp.c)")
+    ap.add_argument("--threshold", type=int, default=8, help="coverage (0-15) that becomes black (default 8)")
+    ap.add_argument("--stem-min", type=int, default=4, help="min coverage for stroke preservation (default 4)")
+    ap.add_argument("--golden", metavar="DIR", help="write comparison images (PBM) to DIR")
+    ap.add_argument("--text", default="今天是星期一 福州 多云 12℃ ABCabc0123", help="text for --golden")
+    args = ap.parse_args()
+
+    font = Font(args.src)
+    bitmap, glyphs, bits_all = convert(font, args.threshold, args.stem_min)
+
+    base = os.path.splitext(os.path.basename(args.src))[0]
+    out = args.out or os.path.join(os.path.dirname(args.src), base + "_1bpp.c")
+    guard = "UI_FONT_" + base[len("ui_font_"):].upper() + "_1BPP"
+    emit_c(font, bitmap, glyphs, out, guard, args.threshold, args.stem_min)
+
+    print("%s: %d glyphs" % (base, len(glyphs) - 1))
+    print("  glyph bitmap 4bpp: %6d B" % len(font.bitmap))
+    print("  glyph bitmap 1bpp: %6d B (%.0f%%)" % (len(bitmap), 100.0 * len(bitmap) / max(1, len(font.bitmap))))
+    print("  written %s (enable with -D %s=1 -D %s=0)" % (out, guard, guard[:-len("_1BPP")]))
+
+    if args.golden:
+        golden(font, bits_all, args.text, args.golden, args.threshold, base)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file font_index.py
+@brief 为 lv_font_conv 字体生成 O(1) 字形索引 (完美哈希)
+
+LVGL 的 SPARSE_TINY cmap 对每个字符做一次二分查找 (ChineseSong16: 141 项，约 8 次比较)，
+字形位图查找 (get_glyph_bitmap) 还要再查一遍。本工具在构建前生成 "哈希 + 位移" 完美哈希表：
+    bucket = mix(c) & bucket_mask
+    slot   = mix(c + (seeds[bucket] + 1) * 0x9E3779B9) & size_mask
+    keys[slot] == c ? gids[slot] : 未收录
+并把字体的 get_glyph_dsc / get_glyph_bitmap 换成 gui_font 中的查表实现，索引挂在 user_data 上。
+mix() 与 src/gui_port/gui_font.cpp 中的 _mix() 必须保持一致。
+
+用法 (原地修改，重复执行会替换上一次生成的索引):
+    python tools/font_1bpp.py src/ui/ui_font_ChineseSong16.c -o src/ui/ui_font_ChineseSong16_1bpp.c
+    python tools/font_index.py src/ui/ui_font_ChineseSong16_1bpp.c
+"""
+import argparse
+import re
+import sys
+
+from font_1bpp import parse_cmap
+
+MASK32 = 0xFFFFFFFF
+BEGIN = "/*--------------------\n *  GLYPH INDEX (tools/font_index.py)\n *--------------------*/\n"
+END = "/* GLYPH INDEX END */\n"
+
+
+def mix(x):
+    """32 位整数混合 (lowbias32)"""
+    x &= MASK32
+    x ^= x >> 16
+    x = (x * 0x7FEB352D) & MASK32
+    x ^= x >> 15
+    x = (x * 0x846CA68B) & MASK32
+    x ^= x >> 16
+    return x
+
+
+def slot_of(c, seed, size_mask):
+    return mix(c + ((seed + 1) * 0x9E3779B9)) & size_mask
+
+
+def build(cmap, load=0.75):
+    """构造完美哈希，返回 (size, buckets, seeds, keys, gids)"""
+    n = len(cmap)
+    size = 1
+    while size < n / load:
+        size <<= 1
+    while True:
+        buckets = max(1, size // 4)
+        groups = [[] for _ in range(buckets)]
+        for c in cmap:
+            groups[mix(c) & (buckets - 1)].append(c)
+
+        keys = [0] * size
+        gids = [0] * size
+        seeds = [0] * buckets
+        ok = True
+        # 大桶先放，成功率最高
+        for b in sorted(range(buckets), key=lambda i: -len(groups[i])):
+            if not groups[b]:
+                continue
+            for seed in range(256):
+                slots = [slot_of(c, seed, size - 1) for c in groups[b]]
+                if len(set(slots)) == len(slots) and all(keys[s] == 0 for s in slots):
+                    for c, s in zip(groups[b], slots):
+                        keys[s] = c
+                        gids[s] = cmap[c]
+                    seeds[b] = seed
+                    break
+            else:
+                ok = False
+                break
+        if ok:
+            return size, buckets, seeds, keys, gids
+        size <<= 1
+
+
+def emit_array(ctype, name, values, per_line=12):
+    out = ["static const %s %s[] = {" % (ctype, name)]
+    for i in range(0, len(values), per_line):
+        out.append("    " + ", ".join("0x%x" % v for v in values[i:i + per_line]) + ",")
+    out.append("};")
+    return "\n".join(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Add an O(1) perfect-hash glyph index to an lv_font_conv font")
+    ap.add_argument("font", help="font .c generated by lv_font_conv (modified in place)")
+    args = ap.parse_args()
+
+    with open(args.font, encoding="utf-8") as f:
+        src = f.read()
+
+    # 去掉上一次生成的索引
+    src = re.sub(re.escape(BEGIN) + r".*?" + re.escape(END) + r"\n?", "", src, flags=re.S)
+
+    cmap = parse_cmap(src)
+    if any(c == 0 or c > 0xFFFF for c in cmap):
+        sys.exit("index supports BMP code points 1..0xFFFF only")
+    size, buckets, seeds, keys, gids = build(cmap)
+
+    block = "\n".join([
+        BEGIN.rstrip("\n"),
+        "",
+        "#include \"gui_port/gui_font.h\"",
+        "",
+        emit_array("uint8_t", "index_seeds", seeds),
+        "",
+        emit_array("uint16_t", "index_keys", keys),
+        "",
+        emit_array("uint16_t", "index_gids", gids),
+        "",
+        "static const gui_font_index_t glyph_index = {",
+        "    .size_mask = %d," % (size - 1),
+        "    .bucket_mask = %d," % (buckets - 1),
+        "    .seeds = index_seeds,",
+        "    .keys = index_keys,",
+        "    .gids = index_gids,",
+        "};",
+        "",
+        END,
+    ])
+
+    # 索引放在 PUBLIC FONT 之前，并替换查找函数
+    marker = "/*-----------------\n *  PUBLIC FONT"
+    if marker not in src:
+        sys.exit("PUBLIC FONT section not found")
+    src = src.replace(marker, block + "\n" + marker, 1)
+    src = re.sub(r"\.get_glyph_dsc = \w+,", ".get_glyph_dsc = gui_font_get_glyph_dsc_indexed,", src)
+    src = re.sub(r"\.get_glyph_bitmap = \w+,", ".get_glyph_bitmap = gui_font_get_bitmap_indexed,", src)
+    src = re.sub(r"\.user_data = [^,]+,", ".user_data = (void *)&glyph_index,", src)
+
+    with open(args.font, "w", encoding="utf-8", newline="\n") as f:
+        f.write(src)
+
+    table = size * 4 + buckets
+    print("%s: %d glyphs, %d slots (load %.0f%%), %d buckets, %d B" %
+          (args.font, len(cmap), size, 100.0 * len(cmap) / size, buckets, table))
+
+
+if __name__ == "__main__":
+    main()
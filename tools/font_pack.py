@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file font_pack.py
+@brief 生成流式字体镜像 (EPF1)，烧录到 font 分区，由 gui_font_stream 按需读取
+
+固件内置字体只收录约 140 个汉字。本工具从 TTF/OTF 渲染整个 GB2312 / GBK 字符集，
+二值化规则与 tools/font_1bpp.py 相同 (笔画保留)，输出一个可直接烧录的分区镜像。
+
+镜像格式 (小端):
+    头部 (24 B)
+        char     magic[4]      "EPF1"
+        uint16   version       1
+        uint8    line_height
+        uint8    base_line
+        uint32   glyph_count
+        uint8    max_box_w
+        uint8    max_box_h
+        uint16   reserved
+        uint32   dir_offset    页目录偏移
+        uint32   image_size    镜像总字节数
+    页目录: 256 x uint32，第 i 项为 unicode 高字节 i 的页表偏移 (0: 该页没有字)
+    页表:   256 x uint32，第 j 项为 unicode (i << 8 | j) 的字形记录偏移 (0: 未收录)
+    字形记录: uint8 adv_w, box_w, box_h; int8 ofs_x, ofs_y; uint8 reserved; 1bpp 位图
+              (逐行连续、MSB 在前、行间不补齐，与 LVGL 1bpp 字体相同)
+
+查一个字最多读两次 flash (页表项 + 字形记录)，页目录 (1 KB) 常驻内存。
+
+用法:
+    python tools/font_pack.py SimSun.ttf --size 16 --charset gbk -o build/font.bin
+    esptool.py --chip esp32s3 write_flash 0xC90000 build/font.bin   # 地址见 partitions.csv 的 font 分区
+"""
+import argparse
+import struct
+import sys
+
+from font_1bpp import binarize, pack_1bpp
+
+try:
+    from PIL import Image, ImageDraw, ImageFont
+except ImportError:
+    sys.exit("Pillow is required: pip install pillow")
+
+MAGIC = b"EPF1"
+HEADER_FMT = "<4sHBBIBBHII"
+HEADER_SIZE = struct.calcsize(HEADER_FMT)
+GLYPH_FMT = "<BBBbbB"
+
+
+def charset(name, extra_file=None):
+    """返回要收录的 unicode 列表"""
+    chars = set(range(0x20, 0x7F))
+    if name in ("gb2312", "gbk"):
+        if name == "gb2312":
+            hi, lo = range(0xA1, 0xF8), range(0xA1, 0xFF)
+        else:
+            hi, lo = range(0x81, 0xFF), [b for b in range(0x40, 0xFF) if b != 0x7F]
+        for h in hi:
+            for l in lo:
+                try:
+                    chars.add(ord(bytes([h, l]).decode(name)))
+                except UnicodeDecodeError:
+                    pass
+    elif name != "ascii":
+        sys.exit("unknown charset %s" % name)
+    if extra_file:
+        with open(extra_file, encoding="utf-8") as f:
+            chars.update(ord(c) for c in f.read() if ord(c) >= 0x20)
+    return sorted(c for c in chars if c <= 0xFFFF)
+
+
+def render_glyph(font, ch, ascent, threshold, stem_min):
+    """渲染单个字形，返回 (adv_w, box_w, box_h, ofs_x, ofs_y, 位图)，空白字形的位图为空"""
+    x0, y0, x1, y1 = font.getbbox(ch)
+    adv = int(round(font.getlength(ch)))
+    w, h = x1 - x0, y1 - y0
+    if w <= 0 or h <= 0:
+        return adv, 0, 0, 0, 0, b""
+
+    img = Image.new("L", (w, h), 0)
+    ImageDraw.Draw(img).text((-x0, -y0), ch, font=font, fill=255)
+    cov = [[img.getpixel((x, y)) * 15 // 255 for x in range(w)] for y in range(h)]
+    bits = binarize(cov, threshold, stem_min)
+    if not any(map(any, bits)):
+        return adv, 0, 0, 0, 0, b""
+    return adv, w, h, x0, ascent - y1, pack_1bpp(bits)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Build an EPF1 streaming font image for the font partition")
+    ap.add_argument("ttf", help="TrueType / OpenType font")
+    ap.add_argument("-o", "--out", default="font.bin")
+    ap.add_argument("--size", type=int, default=16, help="pixel size (default 16)")
+    ap.add_argument("--charset", default="gb2312", help="ascii | gb2312 | gbk (default gb2312)")
+    ap.add_argument("--extra", help="UTF-8 text file with additional characters")
+    ap.add_argument("--threshold", type=int, default=8)
+    ap.add_argument("--stem-min", type=int, default=4)
+    ap.add_argument("--max-size", type=lambda s: int(s, 0), default=0x200000, help="partition size (default 2 MB)")
+    args = ap.parse_args()
+
+    font = ImageFont.truetype(args.ttf, args.size)
+    ascent, descent = font.getmetrics()
+
+    # Pillow 对字体中没有的字渲染 .notdef (通常是方框)，与非字符 U+FFFF 的渲染结果比较来剔除
+    notdef = render_glyph(font, "\uffff", ascent, args.threshold, args.stem_min)
+    glyphs = {}
+    for c in charset(args.charset, args.extra):
+        g = render_glyph(font, chr(c), ascent, args.threshold, args.stem_min)
+        if c < 0x80 or g != notdef:
+            glyphs[c] = g
+
+    pages = sorted({c >> 8 for c in glyphs})
+    dir_offset = HEADER_SIZE
+    pos = dir_offset + 256 * 4 + len(pages) * 256 * 4
+    directory = [0] * 256
+    page_tables = {}
+    records = bytearray()
+    for i, p in enumerate(pages):
+        directory[p] = dir_offset + 256 * 4 + i * 256 * 4
+        page_tables[p] = [0] * 256
+
+    max_w = max_h = 0
+    for c, (adv, w, h, ox, oy, bm) in sorted(glyphs.items()):
+        page_tables[c >> 8][c & 0xFF] = pos + len(records)
+        records += struct.pack(GLYPH_FMT, min(adv, 255), w, h, ox, oy, 0) + bm
+        max_w, max_h = max(max_w, w), max(max_h, h)
+
+    body = bytearray()
+    body += struct.pack("<256I", *directory)
+    for p in pages:
+        body += struct.pack("<256I", *page_tables[p])
+    body += records
+    image_size = HEADER_SIZE + len(body)
+    header = struct.pack(HEADER_FMT, MAGIC, 1, ascent + descent, descent, len(glyphs),
+                         max_w, max_h, 0, dir_offset, image_size)
+
+    if image_size > args.max_size:
+        sys.exit("image %d B exceeds partition size %d B" % (image_size, args.max_size))
+    with open(args.out, "wb") as f:
+        f.write(header + body)
+
+    print("%s: %d glyphs (%s, %d px), %d pages, max box %dx%d, %d B (%.0f%% of partition)" %
+          (args.out, len(glyphs), args.charset, args.size, len(pages), max_w, max_h,
+           image_size, 100.0 * image_size / args.max_size))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file img_1bpp.py
+@brief 把 SquareLine 导出的 TRUE_COLOR_ALPHA 图片 (.c) 转换为 1bit 格式
+
+SquareLine 以 LV_IMG_CF_TRUE_COLOR_ALPHA (RGB565 + 8bit alpha，3 B/像素) 导出 PNG，
+LVGL 每次渲染都要逐像素做 16bit 混合，而 disp_flush 最终只保留黑白两色。
+本工具在构建前完成二值化 (原地修改 .c 文件，符号名不变，页面代码无需修改)：
+
+- 不透明像素全部为同一种深色 (单色图标，本项目全部如此):
+  输出 LV_IMG_CF_ALPHA_1BIT (每行按字节对齐，1 = 着墨)，颜色由样式 img_recolor 决定 (默认黑)，
+  由 gui_img 的快速路径按位直接写入渲染缓冲区。
+- 其他情况 (图中既有黑又有白):
+  输出 LV_IMG_CF_INDEXED_2BIT，调色板 [透明, 黑, 白]，即 "1bit 图像 + 1bit 遮罩"，交给 LVGL 绘制。
+
+像素判定: alpha >= --alpha-threshold 为不透明；不透明像素亮度 < 128 为黑。
+
+用法:
+    python tools/img_1bpp.py src/ui/ui_img_*.c
+SquareLine 重新导出后需再次执行 (已转换的文件会被跳过)。
+"""
+import argparse
+import re
+import sys
+
+
+def parse(src):
+    """解析 SquareLine 图片 .c，返回 (名称, 宽, 高, [(rgb565, alpha)])"""
+    name = re.search(r"const lv_img_dsc_t (\w+) = \{", src).group(1)
+    w = int(re.search(r"\.header\.w = (\d+)", src).group(1))
+    h = int(re.search(r"\.header\.h = (\d+)", src).group(1))
+    body = re.search(r"uint8_t \w+_data\[\] = \{(.*?)\};", src, re.S).group(1)
+    b = [int(x, 16) for x in re.findall(r"0x[0-9A-Fa-f]{2}", body)]
+    if len(b) != w * h * 3:
+        sys.exit("%s: expected %d bytes of RGB565+A8 data, got %d" % (name, w * h * 3, len(b)))
+    px = [(b[i] | (b[i + 1] << 8), b[i + 2]) for i in range(0, len(b), 3)]
+    return name, w, h, px
+
+
+def luma(c):
+    r = (c >> 11) * 255 // 31
+    g = ((c >> 5) & 0x3F) * 255 // 63
+    bl = (c & 0x1F) * 255 // 31
+    return (r * 299 + g * 587 + bl * 114) // 1000
+
+
+def hex_rows(data, per_line=16):
+    return "\n".join("    " + ",".join("0x%02X" % v for v in data[i:i + per_line]) + ","
+                     for i in range(0, len(data), per_line))
+
+
+def convert(path, alpha_threshold):
+    with open(path, encoding="utf-8") as f:
+        src = f.read()
+    if "LV_IMG_CF_TRUE_COLOR_ALPHA" not in src:
+        print("%s: skipped (not TRUE_COLOR_ALPHA)" % path)
+        return 0, 0
+
+    name, w, h, px = parse(src)
+    # 0: 透明, 1: 黑, 2: 白
+    klass = [0 if a < alpha_threshold else (1 if luma(c) < 128 else 2) for c, a in px]
+    before = len(px) * 3
+    # 现状: disp_flush 把任何非纯白像素显示为黑 (alpha > 0 的黑色像素都会着墨)
+    changed = sum(1 for (c, a), k in zip(px, klass) if (a > 0 and luma(c) < 128) != (k == 1))
+
+    data = bytearray()
+    if 2 not in klass:
+        cf = "LV_IMG_CF_ALPHA_1BIT"
+        stride = (w + 7) // 8
+        for y in range(h):
+            row = bytearray(stride)
+            for x in range(w):
+                if klass[y * w + x] == 1:
+                    row[x // 8] |= 0x80 >> (x % 8)
+            data += row
+    else:
+        cf = "LV_IMG_CF_INDEXED_2BIT"
+        data += bytes([0x00, 0x00, 0x00, 0x00,    # 0: 透明 (B, G, R, A)
+                       0x00, 0x00, 0x00, 0xFF,    # 1: 黑
+                       0xFF, 0xFF, 0xFF, 0xFF,    # 2: 白
+                       0x00, 0x00, 0x00, 0x00])   # 3: 未用
+        stride = (w + 3) // 4
+        for y in range(h):
+            row = bytearray(stride)
+            for x in range(w):
+                row[x // 4] |= klass[y * w + x] << (6 - 2 * (x % 4))
+            data += row
+
+    head = src[:src.index("const LV_ATTRIBUTE_MEM_ALIGN")]
+    head = head.replace("#include \"ui.h\"",
+                        "// Converted to %s by tools/img_1bpp.py (alpha threshold %d)\n\n#include \"ui.h\""
+                        % (cf, alpha_threshold), 1)
+    out = (head +
+           "const LV_ATTRIBUTE_MEM_ALIGN uint8_t %s_data[] = {\n%s\n};\n" % (name, hex_rows(data)) +
+           "const lv_img_dsc_t %s = {\n" % name +
+           "    .header.always_zero = 0,\n"
+           "    .header.w = %d,\n"
+           "    .header.h = %d,\n"
+           "    .data_size = sizeof(%s_data),\n"
+           "    .header.cf = %s,\n"
+           "    .data = %s_data\n"
+           "};\n\n" % (w, h, name, cf, name))
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(out)
+
+    print("%s: %dx%d %s, %d B -> %d B, %d px differ from current rendering"
+          % (name, w, h, cf, before, len(data), changed))
+    return before, len(data)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Convert SquareLine TRUE_COLOR_ALPHA images to 1-bit formats")
+    ap.add_argument("files", nargs="+", help="ui_img_*.c generated by SquareLine (modified in place)")
+    ap.add_argument("--alpha-threshold", type=int, default=128, help="alpha treated as opaque (default 128)")
+    args = ap.parse_args()
+
+    total_before = total_after = 0
+    for path in args.files:
+        b, a = convert(path, args.alpha_threshold)
+        total_before += b
+        total_after += a
+    if total_before:
+        print("total: %d B -> %d B (%.1f%%)" % (total_before, total_after, 100.0 * total_after / total_before))
+
+
+if __name__ == "__main__":
+    main()
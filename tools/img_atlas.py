@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file img_atlas.py
+@brief 把 1bit 图标 (tools/img_1bpp.py 的输出) 打包为一张图标集 (sprite atlas)
+
+每个图标单独一个 lv_img_dsc_t 时，透明边框也按整幅存储，每张图各占一个描述符，
+启动器一类的网格页面每个图标都要一次 lv_draw_img。本工具：
+- 把每个图标裁掉四周的透明边框，记录裁剪偏移与原始尺寸 (绘制时按原尺寸居中，效果不变)；
+- 按高度降序用货架算法 (shelf packing) 排进一张 1bit 位图，水平方向按位紧排 (不按字节对齐)；
+- 生成 src/ui/ui_img_atlas.c (位图 + 子图表) 与 src/ui/ui_img_atlas.h (图标枚举)，
+  由 gui_atlas 按子矩形直接绘制。
+
+用法 (图标或 --width 变化后重新执行):
+    python tools/img_atlas.py src/ui/ui_img_*_png.c
+"""
+import argparse
+import os
+import re
+import sys
+
+from img_1bpp import hex_rows
+import img_rle
+
+
+def load_1bit(path):
+    """读取 ALPHA_1BIT (或经 tools/img_rle.py 压缩的) 图片 .c，返回 (图标名, 宽, 高, 行列表 [[0/1]])"""
+    with open(path, encoding="utf-8") as f:
+        src = f.read()
+    encoded = "LV_IMG_CF_USER_ENCODED_0" in src
+    if "LV_IMG_CF_ALPHA_1BIT" not in src and not encoded:
+        sys.exit("%s: not ALPHA_1BIT, run tools/img_1bpp.py first" % path)
+    sym = re.search(r"const lv_img_dsc_t (\w+) = \{", src).group(1)
+    w = int(re.search(r"\.header\.w = (\d+)", src).group(1))
+    h = int(re.search(r"\.header\.h = (\d+)", src).group(1))
+    body = re.search(r"uint8_t \w+_data\[\] = \{(.*?)\};", src, re.S).group(1)
+    b = [int(x, 16) for x in re.findall(r"0x[0-9A-Fa-f]{2}", body)]
+    if encoded:
+        rows = img_rle.decode(w, h, b)
+    else:
+        stride = (w + 7) // 8
+        rows = [[(b[y * stride + x // 8] >> (7 - x % 8)) & 1 for x in range(w)] for y in range(h)]
+    name = re.sub(r"^ui_img_|_png$", "", sym)
+    return name, w, h, rows
+
+
+def trim(w, h, rows):
+    """裁掉透明边框，返回 (x0, y0, 裁剪后的行)；全透明图标返回 1x1 空图"""
+    ys = [y for y in range(h) if any(rows[y])]
+    xs = [x for x in range(w) if any(rows[y][x] for y in range(h))]
+    if not ys:
+        return 0, 0, [[0]]
+    return xs[0], ys[0], [r[xs[0]:xs[-1] + 1] for r in rows[ys[0]:ys[-1] + 1]]
+
+
+def pack(sprites, width):
+    """货架算法，返回 (图集高度, {名称: (x, y)})"""
+    pos = {}
+    x = y = shelf_h = 0
+    for s in sorted(sprites, key=lambda s: -len(s["bits"])):
+        w, h = len(s["bits"][0]), len(s["bits"])
+        if w > width:
+            sys.exit("%s: %d px wider than atlas (%d)" % (s["name"], w, width))
+        if x + w > width:
+            x, y, shelf_h = 0, y + shelf_h, 0
+        pos[s["name"]] = (x, y)
+        x += w
+        shelf_h = max(shelf_h, h)
+    return y + shelf_h, pos
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Pack 1-bit icons into a single sprite atlas")
+    ap.add_argument("files", nargs="+", help="ALPHA_1BIT / RLE ui_img_*.c files")
+    ap.add_argument("--width", type=int, default=256, help="atlas width in pixels (default 256)")
+    ap.add_argument("--out", default="src/ui/ui_img_atlas", help="output path without extension")
+    args = ap.parse_args()
+
+    sprites = []
+    before = 0
+    for path in sorted(args.files):
+        name, w, h, rows = load_1bit(path)
+        x0, y0, bits = trim(w, h, rows)
+        sprites.append({"name": name, "w": w, "h": h, "ofs_x": x0, "ofs_y": y0, "bits": bits})
+        before += (w + 7) // 8 * h
+
+    # 实际用到的宽度 (最后一个货架可能较窄)
+    atlas_h, pos = pack(sprites, args.width)
+    atlas_w = max(pos[s["name"]][0] + len(s["bits"][0]) for s in sprites)
+    stride = (atlas_w + 7) // 8
+    data = bytearray(stride * atlas_h)
+    for s in sprites:
+        sx, sy = pos[s["name"]]
+        for y, row in enumerate(s["bits"]):
+            for x, v in enumerate(row):
+                if v:
+                    data[(sy + y) * stride + (sx + x) // 8] |= 0x80 >> ((sx + x) % 8)
+
+    base = os.path.basename(args.out)
+    enum = ["UI_ICON_%s" % s["name"].upper() for s in sprites]
+    guard = base.upper() + "_H"
+
+    with open(args.out + ".h", "w", encoding="utf-8", newline="\n") as f:
+        f.write("// Generated by tools/img_atlas.py, do not edit\n\n"
+                "#ifndef %s\n#define %s\n\n"
+                "#include \"gui_port/gui_atlas.h\"\n\n"
+                "#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n"
+                "typedef enum {\n%s\n    UI_ICON_COUNT\n} ui_icon_t;\n\n"
+                "extern const gui_atlas_t ui_icon_atlas;\n\n"
+                "#ifdef __cplusplus\n}\n#endif\n\n#endif // %s\n"
+                % (guard, guard, "\n".join("    %s," % e for e in enum), guard))
+
+    sprite_rows = []
+    for s, e in zip(sprites, enum):
+        sx, sy = pos[s["name"]]
+        sprite_rows.append("    [%s] = { %d, %d, %d, %d, %d, %d, %d, %d },"
+                           % (e, sx, sy, len(s["bits"][0]), len(s["bits"]),
+                              s["ofs_x"], s["ofs_y"], s["w"], s["h"]))
+
+    with open(args.out + ".c", "w", encoding="utf-8", newline="\n") as f:
+        f.write("// Generated by tools/img_atlas.py, do not edit\n"
+                "// Sources: %s\n\n"
+                "#include \"%s.h\"\n\n"
+                "static const uint8_t atlas_bitmap[] = {\n%s\n};\n\n"
+                "// x, y, w, h (atlas sub-rect), ofs_x, ofs_y, full_w, full_h (original icon)\n"
+                "static const gui_atlas_sprite_t atlas_sprites[] = {\n%s\n};\n\n"
+                "const gui_atlas_t ui_icon_atlas = {\n"
+                "    .bitmap = atlas_bitmap,\n"
+                "    .w = %d,\n"
+                "    .h = %d,\n"
+                "    .stride = %d,\n"
+                "    .count = UI_ICON_COUNT,\n"
+                "    .sprites = atlas_sprites,\n"
+                "};\n"
+                % (" ".join(os.path.basename(p) for p in sorted(args.files)), base,
+                   hex_rows(data), "\n".join(sprite_rows), atlas_w, atlas_h, stride))
+
+    print("%s: %d icons, %dx%d, %d B bitmap (separate images %d B, %.0f%%)"
+          % (args.out, len(sprites), atlas_w, atlas_h, len(data), before, 100.0 * len(data) / before))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,449 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file img_dither.py
+@brief 照片 / 天气图等灰度图片的流式解码 + 抖动 (与 gui_decode 相同的算法，主机端)
+
+固件中的 gui_decode 按行流式解码 BMP / PNG / JPEG，逐行经过
+"亮度 -> 伽马查表 -> 盒式缩小 -> 抖动" 直接写入 1bit 目标，不保存整幅 RGB 图像。
+本工具在主机上用同样的整数算法处理 BMP / PNG (JPEG 需第三方解码库，主机端不支持)：
+- 转换为 LV_IMG_CF_ALPHA_1BIT 图片 .c (1 = 着墨)，可直接编译进固件或交给 tools/asset_pack.py；
+- --pbm 输出预览图；
+- --bench 测量解码耗时与峰值内存 (tracemalloc)，与设备端 gui_decode_bench 的输出对照。
+  不指定输入文件时使用内置的 264x176 合成测试图 (PNG 与 BMP 各一张)。
+
+算法 (须与 src/gui_port/gui_decode.cpp 保持一致):
+    亮度     (r * 77 + g * 150 + b * 29 + 128) >> 8；带 alpha 时先与白色混合
+    伽马     lut[v] = round(255 * (v / 255) ^ gamma)，默认 gamma = 2.2 (sRGB -> 线性)
+    缩小     图片超出目标尺寸时按整数倍 f 盒式平均 (在线性空间中平均)
+    抖动     none: v < 128 着墨
+             ordered: 8x8 Bayer，v < bayer * 4 + 2 着墨
+             fs: Floyd-Steinberg (蛇形扫描，误差 7/3/5/1 按 >> 4 分配)
+
+用法:
+    python tools/img_dither.py photo.png -o src/ui/ui_img_photo.c --dither fs
+    python tools/img_dither.py photo.png --pbm preview.pbm --max 264x176
+    python tools/img_dither.py --bench
+    python tools/img_dither.py --synthetic build    # 写出合成测试图，供设备端对照:
+    python tools/asset_pack.py ... bench_png=build/synthetic.png bench_bmp=build/synthetic.bmp -o build/assets.bin
+"""
+import argparse
+import os
+import struct
+import sys
+import time
+import tracemalloc
+import zlib
+
+from img_1bpp import hex_rows
+
+BAYER8 = [
+    [0, 32, 8, 40, 2, 34, 10, 42],
+    [48, 16, 56, 24, 50, 18, 58, 26],
+    [12, 44, 4, 36, 14, 46, 6, 38],
+    [60, 28, 52, 20, 62, 30, 54, 22],
+    [3, 35, 11, 43, 1, 33, 9, 41],
+    [51, 19, 59, 27, 49, 17, 57, 25],
+    [15, 47, 7, 39, 13, 45, 5, 37],
+    [63, 31, 55, 23, 61, 29, 53, 21],
+]
+MAX_SCALE = 16
+
+
+def gamma_lut(gamma):
+    return bytes(int(255.0 * (i / 255.0) ** gamma + 0.5) for i in range(256))
+
+
+def luma(r, g, b):
+    return (r * 77 + g * 150 + b * 29 + 128) >> 8
+
+
+def over_white(v, a):
+    return (v * a + 255 * (255 - a) + 127) // 255
+
+
+class Sink(object):
+    """伽马 -> 盒式缩小 -> 抖动 -> 1bit 行 (与 gui_decode 的 pipe_t 相同)"""
+
+    def __init__(self, src_w, src_h, max_w, max_h, dither, lut):
+        f = 1
+        while f < MAX_SCALE and ((src_w + f - 1) // f > max_w or (src_h + f - 1) // f > max_h):
+            f += 1
+        self.f = f
+        self.out_w = min((src_w + f - 1) // f, max_w)
+        self.out_h = min((src_h + f - 1) // f, max_h)
+        self.src_w = src_w
+        self.dither = dither
+        self.lut = lut
+        self.acc = [0] * ((src_w + f - 1) // f)
+        self.bin = -1
+        self.bin_rows = 0
+        self.emitted = 0
+        self.err = [0] * (self.out_w + 2)
+        self.err_next = [0] * (self.out_w + 2)
+        self.stride = (self.out_w + 7) // 8
+        self.bits = bytearray(self.stride * self.out_h)
+
+    def row(self, y, px):
+        """px: 一行 8bit 亮度 (未经伽马)"""
+        b = y // self.f
+        if b != self.bin:
+            self._flush()
+            self.bin = b
+        lut, f, acc = self.lut, self.f, self.acc
+        if f == 1:
+            for x in range(self.src_w):
+                acc[x] = lut[px[x]]
+        else:
+            for x in range(self.src_w):
+                acc[x // f] += lut[px[x]]
+        self.bin_rows += 1
+
+    def finish(self):
+        self._flush()
+        return self.bits
+
+    def _flush(self):
+        if self.bin_rows == 0:
+            return
+        f, oy = self.f, self.bin
+        line = []
+        for x in range(self.out_w):
+            cols = min(f, self.src_w - x * f)
+            line.append(self.acc[x] // (cols * self.bin_rows))
+        for i in range(len(self.acc)):
+            self.acc[i] = 0
+        self.bin_rows = 0
+        if oy < self.out_h:
+            self._dither(oy, line)
+        self.emitted += 1
+
+    def _dither(self, oy, line):
+        w = self.out_w
+        row = memoryview(self.bits)[oy * self.stride:(oy + 1) * self.stride]
+        if self.dither == "none":
+            for x in range(w):
+                if line[x] < 128:
+                    row[x >> 3] |= 0x80 >> (x & 7)
+        elif self.dither == "ordered":
+            m = BAYER8[oy & 7]
+            for x in range(w):
+                if line[x] < m[x & 7] * 4 + 2:
+                    row[x >> 3] |= 0x80 >> (x & 7)
+        else:
+            cur, nxt = self.err, self.err_next
+            for i in range(w + 2):
+                nxt[i] = 0
+            ltr = (self.emitted & 1) == 0
+            d = 1 if ltr else -1
+            xs = range(w) if ltr else range(w - 1, -1, -1)
+            for x in xs:
+                e = line[x] + cur[x + 1]
+                if e < 128:
+                    row[x >> 3] |= 0x80 >> (x & 7)
+                    q = e
+                else:
+                    q = e - 255
+                cur[x + 1 + d] += (q * 7) >> 4
+                nxt[x + 1 - d] += (q * 3) >> 4
+                nxt[x + 1] += (q * 5) >> 4
+                nxt[x + 1 + d] += q >> 4
+            self.err, self.err_next = nxt, cur
+
+
+def _reader(data):
+    pos = [0]
+
+    def read(n):
+        b = data[pos[0]:pos[0] + n]
+        pos[0] += len(b)
+        return b
+    return read
+
+
+def decode_bmp(data, make_sink):
+    read = _reader(data)
+    fh = read(14)
+    if fh[:2] != b"BM":
+        raise ValueError("not a BMP")
+    off = struct.unpack_from("<I", fh, 10)[0]
+    ih = read(40)
+    size, w, h, planes, bpp, comp, _, _, _, ncolors = struct.unpack("<IiiHHIIiiI", ih[:36])
+    if comp != 0 or bpp not in (1, 4, 8, 24, 32):
+        raise ValueError("unsupported BMP (bpp %d, compression %d)" % (bpp, comp))
+    read(size - 40)
+    pal = []
+    if bpp <= 8:
+        n = ncolors or (1 << bpp)
+        p = read(4 * n)
+        pal = [luma(p[i * 4 + 2], p[i * 4 + 1], p[i * 4]) for i in range(n)]
+    read(off - 14 - size - 4 * len(pal))
+    bottom_up = h > 0
+    h = abs(h)
+    sink = make_sink(w, h)
+    stride = (w * bpp + 31) // 32 * 4
+    px = bytearray(w)
+    for i in range(h):
+        r = read(stride)
+        if len(r) < stride:
+            raise ValueError("truncated BMP")
+        if bpp == 24 or bpp == 32:
+            n = bpp // 8
+            for x in range(w):
+                px[x] = luma(r[x * n + 2], r[x * n + 1], r[x * n])
+        else:
+            per = 8 // bpp
+            mask = (1 << bpp) - 1
+            for x in range(w):
+                px[x] = pal[(r[x // per] >> (8 - bpp * (x % per + 1))) & mask]
+        sink.row(h - 1 - i if bottom_up else i, px)
+    return w, h, sink
+
+
+def decode_png(data, make_sink):
+    read = _reader(data)
+    if read(8) != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("not a PNG")
+    inflater = zlib.decompressobj()
+    sink = None
+    pal = []
+    trns = None
+    cur = prev = None
+    fill = 0
+    y = 0
+    while True:
+        n, typ = struct.unpack(">I4s", read(8))
+        if typ == b"IDAT" and sink is not None:
+            # 按 1 KB 读取、每次最多解压 4 KB，与设备端一样只保留两行扫描线
+            left = n
+            while left > 0:
+                piece = read(min(left, 1024))
+                left -= len(piece)
+                while piece and y < h:
+                    out = inflater.decompress(piece, 4096)
+                    piece = inflater.unconsumed_tail
+                    i = 0
+                    while i < len(out) and y < h:
+                        k = min(len(out) - i, len(cur) - fill)
+                        cur[fill:fill + k] = out[i:i + k]
+                        fill += k
+                        i += k
+                        if fill == len(cur):
+                            _png_unfilter(cur, prev, bpp)
+                            _png_luma(cur, px, w, ctype, depth, pal, trns)
+                            sink.row(y, px)
+                            y += 1
+                            fill = 0
+                            cur, prev = prev, cur
+            read(4)
+            continue
+        body = read(n)
+        read(4)
+        if typ == b"IHDR":
+            w, h, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", body)
+            if interlace:
+                raise ValueError("interlaced PNG not supported")
+            chans = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+            bpp = max(1, chans * depth // 8)
+            row_bytes = (w * chans * depth + 7) // 8
+            cur = bytearray(row_bytes + 1)
+            prev = bytearray(row_bytes + 1)
+            px = bytearray(w)
+            sink = make_sink(w, h)
+        elif typ == b"PLTE":
+            pal = [luma(body[i], body[i + 1], body[i + 2]) for i in range(0, n - 2, 3)]
+        elif typ == b"tRNS" and ctype == 3:
+            trns = body
+        elif typ == b"IEND":
+            break
+    if sink is None or y < h:
+        raise ValueError("truncated PNG")
+    return w, h, sink
+
+
+def _png_unfilter(cur, prev, bpp):
+    ft = cur[0]
+    n = len(cur)
+    if ft == 1:
+        for i in range(1 + bpp, n):
+            cur[i] = (cur[i] + cur[i - bpp]) & 0xFF
+    elif ft == 2:
+        for i in range(1, n):
+            cur[i] = (cur[i] + prev[i]) & 0xFF
+    elif ft == 3:
+        for i in range(1, n):
+            a = cur[i - bpp] if i > bpp else 0
+            cur[i] = (cur[i] + ((a + prev[i]) >> 1)) & 0xFF
+    elif ft == 4:
+        for i in range(1, n):
+            a = cur[i - bpp] if i > bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i > bpp else 0
+            p = a + b - c
+            pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+            pr = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+            cur[i] = (cur[i] + pr) & 0xFF
+    elif ft != 0:
+        raise ValueError("bad PNG filter %d" % ft)
+
+
+def _png_luma(cur, px, w, ctype, depth, pal, trns):
+    d = cur[1:]
+    if depth < 8:
+        per = 8 // depth
+        mask = (1 << depth) - 1
+        for x in range(w):
+            v = (d[x // per] >> (8 - depth * (x % per + 1))) & mask
+            if ctype == 3:
+                a = trns[v] if trns is not None and v < len(trns) else 255
+                px[x] = over_white(pal[v] if v < len(pal) else 0, a)
+            else:
+                px[x] = v * 255 // mask
+        return
+    s = depth // 8    # 16bit 取高字节
+    for x in range(w):
+        if ctype == 0:
+            px[x] = d[x * s]
+        elif ctype == 2:
+            o = x * 3 * s
+            px[x] = luma(d[o], d[o + s], d[o + 2 * s])
+        elif ctype == 3:
+            v = d[x]
+            a = trns[v] if trns is not None and v < len(trns) else 255
+            px[x] = over_white(pal[v] if v < len(pal) else 0, a)
+        elif ctype == 4:
+            o = x * 2 * s
+            px[x] = over_white(d[o], d[o + s])
+        else:
+            o = x * 4 * s
+            px[x] = over_white(luma(d[o], d[o + s], d[o + 2 * s]), d[o + 3 * s])
+
+
+def convert(data, max_w, max_h, dither, gamma):
+    """返回 (源宽, 源高, 输出宽, 输出高, 1bit 数据)"""
+    lut = gamma_lut(gamma)
+    make_sink = lambda w, h: Sink(w, h, max_w, max_h, dither, lut)
+    if data[:2] == b"BM":
+        w, h, sink = decode_bmp(data, make_sink)
+    elif data[:8] == b"\x89PNG\r\n\x1a\n":
+        w, h, sink = decode_png(data, make_sink)
+    else:
+        raise ValueError("unsupported format (BMP / PNG only on host)")
+    return w, h, sink.out_w, sink.out_h, bytes(sink.finish())
+
+
+def synthetic(w=264, h=176):
+    """合成测试图: 水平灰阶 + 中心圆形暗斑 (24bit BMP 与 RGB PNG)"""
+    rows = []
+    for y in range(h):
+        row = bytearray()
+        for x in range(w):
+            v = x * 255 // (w - 1)
+            dx, dy = x - w // 2, y - h // 2
+            if dx * dx + dy * dy < (h // 3) ** 2:
+                v = 255 - v
+            row += bytes((v, (v + y) & 0xFF, v))
+        rows.append(bytes(row))
+    raw = b"".join(b"\x00" + r for r in rows)
+    chunk = lambda t, b: struct.pack(">I", len(b)) + t + b + struct.pack(">I", zlib.crc32(t + b) & 0xFFFFFFFF)
+    png = (b"\x89PNG\r\n\x1a\n" + chunk(b"IHDR", struct.pack(">IIBBBBB", w, h, 8, 2, 0, 0, 0)) +
+           chunk(b"IDAT", zlib.compress(raw, 9)) + chunk(b"IEND", b""))
+    stride = (w * 3 + 3) // 4 * 4
+    body = bytearray()
+    for r in reversed(rows):
+        bgr = bytearray(r)
+        bgr[0::3], bgr[2::3] = r[2::3], r[0::3]
+        body += bgr + b"\0" * (stride - w * 3)
+    bmp = (b"BM" + struct.pack("<IHHI", 54 + len(body), 0, 0, 54) +
+           struct.pack("<IiiHHIIiiII", 40, w, h, 1, 24, 0, len(body), 2835, 2835, 0, 0) + bytes(body))
+    return [("synthetic.png", png), ("synthetic.bmp", bmp)]
+
+
+def bench(inputs, max_w, max_h, gamma):
+    for name, data in inputs:
+        for dither in ("none", "ordered", "fs"):
+            tracemalloc.start()
+            t0 = time.perf_counter()
+            w, h, ow, oh, bits = convert(data, max_w, max_h, dither, gamma)
+            ms = (time.perf_counter() - t0) * 1000
+            peak = tracemalloc.get_traced_memory()[1]
+            tracemalloc.stop()
+            ink = sum(bin(b).count("1") for b in bits)
+            print("  %-16s %7d B %4dx%-4d -> %4dx%-4d %-7s %8.1f ms  peak %6d B  ink %d%%"
+                  % (name, len(data), w, h, ow, oh, dither, ms, peak, ink * 100 // (ow * oh)))
+    print("(Python reference; the device figures come from gui_decode_bench)")
+
+
+def write_c(path, sym, w, h, bits, note):
+    out = ("// Generated by tools/img_dither.py (%s)\n\n" % note +
+           "#include \"ui.h\"\n\n"
+           "#ifndef LV_ATTRIBUTE_MEM_ALIGN\n"
+           "    #define LV_ATTRIBUTE_MEM_ALIGN\n"
+           "#endif\n\n"
+           "// IMAGE DATA: %s\n" % sym +
+           "const LV_ATTRIBUTE_MEM_ALIGN uint8_t %s_data[] = {\n%s\n};\n" % (sym, hex_rows(bits)) +
+           "const lv_img_dsc_t %s = {\n" % sym +
+           "    .header.always_zero = 0,\n"
+           "    .header.w = %d,\n"
+           "    .header.h = %d,\n"
+           "    .data_size = sizeof(%s_data),\n"
+           "    .header.cf = LV_IMG_CF_ALPHA_1BIT,\n"
+           "    .data = %s_data\n"
+           "};\n\n" % (w, h, sym, sym))
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(out)
+
+
+def write_pbm(path, w, h, bits):
+    with open(path, "wb") as f:
+        f.write(b"P4\n%d %d\n" % (w, h))
+        f.write(bits)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Stream-decode BMP/PNG and dither to 1-bit (same algorithm as gui_decode)")
+    ap.add_argument("input", nargs="?", help="BMP or PNG file")
+    ap.add_argument("-o", "--out", help="output ALPHA_1BIT .c file")
+    ap.add_argument("--pbm", help="output PBM preview")
+    ap.add_argument("--dither", choices=("none", "ordered", "fs"), default="fs")
+    ap.add_argument("--gamma", type=float, default=2.2, help="gamma applied before dithering (default 2.2)")
+    ap.add_argument("--max", default="264x176", help="max output size WxH (default 264x176)")
+    ap.add_argument("--bench", action="store_true", help="report decode time and peak memory")
+    ap.add_argument("--synthetic", metavar="DIR", help="write the synthetic test images to DIR")
+    args = ap.parse_args()
+
+    if args.synthetic:
+        for name, data in synthetic():
+            with open(os.path.join(args.synthetic, name), "wb") as f:
+                f.write(data)
+            print("%s: %d B" % (os.path.join(args.synthetic, name), len(data)))
+        return
+
+    max_w, max_h = (int(v) for v in args.max.lower().split("x"))
+    if args.bench:
+        inputs = synthetic()
+        if args.input:
+            with open(args.input, "rb") as f:
+                inputs = [(os.path.basename(args.input), f.read())]
+        bench(inputs, max_w, max_h, args.gamma)
+        return
+    if not args.input or not (args.out or args.pbm):
+        ap.error("need an input and -o and/or --pbm (or --bench)")
+
+    with open(args.input, "rb") as f:
+        data = f.read()
+    try:
+        w, h, ow, oh, bits = convert(data, max_w, max_h, args.dither, args.gamma)
+    except ValueError as e:
+        sys.exit("%s: %s" % (args.input, e))
+    if args.out:
+        sym = os.path.splitext(os.path.basename(args.out))[0]
+        write_c(args.out, sym, ow, oh, bits, "%s, %s dither, gamma %.2f" % (os.path.basename(args.input),
+                                                                             args.dither, args.gamma))
+    if args.pbm:
+        write_pbm(args.pbm, ow, oh, bits)
+    print("%s: %dx%d -> %dx%d 1-bit (%s), %d B" % (args.input, w, h, ow, oh, args.dither, len(bits)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file img_rle.py
+@brief 1bit 图片游程压缩 (LV_IMG_CF_USER_ENCODED_0)，由 gui_asset 解码
+
+1bit 图标大部分是成片的空白和粗线条，按字节做 PackBits 几乎压不动 (逐字节花样太多)，
+按像素游程编码则很有效。编码格式 (原地改写 tools/img_1bpp.py 输出的 ALPHA_1BIT 文件):
+
+    data[0]   标志: bit0 = 行异或 (每行先与上一行异或再编码，竖直笔画变成短游程)
+    data[1..] 比特流 (MSB 在前): 按行优先顺序的像素游程，颜色 0 / 1 交替、从 0 开始，
+              每个游程长度 n 用 Elias-gamma 编码 (第一个游程可能为 0，编码 n + 1)
+
+    Elias-gamma(n), n >= 1: (bitlen(n) - 1) 个 0，随后 n 的二进制 (共 bitlen(n) 位)
+
+解码结果为 LV_IMG_CF_ALPHA_1BIT (每行按字节对齐)。两种方式 (是否行异或) 取较短的一种。
+解码器见 src/gui_port/gui_asset.cpp 的 _decode()，两边须保持一致。
+
+用法 (在 tools/img_1bpp.py 之后执行；已压缩的文件会被跳过):
+    python tools/img_rle.py src/ui/ui_img_*_png.c
+"""
+import argparse
+import re
+import sys
+
+from img_1bpp import hex_rows
+
+FLAG_ROW_XOR = 0x01
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.n = 0
+
+    def put(self, value, bits):
+        for i in range(bits - 1, -1, -1):
+            self.acc = (self.acc << 1) | ((value >> i) & 1)
+            self.n += 1
+            if self.n == 8:
+                self.out.append(self.acc)
+                self.acc = self.n = 0
+
+    def gamma(self, v):
+        k = v.bit_length() - 1
+        self.put(0, k)
+        self.put(v, k + 1)
+
+    def bytes(self):
+        if self.n:
+            return bytes(self.out) + bytes([self.acc << (8 - self.n)])
+        return bytes(self.out)
+
+
+def _runs(pixels):
+    runs, cur, n = [], 0, 0
+    for v in pixels:
+        if v == cur:
+            n += 1
+        else:
+            runs.append(n)
+            cur ^= 1
+            n = 1
+    runs.append(n)
+    return runs
+
+
+def _stream(flags, pixels):
+    bw = BitWriter()
+    runs = _runs(pixels)
+    bw.gamma(runs[0] + 1)
+    for r in runs[1:]:
+        bw.gamma(r)
+    return bytes([flags]) + bw.bytes()
+
+
+def encode(w, h, rows):
+    """rows: [[0/1] * w] * h，返回编码后的字节串"""
+    flat = [v for r in rows for v in r]
+    xored = [v ^ (rows[y - 1][x] if y else 0) for y, r in enumerate(rows) for x, v in enumerate(r)]
+    a = _stream(0, flat)
+    b = _stream(FLAG_ROW_XOR, xored)
+    return a if len(a) <= len(b) else b
+
+
+def decode(w, h, data):
+    """返回 [[0/1] * w] * h"""
+    pos = [8]   # 比特位置，跳过标志字节
+
+    def bit():
+        v = (data[pos[0] >> 3] >> (7 - (pos[0] & 7))) & 1
+        pos[0] += 1
+        return v
+
+    def gamma():
+        k = 0
+        while bit() == 0:
+            k += 1
+        v = 1
+        for _ in range(k):
+            v = (v << 1) | bit()
+        return v
+
+    flat = []
+    color = 0
+    first = True
+    while len(flat) < w * h:
+        n = gamma() - (1 if first else 0)
+        first = False
+        flat += [color] * n
+        color ^= 1
+    rows = [flat[y * w:(y + 1) * w] for y in range(h)]
+    if data[0] & FLAG_ROW_XOR:
+        for y in range(1, h):
+            rows[y] = [a ^ b for a, b in zip(rows[y], rows[y - 1])]
+    return rows
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Run-length compress ALPHA_1BIT images to LV_IMG_CF_USER_ENCODED_0")
+    ap.add_argument("files", nargs="+", help="ALPHA_1BIT ui_img_*.c files (modified in place)")
+    args = ap.parse_args()
+
+    total_raw = total_enc = 0
+    for path in args.files:
+        with open(path, encoding="utf-8") as f:
+            src = f.read()
+        if "LV_IMG_CF_ALPHA_1BIT" not in src:
+            print("%s: skipped (not ALPHA_1BIT)" % path)
+            continue
+
+        name = re.search(r"const lv_img_dsc_t (\w+) = \{", src).group(1)
+        w = int(re.search(r"\.header\.w = (\d+)", src).group(1))
+        h = int(re.search(r"\.header\.h = (\d+)", src).group(1))
+        m = re.search(r"(uint8_t \w+_data\[\] = \{)(.*?)(\};)", src, re.S)
+        raw = [int(x, 16) for x in re.findall(r"0x[0-9A-Fa-f]{2}", m.group(2))]
+        stride = (w + 7) // 8
+        rows = [[(raw[y * stride + x // 8] >> (7 - x % 8)) & 1 for x in range(w)] for y in range(h)]
+
+        enc = encode(w, h, rows)
+        if decode(w, h, enc) != rows:
+            sys.exit("%s: round trip failed" % name)
+
+        src = src[:m.start(2)] + "\n" + hex_rows(enc) + "\n" + src[m.end(2):]
+        src = src.replace(".header.cf = LV_IMG_CF_ALPHA_1BIT", ".header.cf = LV_IMG_CF_USER_ENCODED_0")
+        src = re.sub(r"// Converted to LV_IMG_CF_ALPHA_1BIT by tools/img_1bpp.py \(alpha threshold (\d+)\)",
+                     r"// Converted to LV_IMG_CF_ALPHA_1BIT by tools/img_1bpp.py (alpha threshold \1),\n"
+                     r"// compressed to LV_IMG_CF_USER_ENCODED_0 by tools/img_rle.py", src)
+        with open(path, "w", encoding="utf-8", newline="\n") as f:
+            f.write(src)
+
+        total_raw += len(raw)
+        total_enc += len(enc)
+        print("%s: %dx%d, %d B -> %d B (%s)" % (name, w, h, len(raw), len(enc),
+                                                "row xor" if enc[0] & FLAG_ROW_XOR else "plain"))
+    if total_raw:
+        print("total: %d B -> %d B (%.0f%%)" % (total_raw, total_enc, 100.0 * total_enc / total_raw))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,498 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file qr_bench.py
+@brief gui_qr 的主机端基准测试与解码往返校验
+
+用主机编译器以 -DGUI_QR_HOST 编译 src/gui_port/gui_qr.cpp (加一个临时的驱动程序)，然后:
+- 基准: 版本 1~10 (默认纠错等级 M，字节模式填满容量) 的编码与光栅化耗时；
+- 往返: 数字 / 字母数字 / 字节三种模式、四个纠错等级、随机长度 (覆盖版本 1~10) 的内容，
+  编码并光栅化到非字节对齐的位置，再用本文件中独立实现的解码器从位图中按模块中心采样、
+  读格式 / 版本信息、去掩码、之字形取码字、解交织、Reed-Solomon 校验并解析数据段，
+  与原内容比较。另外在每块中注入 (纠错码字数 / 2) 个错误码字，检验纠错后仍能还原。
+  同时检查光栅化没有改动目标区域以外的位。
+
+解码器不复用编码器的公式: 校正图形位置取自标准中的表格，各版本的数据码字总数与标准表格交叉核对。
+
+用法:
+    python tools/qr_bench.py                 # 基准 + 往返校验
+    python tools/qr_bench.py --ecc L --scale 3 --cases 500
+    python tools/qr_bench.py --cxx clang++
+"""
+import argparse
+import os
+import random
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SRC = os.path.join(ROOT, "src", "gui_port")
+QUIET = 4
+VER_MAX = 10
+ECC_NAMES = "LMQH"
+ALNUM = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:"
+
+# 标准表格 (ISO/IEC 18004 表 9 / 附录 E)
+ALIGN_POS = {1: [], 2: [6, 18], 3: [6, 22], 4: [6, 26], 5: [6, 30], 6: [6, 34],
+             7: [6, 22, 38], 8: [6, 24, 42], 9: [6, 26, 46], 10: [6, 28, 50]}
+DATA_CW = {1: (19, 16, 13, 9), 2: (34, 28, 22, 16), 3: (55, 44, 34, 26), 4: (80, 64, 48, 36),
+           5: (108, 86, 62, 46), 6: (136, 108, 76, 60), 7: (156, 124, 88, 66), 8: (194, 154, 110, 86),
+           9: (232, 182, 132, 100), 10: (274, 216, 154, 122)}
+ECC_PER_BLOCK = ((7, 10, 15, 20, 26, 18, 20, 24, 30, 18), (10, 16, 26, 18, 24, 16, 18, 22, 22, 26),
+                 (13, 22, 18, 26, 18, 24, 18, 22, 20, 24), (17, 28, 22, 16, 22, 28, 26, 26, 24, 28))
+NUM_BLOCKS = ((1, 1, 1, 1, 1, 2, 2, 2, 2, 4), (1, 1, 1, 2, 2, 4, 4, 4, 5, 5),
+              (1, 1, 2, 2, 4, 4, 6, 6, 8, 8), (1, 1, 2, 4, 4, 4, 5, 6, 8, 8))
+FORMAT_ECC = {1: 0, 0: 1, 3: 2, 2: 3}   # 格式信息中的 2 位 -> L/M/Q/H
+
+DRIVER = r"""
+#include "gui_qr.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// 输入每行: ecc rounds scale hex|-    输出: ok version ecc mask size enc_ns render_ns side W H，随后一行位图 hex
+int main() {
+    static char hex[4096];
+    int ecc, rounds, scale;
+    while (scanf("%d %d %d %4095s", &ecc, &rounds, &scale, hex) == 4) {
+        std::vector<uint8_t> data;
+        if (strcmp(hex, "-") != 0) {
+            for (size_t i = 0; hex[i] && hex[i + 1]; i += 2) {
+                unsigned v;
+                sscanf(hex + i, "%2x", &v);
+                data.push_back((uint8_t)v);
+            }
+        }
+        static gui_qr_t qr;
+        auto t0 = std::chrono::steady_clock::now();
+        bool ok = false;
+        for (int r = 0; r < rounds; r++) ok = gui_qr_encode(&qr, data.data(), data.size(), (gui_qr_ecc_t)ecc);
+        auto t1 = std::chrono::steady_clock::now();
+        if (!ok) {
+            printf("0 0 0 0 0 0 0 0 0 0\n-\n");
+            fflush(stdout);
+            continue;
+        }
+        // 画在 (3, 1)，四周留出已知图案以检查越界
+        int side = gui_qr_px(&qr, scale);
+        int w = side + 11, h = side + 2, stride = (w + 7) / 8;
+        std::vector<uint8_t> buf(stride * h);
+        auto t2 = std::chrono::steady_clock::now();
+        for (int r = 0; r < rounds; r++) {
+            memset(buf.data(), 0xA5, buf.size());
+            gui_qr_render(&qr, buf.data(), stride, 3, 1, scale, 1);
+        }
+        auto t3 = std::chrono::steady_clock::now();
+        double enc = std::chrono::duration<double, std::nano>(t1 - t0).count() / rounds;
+        double ren = std::chrono::duration<double, std::nano>(t3 - t2).count() / rounds;
+        printf("1 %d %d %d %d %.0f %.0f %d %d %d\n", qr.version, qr.ecc, qr.mask, qr.size, enc, ren, side, w, h);
+        for (uint8_t b : buf) printf("%02x", b);
+        printf("\n");
+        fflush(stdout);
+    }
+    return 0;
+}
+"""
+
+
+class Driver:
+    def __init__(self, cxx):
+        self.tmp = tempfile.TemporaryDirectory()
+        drv = os.path.join(self.tmp.name, "driver.cpp")
+        exe = os.path.join(self.tmp.name, "qr_host")
+        with open(drv, "w") as f:
+            f.write(DRIVER)
+        cmd = [cxx, "-std=gnu++17", "-O2", "-Wall", "-DGUI_QR_HOST", "-I", SRC, drv, os.path.join(SRC, "gui_qr.cpp"), "-o", exe]
+        subprocess.run(cmd, check=True)
+        self.proc = subprocess.Popen([exe], stdin=subprocess.PIPE, stdout=subprocess.PIPE, text=True)
+
+    def run(self, data, ecc, rounds=1, scale=2):
+        self.proc.stdin.write("%d %d %d %s\n" % (ecc, rounds, scale, data.hex() or "-"))
+        self.proc.stdin.flush()
+        head = self.proc.stdout.readline().split()
+        bits = self.proc.stdout.readline().strip()
+        ok, ver, ecc_used, mask, size, enc, ren, side, w, h = (int(float(v)) for v in head)
+        if not ok:
+            return None
+        return dict(version=ver, ecc=ecc_used, mask=mask, size=size, enc_ns=enc, render_ns=ren,
+                    side=side, w=w, h=h, buf=bytes.fromhex(bits))
+
+    def close(self):
+        self.proc.stdin.close()
+        self.proc.wait()
+        self.tmp.cleanup()
+
+
+# --- GF(256) / Reed-Solomon (生成多项式根 a^0 .. a^(n-1)) ---
+
+GF_EXP = [0] * 512
+GF_LOG = [0] * 256
+_x = 1
+for _i in range(255):
+    GF_EXP[_i] = _x
+    GF_LOG[_x] = _i
+    _x <<= 1
+    if _x & 0x100:
+        _x ^= 0x11D
+for _i in range(255, 512):
+    GF_EXP[_i] = GF_EXP[_i - 255]
+
+
+def gf_mul(a, b):
+    return 0 if a == 0 or b == 0 else GF_EXP[GF_LOG[a] + GF_LOG[b]]
+
+
+def gf_div(a, b):
+    return 0 if a == 0 else GF_EXP[(GF_LOG[a] + 255 - GF_LOG[b]) % 255]
+
+
+def poly_eval(p, x):
+    y = p[0]
+    for c in p[1:]:
+        y = gf_mul(y, x) ^ c
+    return y
+
+
+def rs_correct(msg, nsym):
+    """Berlekamp-Massey + Chien + Forney，返回纠正后的码字与纠正个数，失败抛出 ValueError"""
+    msg = list(msg)
+    synd = [poly_eval(msg, GF_EXP[i]) for i in range(nsym)]
+    if not any(synd):
+        return msg, 0
+    # Berlekamp-Massey (多项式低次在前)
+    err_loc, prev = [1], [1]
+    length, m, b = 0, 1, 1
+    for i in range(nsym):
+        d = synd[i]
+        for j in range(1, length + 1):
+            if j < len(err_loc):
+                d ^= gf_mul(err_loc[j], synd[i - j])
+        if d == 0:
+            m += 1
+            continue
+        coef = gf_div(d, b)
+        upd = [0] * m + [gf_mul(coef, c) for c in prev]
+        new_loc = [a ^ c for a, c in zip(err_loc + [0] * (len(upd) - len(err_loc)), upd + [0] * (len(err_loc) - len(upd)))]
+        if 2 * length <= i:
+            prev, length, b, m = err_loc, i + 1 - length, d, 1
+        else:
+            m += 1
+        err_loc = new_loc
+    while len(err_loc) > 1 and err_loc[-1] == 0:
+        err_loc.pop()
+    nerr = len(err_loc) - 1
+    if nerr * 2 > nsym:
+        raise ValueError("too many errors")
+    # Chien: 位置 k (从末尾数) 满足 Lambda(a^-k) = 0
+    n = len(msg)
+    pos = [k for k in range(n) if poly_eval(err_loc[::-1], GF_EXP[(255 - k) % 255]) == 0]
+    if len(pos) != nerr:
+        raise ValueError("error locator mismatch")
+    # Forney: Omega = S * Lambda mod x^nsym
+    omega = [0] * nsym
+    for i in range(nsym):
+        for j in range(len(err_loc)):
+            if i - j >= 0:
+                omega[i] ^= gf_mul(synd[i - j], err_loc[j])
+    for k in pos:
+        xinv = GF_EXP[(255 - k) % 255]
+        num = poly_eval(omega[::-1], xinv)
+        den = 0
+        for j in range(1, len(err_loc), 2):     # 形式导数只剩奇次项
+            den ^= gf_mul(err_loc[j], GF_EXP[(GF_LOG[xinv] * (j - 1)) % 255])
+        # fcr = 0: e = X * Omega(X^-1) / Lambda'(X^-1)
+        mag = gf_mul(GF_EXP[k % 255], gf_div(num, den))
+        msg[n - 1 - k] ^= mag
+    if any(poly_eval(msg, GF_EXP[i]) for i in range(nsym)):
+        raise ValueError("correction failed")
+    return msg, nerr
+
+
+# --- 解码 ---
+
+def bch_format(data):
+    rem = data
+    for _ in range(10):
+        rem = (rem << 1) ^ ((rem >> 9) * 0x537)
+    return ((data << 10) | rem) ^ 0x5412
+
+
+def bch_version(ver):
+    rem = ver
+    for _ in range(12):
+        rem = (rem << 1) ^ ((rem >> 11) * 0x1F25)
+    return ver << 12 | rem
+
+
+def sample(res, scale, x0=3, y0=1):
+    """按模块中心采样，同时检查静区为浅色、区域外的位未被改动"""
+    buf, w, h, side, size = res["buf"], res["w"], res["h"], res["side"], res["size"]
+    stride = (w + 7) // 8
+
+    def px(x, y):
+        return (buf[y * stride + x // 8] >> (7 - x % 8)) & 1
+
+    for y in range(h):
+        for x in range(stride * 8):
+            inside = x0 <= x < x0 + side and y0 <= y < y0 + side
+            if not inside and ((0xA5 >> (7 - x % 8)) & 1) != px(x, y):
+                raise ValueError("render touched pixel (%d,%d) outside the target" % (x, y))
+    q = QUIET * scale
+    for y in range(side):
+        for x in range(side):
+            if (x < q or x >= side - q or y < q or y >= side - q) and px(x0 + x, y0 + y):
+                raise ValueError("dark pixel in quiet zone")
+    grid = [[px(x0 + q + mx * scale + scale // 2, y0 + q + my * scale + scale // 2) for mx in range(size)]
+            for my in range(size)]
+    # 同一模块内的像素必须一致
+    for my in range(size):
+        for mx in range(size):
+            for dy in range(scale):
+                for dx in range(scale):
+                    if px(x0 + q + mx * scale + dx, y0 + q + my * scale + dy) != grid[my][mx]:
+                        raise ValueError("module (%d,%d) not uniformly filled" % (mx, my))
+    return grid
+
+
+def function_mask(ver):
+    n = ver * 4 + 17
+    f = [[False] * n for _ in range(n)]
+
+    def mark(x0, y0, w, h):
+        for y in range(max(0, y0), min(n, y0 + h)):
+            for x in range(max(0, x0), min(n, x0 + w)):
+                f[y][x] = True
+
+    mark(0, 0, 9, 9)            # 定位 + 分隔 + 格式信息
+    mark(n - 8, 0, 8, 9)
+    mark(0, n - 8, 9, 8)
+    mark(6, 0, 1, n)            # 定时
+    mark(0, 6, n, 1)
+    pos = ALIGN_POS[ver]
+    for cy in pos:
+        for cx in pos:
+            if (cx, cy) in ((6, 6), (6, n - 7), (n - 7, 6)):
+                continue        # 与定位图形重叠
+            mark(cx - 2, cy - 2, 5, 5)
+    if ver >= 7:
+        mark(n - 11, 0, 3, 6)
+        mark(0, n - 11, 6, 3)
+    return f
+
+
+MASKS = [
+    lambda x, y: (x + y) % 2 == 0,
+    lambda x, y: y % 2 == 0,
+    lambda x, y: x % 3 == 0,
+    lambda x, y: (x + y) % 3 == 0,
+    lambda x, y: (x // 3 + y // 2) % 2 == 0,
+    lambda x, y: x * y % 2 + x * y % 3 == 0,
+    lambda x, y: (x * y % 2 + x * y % 3) % 2 == 0,
+    lambda x, y: ((x + y) % 2 + x * y % 3) % 2 == 0,
+]
+
+
+def read_format(g):
+    n = len(g)
+    a = [g[i][8] for i in range(6)] + [g[7][8], g[8][8], g[8][7]] + [g[8][14 - i] for i in range(9, 15)]
+    b = [g[8][n - 1 - i] for i in range(8)] + [g[n - 15 + i][8] for i in range(8, 15)]
+    if g[n - 8][8] != 1:
+        raise ValueError("dark module missing")
+    best = None
+    for bits in (a, b):
+        val = sum(v << i for i, v in enumerate(bits))
+        for data in range(32):
+            d = bin(val ^ bch_format(data)).count("1")
+            if best is None or d < best[0]:
+                best = (d, data)
+    if best[0] > 3:
+        raise ValueError("format information unreadable")
+    return FORMAT_ECC[best[1] >> 3], best[1] & 7
+
+
+def read_codewords(g, ver, mask):
+    n = len(g)
+    f = function_mask(ver)
+    bits = []
+    right = n - 1
+    while right >= 1:
+        if right == 6:
+            right = 5
+        upward = ((right + 1) & 2) == 0
+        for vert in range(n):
+            y = n - 1 - vert if upward else vert
+            for j in range(2):
+                x = right - j
+                if not f[y][x]:
+                    bits.append(g[y][x] ^ MASKS[mask](x, y))
+        right -= 2
+    return [int("".join(map(str, bits[i:i + 8])), 2) for i in range(0, len(bits) // 8 * 8, 8)]
+
+
+def deinterleave(cw, ver, ecc):
+    nb, ne = NUM_BLOCKS[ecc][ver - 1], ECC_PER_BLOCK[ecc][ver - 1]
+    total = len(cw)
+    if total - nb * ne != DATA_CW[ver][ecc]:
+        raise ValueError("codeword count mismatch with standard table")
+    short = nb - total % nb
+    short_len = total // nb - ne
+    blocks = [[] for _ in range(nb)]
+    k = 0
+    for i in range(short_len + 1):
+        for b in range(nb):
+            if i == short_len and b < short:
+                continue
+            blocks[b].append(cw[k])
+            k += 1
+    for i in range(ne):
+        for b in range(nb):
+            blocks[b].append(cw[k])
+            k += 1
+    return blocks, ne
+
+
+def parse(data, ver):
+    bits = "".join("{:08b}".format(b) for b in data)
+    pos = 0
+
+    def take(n):
+        nonlocal pos
+        v = int(bits[pos:pos + n] or "0", 2)
+        pos += n
+        return v
+
+    out = bytearray()
+    while pos + 4 <= len(bits):
+        mode = take(4)
+        if mode == 0:
+            break
+        big = ver >= 10
+        if mode == 1:
+            cnt = take(12 if big else 10)
+            while cnt >= 3:
+                out += b"%03d" % take(10)
+                cnt -= 3
+            if cnt == 2:
+                out += b"%02d" % take(7)
+            elif cnt == 1:
+                out += b"%d" % take(4)
+        elif mode == 2:
+            cnt = take(11 if big else 9)
+            while cnt >= 2:
+                v = take(11)
+                out += (ALNUM[v // 45] + ALNUM[v % 45]).encode()
+                cnt -= 2
+            if cnt:
+                out += ALNUM[take(6)].encode()
+        elif mode == 4:
+            cnt = take(16 if big else 8)
+            out += bytes(take(8) for _ in range(cnt))
+        else:
+            raise ValueError("unsupported mode %d" % mode)
+    return bytes(out)
+
+
+def decode(grid, inject=0, rng=None):
+    n = len(grid)
+    ver = (n - 17) // 4
+    if ver * 4 + 17 != n or not 1 <= ver <= VER_MAX:
+        raise ValueError("bad size %d" % n)
+    if ver >= 7:
+        for vals in ([grid[i // 3][n - 11 + i % 3] for i in range(18)], [grid[n - 11 + i % 3][i // 3] for i in range(18)]):
+            if sum(v << i for i, v in enumerate(vals)) != bch_version(ver):
+                raise ValueError("version information mismatch")
+    ecc, mask = read_format(grid)
+    blocks, ne = deinterleave(read_codewords(grid, ver, mask), ver, ecc)
+    data = []
+    fixed = 0
+    for blk in blocks:
+        if inject:
+            blk = list(blk)
+            for i in rng.sample(range(len(blk)), min(inject, ne // 2)):
+                blk[i] ^= rng.randrange(1, 256)
+        blk, nerr = rs_correct(blk, ne)
+        fixed += nerr
+        data += blk[:len(blk) - ne]
+    return parse(data, ver), ecc, mask, fixed
+
+
+# --- 测试内容 ---
+
+def payload(rng, mode, n):
+    if mode == "numeric":
+        return "".join(rng.choice("0123456789") for _ in range(n)).encode()
+    if mode == "alnum":
+        return "".join(rng.choice(ALNUM) for _ in range(n)).encode()
+    return bytes(rng.randrange(256) for _ in range(n))
+
+
+def bench(drv, ecc, scale, rounds):
+    print("version  size  bytes  encode(us)  render x%d(us)  mask  ecc" % scale)
+    for v in range(1, VER_MAX + 1):
+        cap = (DATA_CW[v][ecc] * 8 - 4 - (16 if v >= 10 else 8)) // 8
+        data = bytes(b"https://x.y/?k="[i % 15] for i in range(cap))
+        res = drv.run(data, ecc, rounds, scale)
+        if res is None or res["version"] != v:
+            print("v%d: unexpected version %s" % (v, res and res["version"]))
+            return False
+        print("%7d  %4d  %5d  %10.1f  %14.1f  %4d  %3s" % (v, res["size"], cap, res["enc_ns"] / 1000.0,
+                                                        res["render_ns"] / 1000.0, res["mask"], ECC_NAMES[res["ecc"]]))
+    return True
+
+
+def roundtrip(drv, cases, scale, seed):
+    rng = random.Random(seed)
+    failures = 0
+    versions = set()
+    corrected = 0
+    for i in range(cases):
+        mode = ("numeric", "alnum", "byte")[i % 3]
+        ecc = rng.randrange(4)
+        limit = {"numeric": 600, "alnum": 360, "byte": 250}[mode]
+        data = payload(rng, mode, rng.randrange(0, limit))
+        res = drv.run(data, ecc, 1, scale)
+        if res is None:
+            continue    # 超出版本 10 容量
+        try:
+            grid = sample(res, scale)
+            got, ecc_read, mask_read, _ = decode(grid)
+            if got != data:
+                raise ValueError("payload mismatch")
+            if ecc_read != res["ecc"] or mask_read != res["mask"] or ecc_read < ecc:
+                raise ValueError("format information mismatch")
+            got2, _, _, fixed = decode(grid, inject=ECC_PER_BLOCK[ecc_read][res["version"] - 1] // 2, rng=rng)
+            if got2 != data:
+                raise ValueError("payload mismatch after error injection")
+            corrected += fixed
+            versions.add(res["version"])
+        except ValueError as e:
+            failures += 1
+            print("FAIL case %d (%s, %d B, v%d-%s): %s" % (i, mode, len(data), res["version"], ECC_NAMES[res["ecc"]], e))
+    print("round-trip: %d cases, versions %s, %d injected codeword errors corrected, %d failures"
+          % (cases, sorted(versions), corrected, failures))
+    return failures == 0
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Host benchmark and decode round-trip test for gui_qr")
+    ap.add_argument("--cxx", default=os.environ.get("CXX", "g++"), help="host C++ compiler (default g++)")
+    ap.add_argument("--ecc", choices=list(ECC_NAMES), default="M", help="error correction level for the benchmark")
+    ap.add_argument("--scale", type=int, default=2, help="module scale in pixels (default 2)")
+    ap.add_argument("--rounds", type=int, default=200, help="benchmark repetitions per version")
+    ap.add_argument("--cases", type=int, default=300, help="round-trip test cases")
+    ap.add_argument("--seed", type=int, default=1)
+    args = ap.parse_args()
+
+    drv = Driver(args.cxx)
+    try:
+        ok = bench(drv, ECC_NAMES.index(args.ecc), args.scale, args.rounds)
+        ok = roundtrip(drv, args.cases, args.scale, args.seed) and ok
+    finally:
+        drv.close()
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,342 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file vlist_bench.py
+@brief gui_vlist 的主机端构建基准测试
+
+用主机编译器编译 src/gui_port/gui_vlist.cpp (加一个临时的驱动程序)，LVGL、Arduino、日志、
+gui_port、gui_txn、gui_scroll 由本文件中的最小桩代替 (只实现列表用到的接口)。
+分别以 10 / 1000 / 100000 (或 --counts 指定) 个条目构建整屏列表，输出:
+- 行池大小 (create_cb 调用次数)；
+- 堆占用: 构建后仍占用的字节数与峰值 (全局 new / delete 与 lv_mem 都计入)；
+- 构建耗时: gui_vlist_create + gui_vlist_set_count；
+- 跳转耗时: 跳到中间、末尾再回到开头的平均值。
+桩控件比 LVGL 的真实控件小，绝对字节数只用于比较不同条目数；设备上的实际数值见 GUI_VLIST_BENCH。
+行池与堆占用随条目数变化时以非零状态退出。
+
+用法:
+    python tools/vlist_bench.py
+    python tools/vlist_bench.py --counts 10,1000,100000,1000000 --row-h 20
+    python tools/vlist_bench.py --cxx clang++
+"""
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SRC = os.path.join(ROOT, "src", "gui_port")
+
+STUBS = {
+    "lvgl.h": r"""
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+typedef int16_t lv_coord_t;
+typedef struct _lv_obj_t lv_obj_t;
+typedef struct _lv_event_t lv_event_t;
+typedef struct _lv_indev_t lv_indev_t;
+typedef void (*lv_event_cb_t)(lv_event_t *e);
+typedef uint8_t lv_dir_t;
+
+enum { LV_DIR_NONE = 0, LV_DIR_LEFT = 1, LV_DIR_RIGHT = 2, LV_DIR_TOP = 4, LV_DIR_BOTTOM = 8 };
+enum { LV_EVENT_GESTURE = 1, LV_EVENT_DELETE = 2 };
+enum {
+    LV_OBJ_FLAG_HIDDEN = 1 << 0,
+    LV_OBJ_FLAG_SCROLLABLE = 1 << 4,
+    LV_OBJ_FLAG_GESTURE_BUBBLE = 1 << 11,
+};
+#define LV_UNUSED(x) ((void)x)
+
+static inline lv_coord_t lv_pct(lv_coord_t v) { return (lv_coord_t)(v | 0x2000); }
+
+void *lv_mem_alloc(size_t size);
+void *lv_mem_realloc(void *p, size_t size);
+void lv_mem_free(void *p);
+static inline void lv_memset_00(void *p, size_t n) { memset(p, 0, n); }
+
+lv_obj_t *lv_obj_create(lv_obj_t *parent);
+void lv_obj_del(lv_obj_t *obj);
+void lv_obj_remove_style_all(lv_obj_t *obj);
+void lv_obj_add_flag(lv_obj_t *obj, uint32_t f);
+void lv_obj_clear_flag(lv_obj_t *obj, uint32_t f);
+void lv_obj_set_size(lv_obj_t *obj, lv_coord_t w, lv_coord_t h);
+void lv_obj_set_x(lv_obj_t *obj, lv_coord_t x);
+void lv_obj_set_y(lv_obj_t *obj, lv_coord_t y);
+void lv_obj_update_layout(lv_obj_t *obj);
+lv_coord_t lv_obj_get_content_height(lv_obj_t *obj);
+uint32_t lv_obj_get_child_cnt(const lv_obj_t *obj);
+lv_obj_t *lv_obj_get_child(const lv_obj_t *obj, int32_t id);
+void lv_obj_set_user_data(lv_obj_t *obj, void *data);
+void *lv_obj_get_user_data(lv_obj_t *obj);
+void lv_obj_add_event_cb(lv_obj_t *obj, lv_event_cb_t cb, int code, void *user_data);
+lv_obj_t *lv_event_get_target(lv_event_t *e);
+lv_obj_t *lv_event_get_current_target(lv_event_t *e);
+lv_indev_t *lv_indev_get_act(void);
+lv_dir_t lv_indev_get_gesture_dir(const lv_indev_t *indev);
+void lv_indev_wait_release(lv_indev_t *indev);
+""",
+    "Arduino.h": r"""
+#pragma once
+#include <stdint.h>
+uint32_t millis(void);
+""",
+    "common/Log.h": r"""
+#pragma once
+#include <stdio.h>
+#define LOG_E(fmt, ...) fprintf(stderr, fmt "\n", ##__VA_ARGS__)
+#define LOG_I(fmt, ...) do { if (0) fprintf(stderr, fmt, ##__VA_ARGS__); } while (0)
+#define LOG_D(fmt, ...) do { if (0) fprintf(stderr, fmt, ##__VA_ARGS__); } while (0)
+""",
+    "gui_scroll.h": r"""
+#pragma once
+#include <lvgl.h>
+#define GUI_SCROLL_FAST_WAVEFORM 0
+typedef enum { GUI_SNAP_PAGE = 0, GUI_SNAP_ROW } gui_snap_unit_t;
+""",
+    "gui_port.h": r"""
+#pragma once
+typedef enum { EPD_REFRESH_FULL = 0, EPD_REFRESH_FAST, EPD_REFRESH_PARTIAL } epd_refresh_mode_t;
+void gui_port_request_mode(epd_refresh_mode_t mode);
+""",
+    "gui_txn.h": r"""
+#pragma once
+class GuiTxn {
+public:
+    explicit GuiTxn(const char *tag) { (void)tag; }
+};
+""",
+}
+
+DRIVER = r"""
+#include "gui_vlist.h"
+#include "gui_port.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+// --- 计数分配器: 每块前放一个长度头 ---
+static size_t s_live = 0, s_peak = 0;
+
+static void *_alloc(size_t n) {
+    size_t *p = (size_t *)malloc(n + sizeof(size_t) * 2);
+    if (p == NULL) return NULL;
+    p[0] = n;
+    s_live += n;
+    if (s_live > s_peak) s_peak = s_live;
+    return p + 2;
+}
+
+static void _free(void *ptr) {
+    if (ptr == NULL) return;
+    size_t *p = (size_t *)ptr - 2;
+    s_live -= p[0];
+    free(p);
+}
+
+void *operator new(size_t n) {
+    void *p = _alloc(n);
+    if (p == NULL) throw std::bad_alloc();
+    return p;
+}
+void operator delete(void *p) noexcept { _free(p); }
+void operator delete(void *p, size_t) noexcept { _free(p); }
+
+void *lv_mem_alloc(size_t n) { return _alloc(n); }
+void lv_mem_free(void *p) { _free(p); }
+void *lv_mem_realloc(void *ptr, size_t n) {
+    void *p = _alloc(n);
+    if (p && ptr) {
+        size_t old = ((size_t *)ptr)[-2];
+        memcpy(p, ptr, old < n ? old : n);
+    }
+    _free(ptr);
+    return p;
+}
+
+// --- 控件桩 ---
+struct Cb {
+    lv_event_cb_t cb;
+    int code;
+};
+
+struct _lv_obj_t {
+    lv_obj_t *parent = NULL;
+    std::vector<lv_obj_t *> children;
+    std::vector<Cb> cbs;
+    uint32_t flags = 0;
+    lv_coord_t x = 0, y = 0, w = 0, h = 0;
+    void *user_data = NULL;
+    char text[24] = {0};
+};
+
+struct _lv_event_t {
+    lv_obj_t *target;
+};
+
+lv_obj_t *lv_obj_create(lv_obj_t *parent) {
+    lv_obj_t *o = new lv_obj_t;
+    o->parent = parent;
+    if (parent) parent->children.push_back(o);
+    return o;
+}
+
+static void _del(lv_obj_t *o) {
+    for (lv_obj_t *c : o->children) _del(c);
+    lv_event_t e = {o};
+    for (const Cb &c : o->cbs) {
+        if (c.code == LV_EVENT_DELETE) c.cb(&e);
+    }
+    delete o;
+}
+
+void lv_obj_del(lv_obj_t *o) {
+    if (o->parent) {
+        auto &v = o->parent->children;
+        for (size_t i = 0; i < v.size(); i++) {
+            if (v[i] == o) {
+                v.erase(v.begin() + i);
+                break;
+            }
+        }
+    }
+    _del(o);
+}
+
+void lv_obj_remove_style_all(lv_obj_t *) {}
+void lv_obj_add_flag(lv_obj_t *o, uint32_t f) { o->flags |= f; }
+void lv_obj_clear_flag(lv_obj_t *o, uint32_t f) { o->flags &= ~f; }
+void lv_obj_set_size(lv_obj_t *o, lv_coord_t w, lv_coord_t h) { o->w = w; o->h = h; }
+void lv_obj_set_x(lv_obj_t *o, lv_coord_t x) { o->x = x; }
+void lv_obj_set_y(lv_obj_t *o, lv_coord_t y) { o->y = y; }
+void lv_obj_update_layout(lv_obj_t *) {}
+lv_coord_t lv_obj_get_content_height(lv_obj_t *o) { return o->h; }
+uint32_t lv_obj_get_child_cnt(const lv_obj_t *o) { return o->children.size(); }
+lv_obj_t *lv_obj_get_child(const lv_obj_t *o, int32_t id) { return o->children[id]; }
+void lv_obj_set_user_data(lv_obj_t *o, void *d) { o->user_data = d; }
+void *lv_obj_get_user_data(lv_obj_t *o) { return o->user_data; }
+void lv_obj_add_event_cb(lv_obj_t *o, lv_event_cb_t cb, int code, void *) { o->cbs.push_back({cb, code}); }
+lv_obj_t *lv_event_get_target(lv_event_t *e) { return e->target; }
+lv_obj_t *lv_event_get_current_target(lv_event_t *e) { return e->target; }
+lv_indev_t *lv_indev_get_act(void) { return NULL; }
+lv_dir_t lv_indev_get_gesture_dir(const lv_indev_t *) { return LV_DIR_NONE; }
+void lv_indev_wait_release(lv_indev_t *) {}
+uint32_t millis(void) { return 0; }
+void gui_port_request_mode(epd_refresh_mode_t) {}
+
+// --- 行回调: 一个 "标签" 子控件，绑定时写入文本 ---
+static uint32_t s_created = 0, s_bound = 0;
+
+static lv_obj_t *_row(lv_obj_t *parent, void *) {
+    lv_obj_t *row = lv_obj_create(parent);
+    lv_obj_create(row);
+    s_created++;
+    return row;
+}
+
+static void _bind(lv_obj_t *row, uint32_t index, void *) {
+    snprintf(lv_obj_get_child(row, 0)->text, sizeof(row->text), "Item %u", index);
+    s_bound++;
+}
+
+// 输入每行: count row_h screen_h    输出: pool binds live peak build_ns jump_ns leak
+int main() {
+    lv_obj_t *scr = lv_obj_create(NULL);
+    scr->children.reserve(4);   // 屏幕的子控件表预先分配，不计入第一次构建
+    unsigned count;
+    int row_h, screen_h;
+    while (scanf("%u %d %d", &count, &row_h, &screen_h) == 3) {
+        s_created = s_bound = 0;
+        size_t base = s_live;
+        s_peak = s_live;
+
+        auto t0 = std::chrono::steady_clock::now();
+        lv_obj_t *list = gui_vlist_create(scr, row_h, _row, _bind, NULL);
+        lv_obj_set_size(list, 264, screen_h);
+        gui_vlist_set_count(list, count);
+        auto t1 = std::chrono::steady_clock::now();
+        size_t live = s_live - base, peak = s_peak - base;
+        uint32_t binds = s_bound;
+
+        const int jumps = 300;
+        auto t2 = std::chrono::steady_clock::now();
+        for (int r = 0; r < jumps / 3; r++) {
+            gui_vlist_scroll_to(list, count / 2);
+            gui_vlist_scroll_to(list, count);
+            gui_vlist_scroll_to(list, 0);
+        }
+        auto t3 = std::chrono::steady_clock::now();
+
+        lv_obj_del(list);
+        double build = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        double jump = std::chrono::duration<double, std::nano>(t3 - t2).count() / jumps;
+        printf("%u %u %zu %zu %.0f %.0f %zu\n", s_created, binds, live, peak, build, jump, s_live - base);
+        fflush(stdout);
+    }
+    lv_obj_del(scr);
+    return 0;
+}
+"""
+
+
+def build(cxx, tmp):
+    for name, text in STUBS.items():
+        path = os.path.join(tmp, name)
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+        with open(path, "w") as f:
+            f.write(text)
+    # 拷贝到临时目录编译，使 #include "gui_port.h" 等先找到桩而不是源码目录中的真实头文件
+    for name in ("gui_vlist.h", "gui_vlist.cpp"):
+        shutil.copy(os.path.join(SRC, name), tmp)
+    drv = os.path.join(tmp, "driver.cpp")
+    exe = os.path.join(tmp, "vlist_host")
+    with open(drv, "w") as f:
+        f.write(DRIVER)
+    # 源码按 ESP32 的 uint32_t (unsigned long) 使用 %lu，主机上关闭格式检查
+    cmd = [cxx, "-std=gnu++17", "-O2", "-Wall", "-Wno-format", "-I", tmp, drv, os.path.join(tmp, "gui_vlist.cpp"), "-o", exe]
+    subprocess.run(cmd, check=True)
+    return exe
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--counts", default="10,1000,100000", help="条目数，逗号分隔")
+    ap.add_argument("--row-h", type=int, default=24, help="行高 (像素)")
+    ap.add_argument("--height", type=int, default=176, help="列表高度 (像素)")
+    ap.add_argument("--cxx", default="g++")
+    args = ap.parse_args()
+    counts = [int(c) for c in args.counts.split(",")]
+
+    with tempfile.TemporaryDirectory() as tmp:
+        exe = build(args.cxx, tmp)
+        inp = "".join("%d %d %d\n" % (n, args.row_h, args.height) for n in counts)
+        out = subprocess.run([exe], input=inp, stdout=subprocess.PIPE, text=True, check=True).stdout
+
+    print("list %dx%d, row %d px" % (264, args.height, args.row_h))
+    print("%10s %6s %6s %10s %10s %12s %10s" % ("items", "pool", "binds", "heap B", "peak B", "build us", "jump us"))
+    rows = []
+    ok = True
+    for n, line in zip(counts, out.splitlines()):
+        pool, binds, live, peak, build_ns, jump_ns, leak = (int(v) for v in line.split())
+        rows.append((pool, live))
+        print("%10d %6d %6d %10d %10d %12.1f %10.2f" % (n, pool, binds, live, peak, build_ns / 1000, jump_ns / 1000))
+        if leak:
+            print("  leak after delete: %d B" % leak)
+            ok = False
+
+    if len(set(rows)) > 1:
+        print("FAIL: pool size / heap use depend on item count")
+        ok = False
+    else:
+        print("pool and heap independent of item count")
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
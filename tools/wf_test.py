@@ -0,0 +1,318 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file wf_test.py
+@brief gui_wf 刷新计划的主机端测试
+
+用主机编译器编译 src/gui_port/gui_wf.cpp (加一个临时的驱动程序)，LVGL、Arduino、日志、gui_inv、
+gui_port 由本文件中的最小桩代替 (只实现注册表与区域运算用到的接口)，bsp/bsp_epd.h 用源码中的真实头文件。
+驱动程序按 rounder_cb 的方式喂入脏区域 (可指定失效来源控件)，检查 gui_wf_plan 的结果:
+- 只有局刷类开关变化的帧得到局刷 (与设备上的 GUI_WF_CHECK 自检相同)；
+- 子控件继承最近的已标注祖先，来源未知时按区域是否落在已标注控件 (含扩展绘制区域) 内判断；
+- 各类别取最强的刷新方式，未标注区域沿用请求的方式；
+- 局刷类区域与整屏刷新区域不相交时拆分，相交时不拆分；
+- 取消标注、控件删除后不再归类，结算与 gui_wf_reset 清空累积。
+任一检查失败时以非零状态退出。
+
+用法:
+    python tools/wf_test.py
+    python tools/wf_test.py --cxx clang++
+"""
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SRC = os.path.join(ROOT, "src")
+
+STUBS = {
+    "lvgl.h": r"""
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef int16_t lv_coord_t;
+typedef struct {
+    lv_coord_t x1, y1, x2, y2;
+} lv_area_t;
+typedef struct _lv_obj_t lv_obj_t;
+typedef struct _lv_event_t lv_event_t;
+typedef void (*lv_event_cb_t)(lv_event_t *e);
+
+enum { LV_EVENT_DELETE = 2 };
+enum { LV_OBJ_FLAG_USER_1 = 1 << 27 };
+#define LV_UNUSED(x) ((void)x)
+
+void lv_obj_add_flag(lv_obj_t *obj, uint32_t f);
+void lv_obj_clear_flag(lv_obj_t *obj, uint32_t f);
+bool lv_obj_has_flag(const lv_obj_t *obj, uint32_t f);
+lv_obj_t *lv_obj_get_parent(const lv_obj_t *obj);
+void lv_obj_add_event_cb(lv_obj_t *obj, lv_event_cb_t cb, int code, void *user_data);
+bool lv_obj_remove_event_cb(lv_obj_t *obj, lv_event_cb_t cb);
+lv_obj_t *lv_event_get_target(lv_event_t *e);
+void lv_obj_get_coords(const lv_obj_t *obj, lv_area_t *area);
+lv_coord_t _lv_obj_get_ext_draw_size(const lv_obj_t *obj);
+
+// 与 LVGL 8.3 lv_area.c 相同的语义
+static inline void lv_area_increase(lv_area_t *a, lv_coord_t w, lv_coord_t h) {
+    a->x1 -= w; a->x2 += w; a->y1 -= h; a->y2 += h;
+}
+static inline bool _lv_area_is_in(const lv_area_t *in, const lv_area_t *holder, lv_coord_t radius) {
+    (void)radius;
+    return in->x1 >= holder->x1 && in->y1 >= holder->y1 && in->x2 <= holder->x2 && in->y2 <= holder->y2;
+}
+static inline bool _lv_area_is_on(const lv_area_t *a, const lv_area_t *b) {
+    return a->x1 <= b->x2 && a->x2 >= b->x1 && a->y1 <= b->y2 && a->y2 >= b->y1;
+}
+static inline void _lv_area_join(lv_area_t *res, const lv_area_t *a, const lv_area_t *b) {
+    lv_area_t r = {a->x1 < b->x1 ? a->x1 : b->x1, a->y1 < b->y1 ? a->y1 : b->y1,
+                   a->x2 > b->x2 ? a->x2 : b->x2, a->y2 > b->y2 ? a->y2 : b->y2};
+    *res = r;
+}
+""",
+    "Arduino.h": r"""
+#pragma once
+""",
+    "common/Log.h": r"""
+#pragma once
+#include <stdio.h>
+#define LOG_E(fmt, ...) fprintf(stderr, fmt "\n", ##__VA_ARGS__)
+#define LOG_I(fmt, ...) do { if (0) fprintf(stderr, fmt, ##__VA_ARGS__); } while (0)
+#define LOG_D(fmt, ...) do { if (0) fprintf(stderr, fmt, ##__VA_ARGS__); } while (0)
+#define LOG_RAW(...) do { if (0) fprintf(stderr, __VA_ARGS__); } while (0)
+""",
+    "gui_inv.h": r"""
+#pragma once
+#include <lvgl.h>
+const lv_obj_t *gui_inv_current_obj(void);
+""",
+    "gui_port.h": r"""
+#pragma once
+#include <lvgl.h>
+#include "bsp/bsp_epd.h"
+""",
+}
+
+DRIVER = r"""
+#include "gui_wf.h"
+#include "gui_inv.h"
+#include <cstdio>
+#include <vector>
+
+// --- 控件桩 ---
+struct Cb {
+    lv_event_cb_t cb;
+    int code;
+};
+
+struct _lv_obj_t {
+    lv_obj_t *parent;
+    lv_area_t coords;
+    lv_coord_t ext;
+    uint32_t flags;
+    std::vector<Cb> cbs;
+};
+
+struct _lv_event_t {
+    lv_obj_t *target;
+};
+
+void lv_obj_add_flag(lv_obj_t *o, uint32_t f) { o->flags |= f; }
+void lv_obj_clear_flag(lv_obj_t *o, uint32_t f) { o->flags &= ~f; }
+bool lv_obj_has_flag(const lv_obj_t *o, uint32_t f) { return (o->flags & f) == f; }
+lv_obj_t *lv_obj_get_parent(const lv_obj_t *o) { return o->parent; }
+void lv_obj_add_event_cb(lv_obj_t *o, lv_event_cb_t cb, int code, void *) { o->cbs.push_back({cb, code}); }
+bool lv_obj_remove_event_cb(lv_obj_t *o, lv_event_cb_t cb) {
+    for (size_t i = 0; i < o->cbs.size(); i++) {
+        if (o->cbs[i].cb == cb) {
+            o->cbs.erase(o->cbs.begin() + i);
+            return true;
+        }
+    }
+    return false;
+}
+lv_obj_t *lv_event_get_target(lv_event_t *e) { return e->target; }
+void lv_obj_get_coords(const lv_obj_t *o, lv_area_t *a) { *a = o->coords; }
+lv_coord_t _lv_obj_get_ext_draw_size(const lv_obj_t *o) { return o->ext; }
+
+static const lv_obj_t *s_ctx = NULL;
+const lv_obj_t *gui_inv_current_obj(void) { return s_ctx; }
+
+static lv_obj_t *obj(lv_obj_t *parent, lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2, lv_coord_t ext = 0) {
+    return new lv_obj_t{parent, {x1, y1, x2, y2}, ext, 0, {}};
+}
+
+static void del(lv_obj_t *o) {
+    lv_event_t e = {o};
+    for (const Cb &c : o->cbs) {
+        if (c.code == LV_EVENT_DELETE) c.cb(&e);
+    }
+    delete o;
+}
+
+// 来源控件 ctx (NULL: 来源未知) 使区域失效
+static void inv(const lv_obj_t *ctx, lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2) {
+    lv_area_t a = {x1, y1, x2, y2};
+    s_ctx = ctx;
+    gui_wf_on_area(&a);
+    s_ctx = NULL;
+}
+
+static int s_fail = 0, s_total = 0;
+
+static void check(const char *name, bool cond) {
+    s_total++;
+    if (!cond) s_fail++;
+    printf("%s %s\n", cond ? "ok  " : "FAIL", name);
+}
+
+static bool plan_is(epd_refresh_mode_t req, bool any, epd_refresh_mode_t mode, gui_wf_class_t cls, bool split) {
+    gui_wf_plan_t p;
+    bool r = gui_wf_plan(req, &p);
+    return r == any && p.mode == mode && p.cls == cls && p.split == split;
+}
+
+int main() {
+    lv_obj_t *scr = obj(NULL, 0, 0, 263, 175);
+    lv_obj_t *sw = obj(scr, 100, 70, 149, 99, 2);
+    lv_obj_t *knob = obj(sw, 120, 72, 147, 97);
+    lv_obj_t *photo = obj(scr, 0, 0, 99, 175);
+    lv_obj_t *badge = obj(photo, 10, 10, 29, 29);
+    lv_obj_t *badge_txt = obj(badge, 12, 12, 27, 27);
+    lv_obj_t *chart = obj(scr, 150, 100, 263, 175);
+
+    gui_wf_set(sw, GUI_WF_PARTIAL);
+    gui_wf_set(photo, GUI_WF_QUALITY);
+    gui_wf_set(badge, GUI_WF_PARTIAL);
+    gui_wf_set(chart, GUI_WF_FAST);
+
+    check("class: tagged object", gui_wf_get(sw) == GUI_WF_PARTIAL);
+    check("class: child inherits parent", gui_wf_get(knob) == GUI_WF_PARTIAL);
+    check("class: nearest tagged ancestor wins", gui_wf_get(badge_txt) == GUI_WF_PARTIAL);
+    check("class: untagged screen", gui_wf_get(scr) == GUI_WF_NONE);
+
+    // 设备自检的同一场景: 只切换局刷类开关 (LVGL 内部失效，来源未知)
+    inv(NULL, 100, 70, 149, 99);
+    check("switch-only frame -> partial", plan_is(EPD_REFRESH_FULL, true, EPD_REFRESH_PARTIAL, GUI_WF_PARTIAL, false));
+    inv(knob, 120, 72, 147, 97);
+    check("switch knob (source known) -> partial", plan_is(EPD_REFRESH_FULL, true, EPD_REFRESH_PARTIAL, GUI_WF_PARTIAL, false));
+    inv(NULL, 98, 68, 151, 101);
+    check("unknown source within ext draw -> partial", plan_is(EPD_REFRESH_FULL, true, EPD_REFRESH_PARTIAL, GUI_WF_PARTIAL, false));
+    inv(NULL, 97, 68, 151, 101);
+    check("unknown source beyond ext draw -> request", plan_is(EPD_REFRESH_FULL, true, EPD_REFRESH_FULL, GUI_WF_NONE, false));
+
+    check("empty frame -> no plan", plan_is(EPD_REFRESH_FAST, false, EPD_REFRESH_FAST, GUI_WF_NONE, false));
+    inv(sw, 100, 70, 149, 99);
+    check("plan clears accumulation", plan_is(EPD_REFRESH_FULL, true, EPD_REFRESH_PARTIAL, GUI_WF_PARTIAL, false)
+                                      && plan_is(EPD_REFRESH_FULL, false, EPD_REFRESH_FULL, GUI_WF_NONE, false));
+    inv(sw, 100, 70, 149, 99);
+    gui_wf_reset();
+    check("reset discards accumulation", plan_is(EPD_REFRESH_FULL, false, EPD_REFRESH_FULL, GUI_WF_NONE, false));
+
+    // 强弱: FULL > FAST > PARTIAL，未标注区域沿用请求
+    inv(chart, 150, 100, 200, 120);
+    check("fast only -> fast", plan_is(EPD_REFRESH_FULL, true, EPD_REFRESH_FAST, GUI_WF_FAST, false));
+    inv(chart, 150, 100, 200, 120);
+    inv(badge_txt, 12, 12, 27, 27);
+    inv(photo, 40, 40, 60, 60);
+    check("quality beats fast", plan_is(EPD_REFRESH_PARTIAL, true, EPD_REFRESH_FULL, GUI_WF_QUALITY, true));
+    inv(scr, 200, 0, 263, 20);
+    check("untagged uses partial request", plan_is(EPD_REFRESH_PARTIAL, true, EPD_REFRESH_PARTIAL, GUI_WF_NONE, false));
+    inv(scr, 200, 0, 263, 20);
+    inv(sw, 100, 70, 149, 99);
+    check("untagged partial request + switch -> partial, no split",
+          plan_is(EPD_REFRESH_PARTIAL, true, EPD_REFRESH_PARTIAL, GUI_WF_NONE, false));
+
+    // 拆分
+    inv(sw, 100, 70, 149, 99);
+    inv(scr, 200, 0, 263, 20);
+    gui_wf_plan_t p;
+    bool any = gui_wf_plan(EPD_REFRESH_FULL, &p);
+    check("disjoint switch + untagged full -> split", any && p.mode == EPD_REFRESH_FULL && p.cls == GUI_WF_NONE && p.split
+          && p.split_area.x1 == 100 && p.split_area.y1 == 70 && p.split_area.x2 == 149 && p.split_area.y2 == 99);
+    inv(sw, 100, 70, 149, 99);
+    inv(scr, 140, 90, 200, 120);
+    check("overlapping switch + untagged full -> no split", plan_is(EPD_REFRESH_FULL, true, EPD_REFRESH_FULL, GUI_WF_NONE, false));
+    inv(sw, 100, 70, 149, 99);
+    inv(chart, 149, 99, 200, 120);
+    check("switch touching fast area -> no split", plan_is(EPD_REFRESH_FULL, true, EPD_REFRESH_FAST, GUI_WF_FAST, false));
+    inv(sw, 100, 70, 149, 99);
+    inv(chart, 160, 110, 200, 120);
+    check("switch apart from fast area -> split", plan_is(EPD_REFRESH_FULL, true, EPD_REFRESH_FAST, GUI_WF_FAST, true));
+
+    // 取消标注与删除
+    gui_wf_set(chart, GUI_WF_NONE);
+    check("untag clears class", gui_wf_get(chart) == GUI_WF_NONE && !lv_obj_has_flag(chart, LV_OBJ_FLAG_USER_1));
+    inv(NULL, 150, 100, 200, 120);
+    check("untagged area -> request", plan_is(EPD_REFRESH_FULL, true, EPD_REFRESH_FULL, GUI_WF_NONE, false));
+    gui_wf_set(sw, GUI_WF_QUALITY);
+    check("retag changes class", gui_wf_get(knob) == GUI_WF_QUALITY);
+    gui_wf_set(sw, GUI_WF_PARTIAL);
+    del(knob);
+    del(sw);
+    inv(NULL, 100, 70, 149, 99);
+    check("deleted object leaves registry", plan_is(EPD_REFRESH_FULL, true, EPD_REFRESH_FULL, GUI_WF_NONE, false));
+
+    // 注册表容量
+    std::vector<lv_obj_t *> many;
+    for (int i = 0; i < GUI_WF_MAX + 2; i++) {
+        many.push_back(obj(scr, 0, 0, 1, 1));
+        gui_wf_set(many.back(), GUI_WF_PARTIAL);
+    }
+    int tagged = 0;
+    for (lv_obj_t *o : many) tagged += gui_wf_get(o) == GUI_WF_PARTIAL;
+    check("registry full: extra objects stay untagged", tagged == GUI_WF_MAX - 2);
+    for (lv_obj_t *o : many) del(o);
+    many.clear();
+    many.push_back(obj(scr, 0, 0, 1, 1));
+    gui_wf_set(many.back(), GUI_WF_PARTIAL);
+    check("registry frees slots on delete", gui_wf_get(many.back()) == GUI_WF_PARTIAL);
+    del(many.back());
+
+    del(badge_txt);
+    del(badge);
+    del(photo);
+    del(chart);
+    delete scr;
+    printf("%d/%d passed\n", s_total - s_fail, s_total);
+    return s_fail ? 1 : 0;
+}
+"""
+
+
+def build(cxx, tmp):
+    for name, text in STUBS.items():
+        path = os.path.join(tmp, name)
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+        with open(path, "w") as f:
+            f.write(text)
+    # 拷贝到临时目录编译，使 #include "gui_port.h" 等先找到桩而不是源码目录中的真实头文件
+    for name in ("gui_wf.h", "gui_wf.cpp"):
+        shutil.copy(os.path.join(SRC, "gui_port", name), tmp)
+    drv = os.path.join(tmp, "driver.cpp")
+    exe = os.path.join(tmp, "wf_host")
+    with open(drv, "w") as f:
+        f.write(DRIVER)
+    # 源码按 ESP32 的 uint32_t (unsigned long) 使用 %lu，主机上关闭格式检查
+    cmd = [cxx, "-std=gnu++17", "-O2", "-Wall", "-Wno-format", "-I", tmp, "-I", SRC,
+           drv, os.path.join(tmp, "gui_wf.cpp"), "-o", exe]
+    subprocess.run(cmd, check=True)
+    return exe
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--cxx", default="g++")
+    args = ap.parse_args()
+
+    with tempfile.TemporaryDirectory() as tmp:
+        exe = build(args.cxx, tmp)
+        return subprocess.run([exe]).returncode
+
+
+if __name__ == "__main__":
+    sys.exit(main())